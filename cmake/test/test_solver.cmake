@@ -0,0 +1,25 @@
+file(GLOB TEST_SOURCE ${TOP_DIR}/test/solver/*.cpp)
+
+add_executable(
+    test_solver
+    ${TEST_SOURCE}
+)
+
+target_include_directories(
+    test_solver
+    PUBLIC ${TOP_DIR}/printemps/
+    PUBLIC ${TOP_DIR}/external/include/
+)
+
+target_link_libraries(
+    test_solver
+    PUBLIC gtest
+    PUBLIC gtest_main
+    PUBLIC Threads::Threads
+)
+
+add_test(
+    NAME test_solver
+    COMMAND test_solver --gtest_output=xml
+    WORKING_DIRECTORY ${TOP_DIR}
+)
@@ -7,9 +7,66 @@
 #define PRINTEMPS_HELPER_AUXILIARY_FILE_READER_H__
 
 namespace printemps::helper {
+/*****************************************************************************/
+inline bool is_json_file(const std::string &a_FILE_NAME) {
+    std::ifstream ifs(a_FILE_NAME.c_str());
+    if (ifs.fail()) {
+        throw std::runtime_error(utility::format_error_location(
+            __FILE__, __LINE__, __func__,
+            "Cannot open the specified file: " + a_FILE_NAME));
+    }
+
+    char c = 0;
+    ifs >> c;
+    return c == '{';
+}
+
+/*****************************************************************************/
+inline std::unordered_map<std::string, int> read_names_and_values_json(
+    const std::string &a_FILE_NAME) {
+    /**
+     * This function reads the values of variables from a JSON file. If the
+     * root object has the "variables" object, as in the solution files
+     * written by the solver, its members are read. Otherwise, the members of
+     * the root object are read.
+     */
+    std::unordered_map<std::string, int> names_and_values;
+
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.read(a_FILE_NAME);
+
+    if (!ROOT.is_object()) {
+        throw std::runtime_error(utility::format_error_location(
+            __FILE__, __LINE__, __func__,
+            "Specified JSON file is not valid: " + a_FILE_NAME));
+    }
+
+    const auto  VARIABLES_PTR = ROOT.find_member("variables");
+    const auto &VARIABLES =
+        (VARIABLES_PTR != nullptr && VARIABLES_PTR->is_object())
+            ? *VARIABLES_PTR
+            : ROOT;
+
+    names_and_values.reserve(VARIABLES.size);
+    for (const auto &member : VARIABLES) {
+        if (!member.is_number()) {
+            continue;
+        }
+        names_and_values[std::string(member.key)] =
+            static_cast<int>(floor(0.5 + member.as<double>()));
+    }
+
+    return names_and_values;
+}
+
 /*****************************************************************************/
 inline std::unordered_map<std::string, int> read_names_and_values(
     const std::string &a_FILE_NAME) {
+    if (is_json_file(a_FILE_NAME)) {
+        return read_names_and_values_json(a_FILE_NAME);
+    }
+
     std::unordered_map<std::string, int> names_and_values;
 
     std::vector<std::string> lines;
@@ -17,6 +17,12 @@ struct ModelConstant {
     static constexpr int MAX_NUMBER_OF_VARIABLE_PROXIES   = 100;
     static constexpr int MAX_NUMBER_OF_EXPRESSION_PROXIES = 100;
     static constexpr int MAX_NUMBER_OF_CONSTRAINT_PROXIES = 100;
+
+    /**
+     * Moves with alterations up to the following number are evaluated without
+     * heap allocation in merging the columns of the incidence matrix.
+     */
+    static constexpr int MERGE_BUFFER_SIZE = 16;
 };
 
 /*****************************************************************************/
@@ -52,6 +58,8 @@ class Model {
 
     double m_global_penalty_coefficient;
 
+    utility::simd::InstructionSet m_instruction_set;
+
     std::vector<model_component::Selection<T_Variable, T_Expression>>
         m_selections;
 
@@ -73,11 +81,28 @@ class Model {
     model_component::ConstraintTypeReference<T_Variable, T_Expression>  //
         m_constraint_type_reference;
 
+    model_component::ConstraintStateTable<T_Variable, T_Expression>  //
+        m_constraint_state_table;
+    /**
+     * The incidence matrix refers to the variables and constraints only by
+     * their ids, so that it is shared with the models created by fork().
+     */
+    std::shared_ptr<model_component::IncidenceMatrix<T_Variable, T_Expression>>
+        m_incidence_matrix_ptr;
+    model_component::VariableImprovabilityTable<T_Variable, T_Expression>  //
+        m_variable_improvability_table;
+    model_component::StructureDirtySet<T_Variable, T_Expression>  //
+        m_structure_dirty_set;
+
     std::vector<model_component::Constraint<T_Variable, T_Expression> *>
         m_current_violative_constraint_ptrs;
     std::vector<model_component::Constraint<T_Variable, T_Expression> *>
         m_previous_violative_constraint_ptrs;
 
+    /// The buffer for the related expressions of multi-variable moves.
+    std::vector<model_component::Expression<T_Variable, T_Expression> *>
+        m_related_expression_ptrs;
+
     std::vector<
         std::pair<model_component::Variable<T_Variable, T_Expression> *,
                   model_component::Variable<T_Variable, T_Expression> *>>
@@ -131,6 +156,8 @@ class Model {
 
         m_global_penalty_coefficient = 0.0;
 
+        m_instruction_set = utility::simd::detect_instruction_set();
+
         m_selections.clear();
         m_variable_reference_original.initialize();
         m_variable_type_reference_original.initialize();
@@ -142,8 +169,15 @@ class Model {
         m_constraint_reference.initialize();
         m_constraint_type_reference.initialize();
 
+        m_constraint_state_table.initialize();
+        m_incidence_matrix_ptr = std::make_shared<
+            model_component::IncidenceMatrix<T_Variable, T_Expression>>();
+        m_variable_improvability_table.initialize();
+        m_structure_dirty_set.initialize();
+
         m_current_violative_constraint_ptrs.clear();
         m_previous_violative_constraint_ptrs.clear();
+        m_related_expression_ptrs.clear();
         m_flippable_variable_ptr_pairs.clear();
 
         m_neighborhood.initialize();
@@ -685,9 +719,11 @@ class Model {
         }
 
         /**
-         * Extract and eliminate the intermediate variables.
+         * Extract and eliminate the intermediate variables. The structure is
+         * updated incrementally from here, only for the variables and
+         * constraints changed by presolving.
          */
-        this->setup_structure();
+        this->update_structure();
 
         if (a_OPTION.preprocess.is_enabled_presolve &&
             a_OPTION.preprocess.is_enabled_extract_dependent()) {
@@ -700,7 +736,7 @@ class Model {
                 }
 
                 while (true) {
-                    this->setup_structure();
+                    this->update_structure();
                     if (dependent_variable_extractor.eliminate(
                             a_IS_ENABLED_PRINT) == 0) {
                         break;
@@ -708,7 +744,7 @@ class Model {
                 }
 
                 m_problem_size_reducer.reduce_problem_size(a_IS_ENABLED_PRINT);
-                this->setup_structure();
+                this->update_structure();
             }
         }
 
@@ -734,13 +770,17 @@ class Model {
                     a_IS_ENABLED_PRINT);
         }
 
+        if (a_OPTION.preprocess.is_enabled_presolve) {
+            m_problem_size_reducer.print_elapsed_times(a_IS_ENABLED_PRINT);
+        }
+
         /**
-         * Perform setup_structure again if there are new removed(disabled)
+         * Perform update_structure again if there are new removed(disabled)
          * variables or constraints.
          */
         if (number_of_fixed_variables > 0 ||
             number_of_removed_constraints > 0) {
-            this->setup_structure();
+            this->update_structure();
         }
 
         /**
@@ -760,7 +800,7 @@ class Model {
         /**
          * Final structure analysis.
          */
-        this->setup_structure();
+        this->update_structure();
 
         /**
          * Setup the neighborhood generators.
@@ -803,6 +843,13 @@ class Model {
          */
         this->setup_fixed_sensitivities(a_IS_ENABLED_PRINT);
 
+        /**
+         * Set up the related expressions of variables, which must be done
+         * after presolving because it may substitute variables in the
+         * expressions.
+         */
+        this->setup_variable_related_expressions();
+
         /**
          * Set up the pointers to mutable variable with positive and negative
          * coefficients for efficient improvability screening.
@@ -810,9 +857,12 @@ class Model {
         this->setup_positive_and_negative_coefficient_mutable_variable_ptrs();
 
         /**
-         * Set up the constraint sensitivities of variables.
+         * Set up the constraint state table and the incidence matrix for the
+         * move evaluation.
          */
-        this->setup_variable_constraint_sensitivities();
+        this->setup_constraint_state_table();
+        this->setup_incidence_matrix();
+        this->setup_variable_improvability_table();
 
         /**
          * Set up the indices of related constraints for selection variables.
@@ -855,8 +905,537 @@ class Model {
 
         this->setup_variable_related_constraints();
         this->setup_variable_related_binary_coefficient_constraints();
+        this->setup_variable_related_expressions();
         this->setup_variable_objective_sensitivities();
-        this->setup_variable_constraint_sensitivities();
+        this->setup_constraint_state_table();
+        this->setup_incidence_matrix();
+        this->setup_variable_improvability_table();
+
+        m_structure_dirty_set.setup(m_variable_reference.variable_ptrs,
+                                    m_constraint_reference.constraint_ptrs,
+                                    this->number_of_expressions());
+    }
+
+    /*************************************************************************/
+    inline void update_structure(void) {
+        /**
+         * This method updates the structure set up by setup_structure() only
+         * for the variables, constraints, and expressions in the dirty set,
+         * instead of rebuilding it for the entire model. The related
+         * constraints and expressions, the types of constraints, the variable
+         * and constraint references, the constraint state table, and the
+         * columns of the incidence matrix are updated only for the affected
+         * ones, and the ids of the existing variables and constraints are
+         * kept. If variables have been added, the structure is rebuilt
+         * entirely.
+         */
+        int number_of_variables = 0;
+        for (auto &&proxy : m_variable_proxies) {
+            number_of_variables += proxy.number_of_elements();
+        }
+        if (number_of_variables !=
+            m_structure_dirty_set.number_of_variables()) {
+            this->setup_structure();
+            return;
+        }
+
+#ifndef NDEBUG
+        /**
+         * In debug builds, verify that the expressions of the constraints have
+         * not been modified without mark_structure_dirty().
+         */
+        const auto UNREGISTERED_MODIFIED_CONSTRAINT_PTRS =
+            m_structure_dirty_set.unregistered_modified_constraint_ptrs();
+        if (!UNREGISTERED_MODIFIED_CONSTRAINT_PTRS.empty()) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The expression of the constraint " +
+                    UNREGISTERED_MODIFIED_CONSTRAINT_PTRS.front()->name() +
+                    " was modified without mark_structure_dirty()."));
+        }
+#endif
+
+        /**
+         * Collect the constraints whose expressions have been modified and the
+         * constraints created after the last setup. The latter are appended to
+         * the constraint references and the constraint state table with new
+         * ids.
+         */
+        std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+            dirty_constraint_ptrs;
+        std::unordered_set<
+            model_component::Constraint<T_Variable, T_Expression> *>
+            dirty_constraint_ptr_set;
+
+        for (auto &&constraint_ptr :
+             m_structure_dirty_set.dirty_constraint_ptrs) {
+            if (dirty_constraint_ptr_set.insert(constraint_ptr).second) {
+                dirty_constraint_ptrs.push_back(constraint_ptr);
+            }
+        }
+
+        int       constraint_index     = 0;
+        const int OLD_CONSTRAINTS_SIZE = m_structure_dirty_set
+                                             .number_of_constraints();
+        for (auto &&proxy : m_constraint_proxies) {
+            for (auto &&constraint : proxy.flat_indexed_constraints()) {
+                if (constraint_index++ < OLD_CONSTRAINTS_SIZE) {
+                    continue;
+                }
+                m_constraint_reference.constraint_ptrs.push_back(&constraint);
+                if (dirty_constraint_ptr_set.insert(&constraint).second) {
+                    dirty_constraint_ptrs.push_back(&constraint);
+                }
+            }
+        }
+        m_constraint_state_table.extend(m_constraint_reference.constraint_ptrs);
+
+        /**
+         * Update the related constraints of the variables included in the
+         * dirty constraints before and after the modifications.
+         */
+        std::vector<model_component::Variable<T_Variable, T_Expression> *>
+            incidence_variable_ptrs;
+        std::unordered_set<
+            model_component::Variable<T_Variable, T_Expression> *>
+            incidence_variable_ptr_set;
+
+        for (auto &&variable_ptr : m_structure_dirty_set.dirty_variable_ptrs) {
+            if (incidence_variable_ptr_set.insert(variable_ptr).second) {
+                incidence_variable_ptrs.push_back(variable_ptr);
+            }
+        }
+        for (auto &&constraint_ptr : dirty_constraint_ptrs) {
+            for (auto &&sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                if (incidence_variable_ptr_set.insert(sensitivity.first)
+                        .second) {
+                    incidence_variable_ptrs.push_back(sensitivity.first);
+                }
+            }
+        }
+
+        for (auto &&variable_ptr : incidence_variable_ptrs) {
+            auto &related_constraint_ptrs =
+                variable_ptr->related_constraint_ptrs();
+            related_constraint_ptrs.erase(
+                std::remove_if(related_constraint_ptrs.begin(),
+                               related_constraint_ptrs.end(),
+                               [&dirty_constraint_ptr_set](const auto &a_PTR) {
+                                   return dirty_constraint_ptr_set.find(
+                                              a_PTR) !=
+                                          dirty_constraint_ptr_set.end();
+                               }),
+                related_constraint_ptrs.end());
+        }
+
+        for (auto &&constraint_ptr : dirty_constraint_ptrs) {
+            for (auto &&sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                sensitivity.first->register_related_constraint_ptr(
+                    constraint_ptr);
+            }
+        }
+
+        for (auto &&variable_ptr : incidence_variable_ptrs) {
+            variable_ptr->sort_and_unique_related_constraint_ptrs();
+        }
+
+        /**
+         * Update the columns of the incidence matrix for the dirty
+         * constraints. A new matrix is created if the current one is shared
+         * with forked models.
+         */
+        const auto COMPARE_ID = [](const auto *a_FIRST, const auto *a_SECOND) {
+            return a_FIRST->id() < a_SECOND->id();
+        };
+        std::sort(dirty_constraint_ptrs.begin(), dirty_constraint_ptrs.end(),
+                  COMPARE_ID);
+
+        if (!dirty_constraint_ptrs.empty()) {
+            if (m_incidence_matrix_ptr.use_count() > 1) {
+                m_incidence_matrix_ptr = std::make_shared<
+                    model_component::IncidenceMatrix<T_Variable, T_Expression>>(
+                    *m_incidence_matrix_ptr);
+            }
+            m_incidence_matrix_ptr->update(
+                incidence_variable_ptrs, dirty_constraint_ptrs,
+                m_constraint_reference.constraint_ptrs.size());
+        }
+
+        /**
+         * Update the types of the dirty constraints, the constraints whose
+         * enabled status or senses have been changed, and the constraints
+         * including variables whose bounds, fixed status, or senses have been
+         * changed.
+         */
+        const auto CHANGED_VARIABLE_PTRS =
+            m_structure_dirty_set.changed_variable_ptrs();
+
+        std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+            type_dirty_constraint_ptrs = dirty_constraint_ptrs;
+
+        for (auto &&constraint_ptr :
+             m_structure_dirty_set.changed_constraint_ptrs()) {
+            if (dirty_constraint_ptr_set.insert(constraint_ptr).second) {
+                type_dirty_constraint_ptrs.push_back(constraint_ptr);
+            }
+        }
+
+        for (auto &&variable_ptr : CHANGED_VARIABLE_PTRS) {
+            for (auto &&constraint_ptr :
+                 variable_ptr->related_constraint_ptrs()) {
+                if (dirty_constraint_ptr_set.insert(constraint_ptr).second) {
+                    type_dirty_constraint_ptrs.push_back(constraint_ptr);
+                }
+            }
+        }
+
+        for (auto &&constraint_ptr : type_dirty_constraint_ptrs) {
+            constraint_ptr->update_basic_structure();
+            constraint_ptr->update_constraint_type();
+            for (auto &&sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                if (incidence_variable_ptr_set.insert(sensitivity.first)
+                        .second) {
+                    incidence_variable_ptrs.push_back(sensitivity.first);
+                }
+            }
+        }
+
+        /**
+         * Update the related binary coefficient constraints of the variables
+         * whose related constraints or their types have been changed.
+         */
+        for (auto &&variable_ptr : incidence_variable_ptrs) {
+            variable_ptr->reset_related_binary_coefficient_constraint_ptrs();
+            variable_ptr->setup_related_binary_coefficient_constraint_ptrs();
+        }
+
+        /**
+         * Update the variable and constraint references, and the constraint
+         * state table, only for the changed ones. The variable improvability
+         * table does not have to be updated since the ids of variables are
+         * kept.
+         */
+        this->update_variable_references(CHANGED_VARIABLE_PTRS);
+
+        std::sort(type_dirty_constraint_ptrs.begin(),
+                  type_dirty_constraint_ptrs.end(), COMPARE_ID);
+        this->update_constraint_references(type_dirty_constraint_ptrs);
+
+        for (auto &&constraint_ptr : type_dirty_constraint_ptrs) {
+            m_constraint_state_table.update(constraint_ptr);
+        }
+
+        /**
+         * Update the related expressions of the variables included in the
+         * dirty expressions before and after the modifications, and the
+         * objective sensitivities if the objective has been modified.
+         */
+        this->update_variable_related_expressions();
+
+        if (m_structure_dirty_set.is_objective_dirty) {
+            this->setup_variable_objective_sensitivities();
+        }
+
+        m_structure_dirty_set.update(
+            CHANGED_VARIABLE_PTRS, type_dirty_constraint_ptrs,
+            m_constraint_reference.constraint_ptrs,
+            this->number_of_expressions());
+    }
+
+    /*************************************************************************/
+    inline void update_variable_references(
+        const std::vector<model_component::Variable<T_Variable, T_Expression> *>
+            &a_VARIABLE_PTRS) {
+        /**
+         * NOTE: a_VARIABLE_PTRS must be sorted in ascending order of the ids.
+         */
+        if (a_VARIABLE_PTRS.empty()) {
+            return;
+        }
+
+        model_component::VariableReference<T_Variable, T_Expression>
+            variable_reference;
+        model_component::VariableTypeReference<T_Variable, T_Expression>
+            variable_type_reference;
+
+        for (auto &&variable_ptr : a_VARIABLE_PTRS) {
+            this->categorize_variable(variable_ptr, &variable_reference,
+                                      &variable_type_reference);
+        }
+
+        auto &reference      = m_variable_reference;
+        auto &type_reference = m_variable_type_reference;
+
+        replace_ptrs(&reference.fixed_variable_ptrs, a_VARIABLE_PTRS,
+                     variable_reference.fixed_variable_ptrs);
+        replace_ptrs(&reference.mutable_variable_ptrs, a_VARIABLE_PTRS,
+                     variable_reference.mutable_variable_ptrs);
+
+        replace_ptrs(&type_reference.binary_variable_ptrs, a_VARIABLE_PTRS,
+                     variable_type_reference.binary_variable_ptrs);
+        replace_ptrs(&type_reference.integer_variable_ptrs, a_VARIABLE_PTRS,
+                     variable_type_reference.integer_variable_ptrs);
+        replace_ptrs(&type_reference.selection_variable_ptrs, a_VARIABLE_PTRS,
+                     variable_type_reference.selection_variable_ptrs);
+        replace_ptrs(&type_reference.dependent_binary_variable_ptrs,
+                     a_VARIABLE_PTRS,
+                     variable_type_reference.dependent_binary_variable_ptrs);
+        replace_ptrs(&type_reference.dependent_integer_variable_ptrs,
+                     a_VARIABLE_PTRS,
+                     variable_type_reference.dependent_integer_variable_ptrs);
+    }
+
+    /*************************************************************************/
+    inline void update_constraint_references(
+        const std::vector<
+            model_component::Constraint<T_Variable, T_Expression> *>
+            &a_CONSTRAINT_PTRS) {
+        /**
+         * NOTE: a_CONSTRAINT_PTRS must be sorted in ascending order of the
+         * ids, and have been registered to constraint_ptrs of the constraint
+         * reference.
+         */
+        if (a_CONSTRAINT_PTRS.empty()) {
+            return;
+        }
+
+        model_component::ConstraintReference<T_Variable, T_Expression>
+            constraint_reference;
+        model_component::ConstraintTypeReference<T_Variable, T_Expression>
+            constraint_type_reference;
+
+        for (auto &&constraint_ptr : a_CONSTRAINT_PTRS) {
+            this->categorize_constraint(constraint_ptr, &constraint_reference,
+                                        &constraint_type_reference);
+        }
+
+        auto &reference      = m_constraint_reference;
+        auto &type_reference = m_constraint_type_reference;
+        auto &PTRS           = a_CONSTRAINT_PTRS;
+
+        replace_ptrs(&reference.enabled_constraint_ptrs, PTRS,
+                     constraint_reference.enabled_constraint_ptrs);
+        replace_ptrs(&reference.disabled_constraint_ptrs, PTRS,
+                     constraint_reference.disabled_constraint_ptrs);
+        replace_ptrs(&reference.less_ptrs, PTRS,
+                     constraint_reference.less_ptrs);
+        replace_ptrs(&reference.equal_ptrs, PTRS,
+                     constraint_reference.equal_ptrs);
+        replace_ptrs(&reference.greater_ptrs, PTRS,
+                     constraint_reference.greater_ptrs);
+
+        replace_ptrs(&type_reference.singleton_ptrs, PTRS,
+                     constraint_type_reference.singleton_ptrs);
+        replace_ptrs(&type_reference.exclusive_or_ptrs, PTRS,
+                     constraint_type_reference.exclusive_or_ptrs);
+        replace_ptrs(&type_reference.exclusive_nor_ptrs, PTRS,
+                     constraint_type_reference.exclusive_nor_ptrs);
+        replace_ptrs(&type_reference.inverted_integers_ptrs, PTRS,
+                     constraint_type_reference.inverted_integers_ptrs);
+        replace_ptrs(&type_reference.balanced_integers_ptrs, PTRS,
+                     constraint_type_reference.balanced_integers_ptrs);
+        replace_ptrs(&type_reference.constant_sum_integers_ptrs, PTRS,
+                     constraint_type_reference.constant_sum_integers_ptrs);
+        replace_ptrs(&type_reference.constant_difference_integers_ptrs, PTRS,
+                     constraint_type_reference
+                         .constant_difference_integers_ptrs);
+        replace_ptrs(&type_reference.constant_ratio_integers_ptrs, PTRS,
+                     constraint_type_reference.constant_ratio_integers_ptrs);
+        replace_ptrs(&type_reference.aggregation_ptrs, PTRS,
+                     constraint_type_reference.aggregation_ptrs);
+        replace_ptrs(&type_reference.precedence_ptrs, PTRS,
+                     constraint_type_reference.precedence_ptrs);
+        replace_ptrs(&type_reference.variable_bound_ptrs, PTRS,
+                     constraint_type_reference.variable_bound_ptrs);
+        replace_ptrs(&type_reference.trinomial_exclusive_nor_ptrs, PTRS,
+                     constraint_type_reference.trinomial_exclusive_nor_ptrs);
+        replace_ptrs(&type_reference.set_partitioning_ptrs, PTRS,
+                     constraint_type_reference.set_partitioning_ptrs);
+        replace_ptrs(&type_reference.set_packing_ptrs, PTRS,
+                     constraint_type_reference.set_packing_ptrs);
+        replace_ptrs(&type_reference.set_covering_ptrs, PTRS,
+                     constraint_type_reference.set_covering_ptrs);
+        replace_ptrs(&type_reference.cardinality_ptrs, PTRS,
+                     constraint_type_reference.cardinality_ptrs);
+        replace_ptrs(&type_reference.invariant_knapsack_ptrs, PTRS,
+                     constraint_type_reference.invariant_knapsack_ptrs);
+        replace_ptrs(&type_reference.multiple_covering_ptrs, PTRS,
+                     constraint_type_reference.multiple_covering_ptrs);
+        replace_ptrs(&type_reference.binary_flow_ptrs, PTRS,
+                     constraint_type_reference.binary_flow_ptrs);
+        replace_ptrs(&type_reference.integer_flow_ptrs, PTRS,
+                     constraint_type_reference.integer_flow_ptrs);
+        replace_ptrs(&type_reference.soft_selection_ptrs, PTRS,
+                     constraint_type_reference.soft_selection_ptrs);
+        replace_ptrs(&type_reference.min_max_ptrs, PTRS,
+                     constraint_type_reference.min_max_ptrs);
+        replace_ptrs(&type_reference.max_min_ptrs, PTRS,
+                     constraint_type_reference.max_min_ptrs);
+        replace_ptrs(&type_reference.intermediate_ptrs, PTRS,
+                     constraint_type_reference.intermediate_ptrs);
+        replace_ptrs(&type_reference.equation_knapsack_ptrs, PTRS,
+                     constraint_type_reference.equation_knapsack_ptrs);
+        replace_ptrs(&type_reference.bin_packing_ptrs, PTRS,
+                     constraint_type_reference.bin_packing_ptrs);
+        replace_ptrs(&type_reference.knapsack_ptrs, PTRS,
+                     constraint_type_reference.knapsack_ptrs);
+        replace_ptrs(&type_reference.integer_knapsack_ptrs, PTRS,
+                     constraint_type_reference.integer_knapsack_ptrs);
+        replace_ptrs(&type_reference.gf2_ptrs, PTRS,
+                     constraint_type_reference.gf2_ptrs);
+        replace_ptrs(&type_reference.general_linear_ptrs, PTRS,
+                     constraint_type_reference.general_linear_ptrs);
+    }
+
+    /*************************************************************************/
+    inline void update_variable_related_expressions(void) {
+        /**
+         * This method updates the related expressions only for the variables
+         * included in the dirty expressions before and after the
+         * modifications, and in the expressions created after the last setup.
+         */
+        std::vector<model_component::Expression<T_Variable, T_Expression> *>
+            dirty_expression_ptrs;
+        std::unordered_set<
+            model_component::Expression<T_Variable, T_Expression> *>
+            dirty_expression_ptr_set;
+
+        for (auto &&expression_ptr :
+             m_structure_dirty_set.dirty_expression_ptrs) {
+            if (dirty_expression_ptr_set.insert(expression_ptr).second) {
+                dirty_expression_ptrs.push_back(expression_ptr);
+            }
+        }
+
+        int expression_index = 0;
+        for (auto &&proxy : m_expression_proxies) {
+            for (auto &&expression : proxy.flat_indexed_expressions()) {
+                if (expression_index++ <
+                    m_structure_dirty_set.number_of_expressions) {
+                    continue;
+                }
+                if (dirty_expression_ptr_set.insert(&expression).second) {
+                    dirty_expression_ptrs.push_back(&expression);
+                }
+            }
+        }
+
+        std::vector<model_component::Variable<T_Variable, T_Expression> *>
+            related_variable_ptrs;
+        std::unordered_set<
+            model_component::Variable<T_Variable, T_Expression> *>
+            related_variable_ptr_set;
+
+        for (auto &&variable_ptr :
+             m_structure_dirty_set.dirty_expression_variable_ptrs) {
+            if (related_variable_ptr_set.insert(variable_ptr).second) {
+                related_variable_ptrs.push_back(variable_ptr);
+            }
+        }
+        for (auto &&expression_ptr : dirty_expression_ptrs) {
+            for (auto &&sensitivity : expression_ptr->sensitivities()) {
+                if (related_variable_ptr_set.insert(sensitivity.first)
+                        .second) {
+                    related_variable_ptrs.push_back(sensitivity.first);
+                }
+            }
+        }
+
+        for (auto &&variable_ptr : related_variable_ptrs) {
+            auto &related_expression_ptrs =
+                variable_ptr->related_expression_ptrs();
+            related_expression_ptrs.erase(
+                std::remove_if(related_expression_ptrs.begin(),
+                               related_expression_ptrs.end(),
+                               [&dirty_expression_ptr_set](const auto &a_PTR) {
+                                   return dirty_expression_ptr_set.find(
+                                              a_PTR) !=
+                                          dirty_expression_ptr_set.end();
+                               }),
+                related_expression_ptrs.end());
+        }
+
+        for (auto &&expression_ptr : dirty_expression_ptrs) {
+            for (auto &&sensitivity : expression_ptr->sensitivities()) {
+                sensitivity.first->register_related_expression_ptr(
+                    expression_ptr);
+            }
+        }
+
+        for (auto &&variable_ptr : related_variable_ptrs) {
+            variable_ptr->sort_and_unique_related_expression_ptrs();
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Element>
+    inline static void replace_ptrs(
+        std::vector<T_Element *>       *a_ptrs,
+        const std::vector<T_Element *> &a_REPLACED_PTRS,
+        const std::vector<T_Element *> &a_INSERTED_PTRS) {
+        /**
+         * This method removes the elements in a_REPLACED_PTRS from *a_ptrs and
+         * inserts the elements in a_INSERTED_PTRS, which is a subset of
+         * a_REPLACED_PTRS, keeping the ascending order of the ids. All of them
+         * must be sorted in ascending order of the ids. The elements are
+         * located by binary search, and the others are copied without being
+         * dereferenced.
+         */
+        const auto COMPARE_ID = [](const T_Element *a_FIRST,
+                                   const T_Element *a_SECOND) {
+            return a_FIRST->id() < a_SECOND->id();
+        };
+
+        std::vector<T_Element *> ptrs;
+        ptrs.reserve(a_ptrs->size() + a_INSERTED_PTRS.size());
+
+        auto first       = a_ptrs->begin();
+        auto inserted_it = a_INSERTED_PTRS.begin();
+        for (auto &&replaced_ptr : a_REPLACED_PTRS) {
+            auto position = std::lower_bound(first, a_ptrs->end(),
+                                             replaced_ptr, COMPARE_ID);
+            ptrs.insert(ptrs.end(), first, position);
+            if (position != a_ptrs->end() && *position == replaced_ptr) {
+                position++;
+            }
+            if (inserted_it != a_INSERTED_PTRS.end() &&
+                *inserted_it == replaced_ptr) {
+                ptrs.push_back(replaced_ptr);
+                inserted_it++;
+            }
+            first = position;
+        }
+        ptrs.insert(ptrs.end(), first, a_ptrs->end());
+        *a_ptrs = std::move(ptrs);
+    }
+
+    /*************************************************************************/
+    inline void mark_structure_dirty(
+        model_component::Constraint<T_Variable, T_Expression>
+            *a_constraint_ptr) {
+        /**
+         * NOTE: This method must be called before the expression of the
+         * constraint is modified.
+         */
+        m_structure_dirty_set.register_constraint_ptr(a_constraint_ptr);
+    }
+
+    /*************************************************************************/
+    inline void mark_structure_dirty(
+        model_component::Expression<T_Variable, T_Expression>
+            *a_expression_ptr) {
+        /**
+         * NOTE: This method must be called before the expression, or the
+         * expression of the objective, is modified.
+         */
+        if (a_expression_ptr == &m_objective.expression()) {
+            m_structure_dirty_set.register_objective();
+            return;
+        }
+        m_structure_dirty_set.register_expression_ptr(a_expression_ptr);
     }
 
     /*************************************************************************/
@@ -961,40 +1540,84 @@ class Model {
     }
 
     /*************************************************************************/
-    inline void setup_variable_objective_sensitivities(void) {
-        for (auto &&sensitivity : m_objective.expression().sensitivities()) {
-            sensitivity.first->set_objective_sensitivity(sensitivity.second);
-        }
-    }
-
-    /*************************************************************************/
-    inline void setup_variable_constraint_sensitivities(void) {
+    inline void setup_variable_related_expressions(void) {
         /**
          * NOTE: In this method, m_variable_reference is not referred because
-         * the object may not have been set up at the stage this method is
+         * the object would not be set up at the stage when this method is
          * called.
          */
         for (auto &&proxy : m_variable_proxies) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
-                variable.reset_constraint_sensitivities();
+                variable.reset_related_expression_ptrs();
             }
         }
-        for (auto &&proxy : m_constraint_proxies) {
-            for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                for (auto &&sensitivity :
-                     constraint.expression().sensitivities()) {
-                    sensitivity.first->register_constraint_sensitivity(
-                        &constraint, sensitivity.second);
+
+        for (auto &&proxy : m_expression_proxies) {
+            for (auto &&expression : proxy.flat_indexed_expressions()) {
+                for (auto &&sensitivity : expression.sensitivities()) {
+                    sensitivity.first->register_related_expression_ptr(
+                        &expression);
                 }
             }
         }
+
         for (auto &&proxy : m_variable_proxies) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
-                variable.sort_constraint_sensitivities();
+                variable.sort_and_unique_related_expression_ptrs();
             }
         }
     }
 
+    /*************************************************************************/
+    inline void setup_variable_objective_sensitivities(void) {
+        for (auto &&sensitivity : m_objective.expression().sensitivities()) {
+            sensitivity.first->set_objective_sensitivity(sensitivity.second);
+        }
+    }
+
+    /*************************************************************************/
+    inline void setup_constraint_state_table(void) {
+        /**
+         * NOTE: This method must be called after the constraint
+         * categorization.
+         */
+        m_constraint_state_table.setup(m_constraint_reference.constraint_ptrs);
+    }
+
+    /*************************************************************************/
+    inline void setup_incidence_matrix(void) {
+        /**
+         * NOTE: This method must be called after the setup of the constraint
+         * state table, which assigns the ids of constraints. A new matrix is
+         * created instead of overwriting the current one, which may be shared
+         * with forked models.
+         */
+        auto incidence_matrix_ptr = std::make_shared<
+            model_component::IncidenceMatrix<T_Variable, T_Expression>>();
+        incidence_matrix_ptr->setup(m_variable_reference.variable_ptrs,
+                                    m_constraint_reference.constraint_ptrs);
+        m_incidence_matrix_ptr = std::move(incidence_matrix_ptr);
+    }
+
+    /*************************************************************************/
+    inline void setup_variable_improvability_table(void) {
+        /**
+         * NOTE: This method must be called after the setup of the incidence
+         * matrix, which assigns the ids of variables.
+         */
+        m_variable_improvability_table.setup(
+            m_variable_reference.variable_ptrs);
+    }
+
+    /*************************************************************************/
+    inline bool is_enabled_variable_improvability_table(void) const noexcept {
+        /**
+         * The table is not used if variables have been added after the setup.
+         */
+        return m_variable_improvability_table.number_of_variables() ==
+               static_cast<int>(m_variable_reference.variable_ptrs.size());
+    }
+
     /*************************************************************************/
     inline void setup_variable_related_selection_constraint_ptr_index(void) {
         for (auto &&variable_ptr :
@@ -1028,47 +1651,77 @@ class Model {
         for (auto &&proxy : m_variable_proxies) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
                 variable_reference.variable_ptrs.push_back(&variable);
-                if (variable.is_fixed()) {
-                    variable_reference.fixed_variable_ptrs.push_back(&variable);
-                } else {
-                    variable_reference.mutable_variable_ptrs.push_back(
-                        &variable);
-                }
-                if (variable.sense() ==
-                    model_component::VariableSense::Binary) {
-                    variable_type_reference.binary_variable_ptrs.push_back(
-                        &variable);
-                }
-                if (variable.sense() ==
-                    model_component::VariableSense::Integer) {
-                    variable_type_reference.integer_variable_ptrs.push_back(
-                        &variable);
-                }
-                if (variable.sense() ==
-                    model_component::VariableSense::Selection) {
-                    variable_type_reference.selection_variable_ptrs.push_back(
-                        &variable);
-                }
+                this->categorize_variable(&variable, &variable_reference,
+                                          &variable_type_reference);
+            }
+        }
+        m_variable_reference      = variable_reference;
+        m_variable_type_reference = variable_type_reference;
+    }
 
-                if (variable.sense() ==
-                    model_component::VariableSense::DependentBinary) {
-                    variable_type_reference.dependent_binary_variable_ptrs
-                        .push_back(&variable);
-                }
+    /*************************************************************************/
+    inline static void categorize_variable(
+        model_component::Variable<T_Variable, T_Expression> *a_variable_ptr,
+        model_component::VariableReference<T_Variable, T_Expression>
+            *a_variable_reference_ptr,
+        model_component::VariableTypeReference<T_Variable, T_Expression>
+            *a_variable_type_reference_ptr) {
+        /**
+         * NOTE: This method does not register a_variable_ptr to variable_ptrs
+         * of the variable reference, which includes all variables.
+         */
+        if (a_variable_ptr->is_fixed()) {
+            a_variable_reference_ptr->fixed_variable_ptrs.push_back(
+                a_variable_ptr);
+        } else {
+            a_variable_reference_ptr->mutable_variable_ptrs.push_back(
+                a_variable_ptr);
+        }
+        if (a_variable_ptr->sense() == model_component::VariableSense::Binary) {
+            a_variable_type_reference_ptr->binary_variable_ptrs.push_back(
+                a_variable_ptr);
+        }
+        if (a_variable_ptr->sense() ==
+            model_component::VariableSense::Integer) {
+            a_variable_type_reference_ptr->integer_variable_ptrs.push_back(
+                a_variable_ptr);
+        }
+        if (a_variable_ptr->sense() ==
+            model_component::VariableSense::Selection) {
+            a_variable_type_reference_ptr->selection_variable_ptrs.push_back(
+                a_variable_ptr);
+        }
 
-                if (variable.sense() ==
-                    model_component::VariableSense::DependentInteger) {
-                    variable_type_reference.dependent_integer_variable_ptrs
-                        .push_back(&variable);
-                }
+        if (a_variable_ptr->sense() ==
+            model_component::VariableSense::DependentBinary) {
+            a_variable_type_reference_ptr->dependent_binary_variable_ptrs
+                .push_back(a_variable_ptr);
+        }
+
+        if (a_variable_ptr->sense() ==
+            model_component::VariableSense::DependentInteger) {
+            a_variable_type_reference_ptr->dependent_integer_variable_ptrs
+                .push_back(a_variable_ptr);
+        }
+    }
+
+    /*************************************************************************/
+    inline void categorize_constraints(void) {
+        for (auto &&proxy : m_constraint_proxies) {
+            for (auto &&constraint : proxy.flat_indexed_constraints()) {
+                constraint.update_basic_structure();
+                constraint.update_constraint_type();
             }
         }
-        m_variable_reference      = variable_reference;
-        m_variable_type_reference = variable_type_reference;
+        this->setup_constraint_references();
     }
 
     /*************************************************************************/
-    inline void categorize_constraints(void) {
+    inline void setup_constraint_references(void) {
+        /**
+         * NOTE: This method must be called after the types of constraints are
+         * updated.
+         */
         model_component::ConstraintReference<T_Variable, T_Expression>
             constraint_reference;
         model_component::ConstraintTypeReference<T_Variable, T_Expression>
@@ -1076,166 +1729,176 @@ class Model {
 
         for (auto &&proxy : m_constraint_proxies) {
             for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                constraint.update_basic_structure();
-                constraint.update_constraint_type();
+                constraint_reference.constraint_ptrs.push_back(&constraint);
+                this->categorize_constraint(&constraint, &constraint_reference,
+                                            &constraint_type_reference);
             }
         }
+        m_constraint_reference      = constraint_reference;
+        m_constraint_type_reference = constraint_type_reference;
+    }
 
-        for (auto &&proxy : m_constraint_proxies) {
-            for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                constraint_reference.constraint_ptrs.push_back(&constraint);
-                if (constraint.is_enabled()) {
-                    constraint_reference.enabled_constraint_ptrs.push_back(
-                        &constraint);
-
-                    switch (constraint.sense()) {
-                        case model_component::ConstraintSense::Less: {
-                            constraint_reference.less_ptrs.push_back(
-                                &constraint);
-                            break;
-                        }
-                        case model_component::ConstraintSense::Equal: {
-                            constraint_reference.equal_ptrs.push_back(
-                                &constraint);
-                            break;
-                        }
-                        case model_component::ConstraintSense::Greater: {
-                            constraint_reference.greater_ptrs.push_back(
-                                &constraint);
-                            break;
-                        }
-                        default: {
-                            /** nothing to do*/
-                        }
-                    }
-                } else {
-                    constraint_reference.disabled_constraint_ptrs.push_back(
-                        &constraint);
-                }
-
-                if (constraint.is_singleton()) {
-                    constraint_type_reference.singleton_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_exclusive_or()) {
-                    constraint_type_reference.exclusive_or_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_exclusive_nor()) {
-                    constraint_type_reference.exclusive_nor_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_inverted_integers()) {
-                    constraint_type_reference.inverted_integers_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_balanced_integers()) {
-                    constraint_type_reference.balanced_integers_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_constant_sum_integers()) {
-                    constraint_type_reference.constant_sum_integers_ptrs
-                        .push_back(&constraint);
-                }
-                if (constraint.is_constant_difference_integers()) {
-                    constraint_type_reference.constant_difference_integers_ptrs
-                        .push_back(&constraint);
-                }
-                if (constraint.is_constant_ratio_integers()) {
-                    constraint_type_reference.constant_ratio_integers_ptrs
-                        .push_back(&constraint);
-                }
-                if (constraint.is_aggregation()) {
-                    constraint_type_reference.aggregation_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_precedence()) {
-                    constraint_type_reference.precedence_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_variable_bound()) {
-                    constraint_type_reference.variable_bound_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_trinomial_exclusive_nor()) {
-                    constraint_type_reference.trinomial_exclusive_nor_ptrs
-                        .push_back(&constraint);
-                }
-                if (constraint.is_set_partitioning()) {
-                    constraint_type_reference.set_partitioning_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_set_packing()) {
-                    constraint_type_reference.set_packing_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_set_covering()) {
-                    constraint_type_reference.set_covering_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_cardinality()) {
-                    constraint_type_reference.cardinality_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_invariant_knapsack()) {
-                    constraint_type_reference.invariant_knapsack_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_multiple_covering()) {
-                    constraint_type_reference.multiple_covering_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_binary_flow()) {
-                    constraint_type_reference.binary_flow_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_integer_flow()) {
-                    constraint_type_reference.integer_flow_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_soft_selection()) {
-                    constraint_type_reference.soft_selection_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_min_max()) {
-                    constraint_type_reference.min_max_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_max_min()) {
-                    constraint_type_reference.max_min_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_intermediate()) {
-                    constraint_type_reference.intermediate_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_equation_knapsack()) {
-                    constraint_type_reference.equation_knapsack_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_bin_packing()) {
-                    constraint_type_reference.bin_packing_ptrs.push_back(
-                        &constraint);
-                }
-                if (constraint.is_knapsack()) {
-                    constraint_type_reference.knapsack_ptrs.push_back(
-                        &constraint);
+    /*************************************************************************/
+    inline static void categorize_constraint(
+        model_component::Constraint<T_Variable, T_Expression> *a_constraint_ptr,
+        model_component::ConstraintReference<T_Variable, T_Expression>
+            *a_constraint_reference_ptr,
+        model_component::ConstraintTypeReference<T_Variable, T_Expression>
+            *a_constraint_type_reference_ptr) {
+        /**
+         * NOTE: This method does not register a_constraint_ptr to
+         * constraint_ptrs of the constraint reference, which includes all
+         * constraints.
+         */
+        if (a_constraint_ptr->is_enabled()) {
+            a_constraint_reference_ptr->enabled_constraint_ptrs.push_back(
+                a_constraint_ptr);
+
+            switch (a_constraint_ptr->sense()) {
+                case model_component::ConstraintSense::Less: {
+                    a_constraint_reference_ptr->less_ptrs.push_back(
+                        a_constraint_ptr);
+                    break;
                 }
-                if (constraint.is_integer_knapsack()) {
-                    constraint_type_reference.integer_knapsack_ptrs.push_back(
-                        &constraint);
+                case model_component::ConstraintSense::Equal: {
+                    a_constraint_reference_ptr->equal_ptrs.push_back(
+                        a_constraint_ptr);
+                    break;
                 }
-                if (constraint.is_gf2()) {
-                    constraint_type_reference.gf2_ptrs.push_back(&constraint);
+                case model_component::ConstraintSense::Greater: {
+                    a_constraint_reference_ptr->greater_ptrs.push_back(
+                        a_constraint_ptr);
+                    break;
                 }
-                if (constraint.is_general_linear()) {
-                    constraint_type_reference.general_linear_ptrs.push_back(
-                        &constraint);
+                default: {
+                    /** nothing to do*/
                 }
             }
+        } else {
+            a_constraint_reference_ptr->disabled_constraint_ptrs.push_back(
+                a_constraint_ptr);
+        }
+
+        if (a_constraint_ptr->is_singleton()) {
+            a_constraint_type_reference_ptr->singleton_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_exclusive_or()) {
+            a_constraint_type_reference_ptr->exclusive_or_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_exclusive_nor()) {
+            a_constraint_type_reference_ptr->exclusive_nor_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_inverted_integers()) {
+            a_constraint_type_reference_ptr->inverted_integers_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_balanced_integers()) {
+            a_constraint_type_reference_ptr->balanced_integers_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_constant_sum_integers()) {
+            a_constraint_type_reference_ptr->constant_sum_integers_ptrs
+                .push_back(a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_constant_difference_integers()) {
+            a_constraint_type_reference_ptr->constant_difference_integers_ptrs
+                .push_back(a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_constant_ratio_integers()) {
+            a_constraint_type_reference_ptr->constant_ratio_integers_ptrs
+                .push_back(a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_aggregation()) {
+            a_constraint_type_reference_ptr->aggregation_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_precedence()) {
+            a_constraint_type_reference_ptr->precedence_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_variable_bound()) {
+            a_constraint_type_reference_ptr->variable_bound_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_trinomial_exclusive_nor()) {
+            a_constraint_type_reference_ptr->trinomial_exclusive_nor_ptrs
+                .push_back(a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_set_partitioning()) {
+            a_constraint_type_reference_ptr->set_partitioning_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_set_packing()) {
+            a_constraint_type_reference_ptr->set_packing_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_set_covering()) {
+            a_constraint_type_reference_ptr->set_covering_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_cardinality()) {
+            a_constraint_type_reference_ptr->cardinality_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_invariant_knapsack()) {
+            a_constraint_type_reference_ptr->invariant_knapsack_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_multiple_covering()) {
+            a_constraint_type_reference_ptr->multiple_covering_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_binary_flow()) {
+            a_constraint_type_reference_ptr->binary_flow_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_integer_flow()) {
+            a_constraint_type_reference_ptr->integer_flow_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_soft_selection()) {
+            a_constraint_type_reference_ptr->soft_selection_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_min_max()) {
+            a_constraint_type_reference_ptr->min_max_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_max_min()) {
+            a_constraint_type_reference_ptr->max_min_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_intermediate()) {
+            a_constraint_type_reference_ptr->intermediate_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_equation_knapsack()) {
+            a_constraint_type_reference_ptr->equation_knapsack_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_bin_packing()) {
+            a_constraint_type_reference_ptr->bin_packing_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_knapsack()) {
+            a_constraint_type_reference_ptr->knapsack_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_integer_knapsack()) {
+            a_constraint_type_reference_ptr->integer_knapsack_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_gf2()) {
+            a_constraint_type_reference_ptr->gf2_ptrs.push_back(
+                a_constraint_ptr);
+        }
+        if (a_constraint_ptr->is_general_linear()) {
+            a_constraint_type_reference_ptr->general_linear_ptrs.push_back(
+                a_constraint_ptr);
         }
-        m_constraint_reference      = constraint_reference;
-        m_constraint_type_reference = constraint_type_reference;
     }
 
     /*************************************************************************/
@@ -1343,16 +2006,14 @@ class Model {
             }
         }
 
-        for (auto &&proxy : m_constraint_proxies) {
-            for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                constraint.expression().setup_fixed_sensitivities();
-            }
-        }
         m_objective.expression().setup_fixed_sensitivities();
 
         /**
-         * The fixed sensitivities for the constraints and the objective are
-         * build in their own setup() methods.
+         * The fixed sensitivities are not set up for the expressions of the
+         * constraints, whose values are evaluated and updated through the
+         * columns of the incidence matrix instead. The sensitivities of the
+         * expressions are kept as the representation for modeling and
+         * preprocessing, from which the incidence matrix is built.
          */
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
     }
@@ -1377,6 +2038,302 @@ class Model {
             .setup_positive_and_negative_coefficient_mutable_variable_ptrs();
     }
 
+    /*************************************************************************/
+    inline std::unique_ptr<Model<T_Variable, T_Expression>> fork(
+        const option::Option &a_OPTION) const {
+        /**
+         * This method creates a replica of the model which has been set up.
+         * The incidence matrix, which refers to the variables and constraints
+         * only by their ids, is shared with the replica. The other structures
+         * refer to the components by their addresses, and they are rebuilt
+         * from the presolved structure of this model: the coefficients,
+         * bounds, fixed values, disabled constraints, dependent variables,
+         * and selections are transferred as they are, and only the
+         * pointer-based structures (categorization, sensitivity tables, and
+         * neighborhood) are set up again. The verification, presolving, and
+         * extraction of dependent variables and selections are not performed
+         * for the replica. The values of the variables, the penalty
+         * coefficients of the constraints, and the update counters are also
+         * transferred.
+         *
+         * NOTE: The user-defined neighborhood cannot be forked because it may
+         * capture the components of this model.
+         */
+        if (a_OPTION.neighborhood.is_enabled_user_defined_move) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The model with user-defined neighborhood cannot be forked."));
+        }
+
+        auto model_ptr = std::make_unique<Model<T_Variable, T_Expression>>();
+        auto &model    = *model_ptr;
+
+        model.m_name                       = m_name;
+        model.m_is_defined_objective       = m_is_defined_objective;
+        model.m_is_minimization            = m_is_minimization;
+        model.m_is_solved                  = m_is_solved;
+        model.m_instruction_set            = m_instruction_set;
+        model.m_global_penalty_coefficient = m_global_penalty_coefficient;
+
+        const auto VARIABLE_PTR =
+            [&model](const model_component::Variable<T_Variable, T_Expression>
+                         *a_VARIABLE_PTR) {
+                return &model.m_variable_proxies[a_VARIABLE_PTR->proxy_index()]
+                            .flat_indexed_variables(
+                                a_VARIABLE_PTR->flat_index());
+            };
+
+        const auto CONSTRAINT_PTR =
+            [&model](const model_component::Constraint<T_Variable, T_Expression>
+                         *a_CONSTRAINT_PTR) {
+                return &model
+                            .m_constraint_proxies[a_CONSTRAINT_PTR
+                                                      ->proxy_index()]
+                            .flat_indexed_constraints(
+                                a_CONSTRAINT_PTR->flat_index());
+            };
+
+        const auto EXPRESSION =
+            [&VARIABLE_PTR](const model_component::Expression<
+                            T_Variable, T_Expression> &a_EXPRESSION) {
+                std::unordered_map<
+                    model_component::Variable<T_Variable, T_Expression> *,
+                    T_Expression>
+                    sensitivities;
+                sensitivities.reserve(a_EXPRESSION.sensitivities().size());
+                for (const auto &sensitivity : a_EXPRESSION.sensitivities()) {
+                    sensitivities[VARIABLE_PTR(sensitivity.first)] =
+                        sensitivity.second;
+                }
+                return model_component::Expression<T_Variable, T_Expression>::
+                    create_instance(sensitivities,
+                                    a_EXPRESSION.constant_value());
+            };
+
+        /**
+         * Variables.
+         */
+        const int VARIABLE_PROXIES_SIZE = m_variable_proxies.size();
+        for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
+            const auto &proxy = m_variable_proxies[i];
+            auto       &proxy_fork =
+                model.create_variables(m_variable_names[i], proxy.shape());
+
+            const int NUMBER_OF_ELEMENTS = proxy.number_of_elements();
+            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
+                const auto &variable = proxy.flat_indexed_variables(j);
+                auto &variable_fork  = proxy_fork.flat_indexed_variables(j);
+
+                variable_fork.set_name(variable.name());
+                if (variable.has_bounds()) {
+                    variable_fork.set_bound(variable.lower_bound(),
+                                            variable.upper_bound());
+                }
+                variable_fork.set_value_force(variable.value());
+                if (variable.is_fixed()) {
+                    variable_fork.fix();
+                }
+                variable_fork.set_lagrangian_coefficient(
+                    variable.lagrangian_coefficient());
+                variable_fork.set_local_last_update_iteration(
+                    variable.local_last_update_iteration());
+                variable_fork.set_global_last_update_iteration(
+                    variable.global_last_update_iteration());
+                variable_fork.set_update_count(variable.update_count());
+            }
+        }
+
+        /**
+         * Expressions. The addresses of the expressions are stored to restore
+         * the dependent variables.
+         */
+        std::unordered_map<
+            const model_component::Expression<T_Variable, T_Expression> *,
+            model_component::Expression<T_Variable, T_Expression> *>
+            expression_ptr_map;
+
+        const int EXPRESSION_PROXIES_SIZE = m_expression_proxies.size();
+        for (auto i = 0; i < EXPRESSION_PROXIES_SIZE; i++) {
+            const auto &proxy = m_expression_proxies[i];
+            auto       &proxy_fork =
+                model.create_expressions(m_expression_names[i], proxy.shape());
+
+            const int NUMBER_OF_ELEMENTS = proxy.number_of_elements();
+            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
+                const auto &expression = proxy.flat_indexed_expressions(j);
+                auto &expression_fork  = proxy_fork.flat_indexed_expressions(j);
+
+                expression_fork = EXPRESSION(expression);
+                expression_fork.set_name(expression.name());
+                if (!expression.is_enabled()) {
+                    expression_fork.disable();
+                }
+                expression_ptr_map[&expression] = &expression_fork;
+            }
+        }
+
+        /**
+         * Constraints.
+         */
+        const int CONSTRAINT_PROXIES_SIZE = m_constraint_proxies.size();
+        for (auto i = 0; i < CONSTRAINT_PROXIES_SIZE; i++) {
+            const auto &proxy = m_constraint_proxies[i];
+            auto       &proxy_fork =
+                model.create_constraints(m_constraint_names[i], proxy.shape());
+
+            const int NUMBER_OF_ELEMENTS = proxy.number_of_elements();
+            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
+                const auto &constraint = proxy.flat_indexed_constraints(j);
+                auto &constraint_fork = proxy_fork.flat_indexed_constraints(j);
+
+                constraint_fork =
+                    model_component::Constraint<T_Variable, T_Expression>::
+                        create_instance(EXPRESSION(constraint.expression()),
+                                        constraint.sense());
+                constraint_fork.set_name(constraint.name());
+                if (!constraint.is_enabled()) {
+                    constraint_fork.disable();
+                }
+                constraint_fork.set_is_user_defined_selection(
+                    constraint.is_user_defined_selection());
+
+                constraint_fork.local_penalty_coefficient_less() =
+                    constraint.local_penalty_coefficient_less();
+                constraint_fork.local_penalty_coefficient_greater() =
+                    constraint.local_penalty_coefficient_greater();
+                constraint_fork.global_penalty_coefficient() =
+                    constraint.global_penalty_coefficient();
+                constraint_fork.m_violation_count =
+                    constraint.violation_count();
+            }
+        }
+
+        /**
+         * Objective.
+         */
+        if (m_is_defined_objective) {
+            model.m_objective =
+                model_component::Objective<T_Variable, T_Expression>::
+                    create_instance(EXPRESSION(m_objective.expression()));
+        }
+
+        /**
+         * Dependent variables.
+         */
+        for (const auto &proxy : m_variable_proxies) {
+            for (const auto &variable : proxy.flat_indexed_variables()) {
+                if (variable.dependent_expression_ptr() != nullptr) {
+                    VARIABLE_PTR(&variable)->set_dependent_expression_ptr(
+                        expression_ptr_map.at(
+                            variable.dependent_expression_ptr()));
+                }
+            }
+        }
+
+        for (const auto &item : m_dependent_expression_map) {
+            model.m_dependent_expression_map[VARIABLE_PTR(item.first)] =
+                expression_ptr_map.at(item.second);
+        }
+
+        /**
+         * Selections.
+         */
+        std::vector<model_component::Selection<T_Variable, T_Expression>>
+            selections(m_selections.size());
+        const int SELECTIONS_SIZE = m_selections.size();
+        for (auto i = 0; i < SELECTIONS_SIZE; i++) {
+            const auto &selection      = m_selections[i];
+            auto       &selection_fork = selections[i];
+
+            for (const auto &variable_ptr : selection.variable_ptrs) {
+                selection_fork.variable_ptrs.push_back(
+                    VARIABLE_PTR(variable_ptr));
+            }
+            for (const auto &constraint_ptr :
+                 selection.related_constraint_ptrs) {
+                selection_fork.related_constraint_ptrs.push_back(
+                    CONSTRAINT_PTR(constraint_ptr));
+            }
+            if (selection.selected_variable_ptr != nullptr) {
+                selection_fork.selected_variable_ptr =
+                    VARIABLE_PTR(selection.selected_variable_ptr);
+            }
+            if (selection.constraint_ptr != nullptr) {
+                selection_fork.constraint_ptr =
+                    CONSTRAINT_PTR(selection.constraint_ptr);
+            }
+        }
+        model.set_selections(selections);
+
+        /**
+         * The senses of the variables are overwritten in the above steps, and
+         * they are restored here.
+         */
+        for (const auto &proxy : m_variable_proxies) {
+            for (const auto &variable : proxy.flat_indexed_variables()) {
+                VARIABLE_PTR(&variable)->set_sense(variable.sense());
+            }
+        }
+
+        for (const auto &pair : m_flippable_variable_ptr_pairs) {
+            model.m_flippable_variable_ptr_pairs.emplace_back(
+                VARIABLE_PTR(pair.first), VARIABLE_PTR(pair.second));
+        }
+
+        /**
+         * Set up the derived structures in the same order as
+         * setup_structure(), except that the incidence matrix is shared. The
+         * ids of variables are copied instead of being assigned by the setup
+         * of the incidence matrix, and the ids of constraints are assigned by
+         * the setup of the constraint state table in the same order as this
+         * model.
+         */
+        for (const auto &proxy : m_variable_proxies) {
+            for (const auto &variable : proxy.flat_indexed_variables()) {
+                VARIABLE_PTR(&variable)->set_id(variable.id());
+            }
+        }
+
+        model.categorize_variables();
+        model.categorize_constraints();
+
+        model.setup_variable_related_constraints();
+        model.setup_variable_related_binary_coefficient_constraints();
+        model.setup_variable_related_expressions();
+        model.setup_variable_objective_sensitivities();
+        model.setup_constraint_state_table();
+        model.m_incidence_matrix_ptr = m_incidence_matrix_ptr;
+        model.setup_variable_improvability_table();
+
+        model.m_structure_dirty_set.setup(
+            model.m_variable_reference.variable_ptrs,
+            model.m_constraint_reference.constraint_ptrs,
+            model.number_of_expressions());
+
+        /**
+         * The problem size information before presolving is not transferred.
+         */
+        model.m_variable_reference_original = model.m_variable_reference;
+        model.m_variable_type_reference_original =
+            model.m_variable_type_reference;
+        model.m_constraint_reference_original = model.m_constraint_reference;
+        model.m_constraint_type_reference_original =
+            model.m_constraint_type_reference;
+
+        model.setup_neighborhood(a_OPTION, false);
+        model.setup_fixed_sensitivities(false);
+        model.setup_positive_and_negative_coefficient_mutable_variable_ptrs();
+        model.setup_variable_related_selection_constraint_ptr_index();
+        model.setup_is_integer();
+
+        if (a_OPTION.preprocess.is_enabled_presolve) {
+            model.m_problem_size_reducer.setup(&model);
+        }
+        model.m_problem_size_reducer.set_is_preprocess(false);
+
+        return model_ptr;
+    }
+
     /*************************************************************************/
     inline linear_programming::LinearProgramming export_lp_instance(
         void) const {
@@ -1716,6 +2673,23 @@ class Model {
         m_global_penalty_coefficient = a_GLOBAL_PENALTY_COEFFICIENT;
     }
 
+    /*************************************************************************/
+    inline void set_instruction_set(
+        const utility::simd::InstructionSet a_INSTRUCTION_SET) {
+        /**
+         * An instruction set which is not supported by the CPU falls back to
+         * the detected one.
+         */
+        m_instruction_set = utility::simd::is_supported(a_INSTRUCTION_SET)
+                                ? a_INSTRUCTION_SET
+                                : utility::simd::detect_instruction_set();
+    }
+
+    /*************************************************************************/
+    inline utility::simd::InstructionSet instruction_set(void) const noexcept {
+        return m_instruction_set;
+    }
+
     /*************************************************************************/
     inline double global_penalty_coefficient(void) const noexcept {
         return m_global_penalty_coefficient;
@@ -2358,6 +3332,12 @@ class Model {
             }
         }
 
+        /**
+         * NOTE: The constraint state table is also refreshed here to catch
+         * changes of penalty coefficients and enabled/disabled states.
+         */
+        m_constraint_state_table.update();
+
         if (m_is_defined_objective) {
             m_objective.update();
         }
@@ -2387,9 +3367,50 @@ class Model {
             variable_ptr->update();
         }
 
-        for (auto &&constraint_ptr :
-             m_constraint_reference.disabled_constraint_ptrs) {
-            constraint_ptr->update();
+        for (auto &&constraint_ptr :
+             m_constraint_reference.disabled_constraint_ptrs) {
+            constraint_ptr->update();
+            m_constraint_state_table.update(constraint_ptr);
+        }
+    }
+
+    /*************************************************************************/
+    inline void update_related_expressions(
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE) {
+        /**
+         * Update only the expressions which include the altered variables.
+         * An expression must be updated only once even if it includes two or
+         * more altered variables, since it is updated by the differences of
+         * all the alterations at once.
+         */
+        if (a_MOVE.alterations.size() == 1) {
+            for (auto &&expression_ptr :
+                 a_MOVE.alterations.front().first->related_expression_ptrs()) {
+                if (expression_ptr->is_enabled()) {
+                    expression_ptr->update(a_MOVE);
+                }
+            }
+            return;
+        }
+
+        m_related_expression_ptrs.clear();
+        for (auto &&alteration : a_MOVE.alterations) {
+            m_related_expression_ptrs.insert(
+                m_related_expression_ptrs.end(),
+                alteration.first->related_expression_ptrs().begin(),
+                alteration.first->related_expression_ptrs().end());
+        }
+        std::sort(m_related_expression_ptrs.begin(),
+                  m_related_expression_ptrs.end());
+        m_related_expression_ptrs.erase(
+            std::unique(m_related_expression_ptrs.begin(),
+                        m_related_expression_ptrs.end()),
+            m_related_expression_ptrs.end());
+
+        for (auto &&expression_ptr : m_related_expression_ptrs) {
+            if (expression_ptr->is_enabled()) {
+                expression_ptr->update(a_MOVE);
+            }
         }
     }
 
@@ -2406,27 +3427,20 @@ class Model {
             m_objective.update(a_MOVE);
         }
 
-        if (m_neighborhood.user_defined().is_enabled()) {
-            for (auto &&proxy : m_constraint_proxies) {
-                for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                    if (constraint.is_enabled()) {
-                        constraint.update(a_MOVE);
-                    }
-                }
-            }
-        } else {
-            for (auto &&constraint_ptr : a_MOVE.related_constraint_ptrs) {
-                constraint_ptr->update(a_MOVE);
-            }
-        }
+        /**
+         * NOTE: The constraints to be updated are enumerated from the columns
+         * of the incidence matrix for the altered variables, which coincide
+         * with the related constraints of the move.
+         */
+        const auto &CONSTRAINT_PTRS = m_constraint_reference.constraint_ptrs;
+        this->for_each_related_constraint_value(
+            a_MOVE, [this, &CONSTRAINT_PTRS](const int          a_ID,
+                                             const T_Expression a_VALUE) {
+                CONSTRAINT_PTRS[a_ID]->update_by_constraint_value(a_VALUE);
+                m_constraint_state_table.update(CONSTRAINT_PTRS[a_ID]);
+            });
 
-        for (auto &&proxy : m_expression_proxies) {
-            for (auto &&expression : proxy.flat_indexed_expressions()) {
-                if (expression.is_enabled()) {
-                    expression.update(a_MOVE);
-                }
-            }
-        }
+        this->update_related_expressions(a_MOVE);
 
         for (auto &&alteration : a_MOVE.alterations) {
             alteration.first->set_value_if_mutable(alteration.second);
@@ -2439,6 +3453,37 @@ class Model {
         this->update_violative_constraint_ptrs_and_feasibility();
     }
 
+    /*************************************************************************/
+    inline void update(
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const std::vector<T_Expression> &a_CONSTRAINT_VALUES) {
+        /**
+         * This method is the same as update(a_MOVE) except that the new
+         * values of the related constraints are given by a_CONSTRAINT_VALUES,
+         * which is indexed by the constraint ids. It is intended for moves
+         * which alter many variables at once, for which the values are
+         * accumulated more efficiently through the columns of the incidence
+         * matrix by the caller.
+         */
+        if (m_is_defined_objective) {
+            m_objective.update(a_MOVE);
+        }
+
+        for (auto &&constraint_ptr : a_MOVE.related_constraint_ptrs) {
+            constraint_ptr->update_by_constraint_value(
+                a_CONSTRAINT_VALUES[constraint_ptr->id()]);
+            m_constraint_state_table.update(constraint_ptr);
+        }
+
+        this->update_related_expressions(a_MOVE);
+
+        for (auto &&alteration : a_MOVE.alterations) {
+            alteration.first->set_value_if_mutable(alteration.second);
+        }
+
+        this->update_violative_constraint_ptrs_and_feasibility();
+    }
+
     /*************************************************************************/
     inline void reset_variable_objective_improvabilities(
         const std::vector<model_component::Variable<T_Variable, T_Expression> *>
@@ -2450,6 +3495,10 @@ class Model {
 
     /*************************************************************************/
     inline void reset_variable_objective_improvabilities(void) {
+        if (this->is_enabled_variable_improvability_table()) {
+            m_variable_improvability_table.objective_improvable_bits.reset();
+            return;
+        }
         this->reset_variable_objective_improvabilities(
             this->variable_reference().variable_ptrs);
     }
@@ -2465,8 +3514,9 @@ class Model {
 
     /*************************************************************************/
     inline void reset_variable_feasibility_improvabilities(
-        const std::vector<model_component::Constraint<T_Variable, T_Expression>
-                              *> &a_CONSTRAINT_PTRS) const noexcept {
+        const utility::Span<model_component::Constraint<T_Variable,
+                                                        T_Expression> *>
+            &a_CONSTRAINT_PTRS) const noexcept {
         for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
             if (!constraint_ptr->is_enabled()) {
                 continue;
@@ -2480,10 +3530,28 @@ class Model {
 
     /*************************************************************************/
     inline void reset_variable_feasibility_improvabilities(void) {
+        if (this->is_enabled_variable_improvability_table()) {
+            m_variable_improvability_table.feasibility_improvable_bits.reset();
+            return;
+        }
         this->reset_variable_feasibility_improvabilities(
             this->variable_reference().variable_ptrs);
     }
 
+    /*************************************************************************/
+    inline bool has_objective_improvable_variable(void) const {
+        if (this->is_enabled_variable_improvability_table()) {
+            return m_variable_improvability_table.objective_improvable_bits
+                .any();
+        }
+        for (const auto &variable_ptr : m_variable_reference.variable_ptrs) {
+            if (variable_ptr->is_objective_improvable()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     /*************************************************************************/
     inline void update_variable_objective_improvabilities(void) {
         this->update_variable_objective_improvabilities(
@@ -2514,8 +3582,9 @@ class Model {
 
     /*************************************************************************/
     inline void update_variable_feasibility_improvabilities(
-        const std::vector<model_component::Constraint<T_Variable, T_Expression>
-                              *> &a_CONSTRAINT_PTRS) {
+        const utility::Span<model_component::Constraint<T_Variable,
+                                                        T_Expression> *>
+            &a_CONSTRAINT_PTRS) {
         for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
             if (constraint_ptr->is_feasible()) {
                 continue;
@@ -2596,6 +3665,90 @@ class Model {
         return score;
     }
 
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_related_constraint_value(
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const T_Function &a_FUNCTION) const {
+        /**
+         * This method passes the ids and the new values of the constraints
+         * related to a_MOVE to a_FUNCTION in ascending order of the ids. The
+         * columns of the incidence matrix for the altered variables, each of
+         * which is sorted by the constraint ids, are merged so that every
+         * coefficient is visited exactly once.
+         */
+        const auto &INCIDENCE        = *m_incidence_matrix_ptr;
+        const auto &ALTERATIONS      = a_MOVE.alterations;
+        const int   ALTERATIONS_SIZE = ALTERATIONS.size();
+
+        std::array<int, ModelConstant::MERGE_BUFFER_SIZE> positions_buffer;
+        std::vector<int>                                  positions_heap;
+        int *positions = positions_buffer.data();
+        if (ALTERATIONS_SIZE > ModelConstant::MERGE_BUFFER_SIZE) {
+            positions_heap.resize(ALTERATIONS_SIZE);
+            positions = positions_heap.data();
+        }
+
+        for (auto i = 0; i < ALTERATIONS_SIZE; i++) {
+            positions[i] = INCIDENCE.column_ptrs[ALTERATIONS[i].first->id()];
+        }
+
+        while (true) {
+            int constraint_id = std::numeric_limits<int>::max();
+            for (auto i = 0; i < ALTERATIONS_SIZE; i++) {
+                const int END =
+                    INCIDENCE.column_ptrs[ALTERATIONS[i].first->id() + 1];
+                if (positions[i] < END) {
+                    constraint_id =
+                        std::min(constraint_id,
+                                 INCIDENCE.column_constraint_ids[positions[i]]);
+                }
+            }
+            if (constraint_id == std::numeric_limits<int>::max()) {
+                break;
+            }
+
+            T_Expression constraint_value =
+                m_constraint_state_table.constraint_values[constraint_id];
+            for (auto i = 0; i < ALTERATIONS_SIZE; i++) {
+                const int END =
+                    INCIDENCE.column_ptrs[ALTERATIONS[i].first->id() + 1];
+                if (positions[i] < END &&
+                    INCIDENCE.column_constraint_ids[positions[i]] ==
+                        constraint_id) {
+                    constraint_value +=
+                        INCIDENCE.column_coefficients[positions[i]] *
+                        (ALTERATIONS[i].second -
+                         ALTERATIONS[i].first->value());
+                    positions[i]++;
+                }
+            }
+            a_FUNCTION(constraint_id, constraint_value);
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_constraint_sensitivity(
+        const model_component::Variable<T_Variable, T_Expression>
+                         *a_VARIABLE_PTR,
+        const T_Function &a_FUNCTION) const {
+        /**
+         * This method passes the constraints including a_VARIABLE_PTR and
+         * their coefficients of the variable to a_FUNCTION in ascending order
+         * of the ids of the constraints, by scanning the column of the
+         * incidence matrix.
+         */
+        const auto &INCIDENCE = *m_incidence_matrix_ptr;
+        const int   ID        = a_VARIABLE_PTR->id();
+        const int   END       = INCIDENCE.column_ptrs[ID + 1];
+        for (auto i = INCIDENCE.column_ptrs[ID]; i < END; i++) {
+            a_FUNCTION(m_constraint_reference
+                           .constraint_ptrs[INCIDENCE.column_constraint_ids[i]],
+                       INCIDENCE.column_coefficients[i]);
+        }
+    }
+
     /*************************************************************************/
     inline void evaluate(solution::SolutionScore *a_score_ptr,  //
                          const neighborhood::Move<T_Variable, T_Expression>
@@ -2606,17 +3759,40 @@ class Model {
         const int CONSTRAINT_PROXIES_SIZE   = m_constraint_proxies.size();
         bool      is_feasibility_improvable = false;
 
+        /**
+         * The new values of the constraints related to a_MOVE are computed
+         * through the columns of the incidence matrix, and the current values
+         * are used for the others. Since both the related constraints and the
+         * constraint proxies are traversed in ascending order of the ids, the
+         * new values are looked up by a cursor.
+         */
+        std::vector<std::pair<int, T_Expression>> related_constraint_values;
+        if (!a_MOVE.alterations.empty()) {
+            this->for_each_related_constraint_value(
+                a_MOVE, [&related_constraint_values](
+                            const int a_ID, const T_Expression a_VALUE) {
+                    related_constraint_values.emplace_back(a_ID, a_VALUE);
+                });
+        }
+        auto related_constraint_value_it = related_constraint_values.begin();
+
         for (auto i = 0; i < CONSTRAINT_PROXIES_SIZE; i++) {
             auto &constraints =
                 m_constraint_proxies[i].flat_indexed_constraints();
 
             const int CONSTRAINTS_SIZE = constraints.size();
             for (auto j = 0; j < CONSTRAINTS_SIZE; j++) {
+                double constraint_value = constraints[j].constraint_value();
+                if (related_constraint_value_it !=
+                        related_constraint_values.end() &&
+                    related_constraint_value_it->first ==
+                        constraints[j].id()) {
+                    constraint_value = related_constraint_value_it->second;
+                    related_constraint_value_it++;
+                }
                 if (!constraints[j].is_enabled()) {
                     continue;
                 }
-                double constraint_value =
-                    constraints[j].evaluate_constraint(a_MOVE);
                 double positive_part = std::max(constraint_value, 0.0);
                 double negative_part = std::max(-constraint_value, 0.0);
                 double violation     = 0.0;
@@ -2671,49 +3847,65 @@ class Model {
     }
 
     /*************************************************************************/
-    inline void evaluate_single(
-        solution::SolutionScore                            *a_score_ptr,  //
-        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
-        const solution::SolutionScore &a_CURRENT_SCORE) const noexcept {
-        double total_violation  = a_CURRENT_SCORE.total_violation;
-        double local_penalty    = a_CURRENT_SCORE.local_penalty;
-        double constraint_value = 0.0;
-        double violation_diff   = 0.0;
+    inline void compute_violation_diff_single(
+        double *a_total_violation_diff_ptr,  //
+        double *a_local_penalty_diff_ptr,    //
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE)
+        const noexcept {
+        *a_total_violation_diff_ptr = 0.0;
+        *a_local_penalty_diff_ptr   = 0.0;
 
         const auto &variable_ptr = a_MOVE.alterations.front().first;
         const auto  variable_value_diff =
             a_MOVE.alterations.front().second - variable_ptr->value();
-        const auto &constraint_sensitivities =
-            variable_ptr->constraint_sensitivities();
 
-        for (const auto &sensitivity : constraint_sensitivities) {
-            const auto &constraint_ptr = sensitivity.first;
-            if (constraint_ptr->is_evaluation_ignorable()) {
-                continue;
-            }
-            constraint_value = constraint_ptr->constraint_value() +
-                               sensitivity.second * variable_value_diff;
+        const auto &INCIDENCE   = *m_incidence_matrix_ptr;
+        const int   VARIABLE_ID = variable_ptr->id();
+        const int   BEGIN       = INCIDENCE.column_ptrs[VARIABLE_ID];
+        const int   END         = INCIDENCE.column_ptrs[VARIABLE_ID + 1];
 
-            if (constraint_ptr->is_less_or_equal()) {
-                total_violation +=
-                    (violation_diff = std::max(constraint_value, 0.0) -
-                                      constraint_ptr->positive_part());
+        /**
+         * The differences of the violation and the local penalty are computed
+         * by the SIMD kernel selected at runtime, or by the scalar one.
+         */
+        m_constraint_state_table.accumulate_violation_diff(
+            a_total_violation_diff_ptr, a_local_penalty_diff_ptr,
+            INCIDENCE.column_constraint_ids.data() + BEGIN,
+            INCIDENCE.column_coefficients.data() + BEGIN, END - BEGIN,
+            variable_value_diff, m_instruction_set);
+    }
 
-                local_penalty +=
-                    violation_diff *
-                    constraint_ptr->local_penalty_coefficient_less();
-            }
+    /*************************************************************************/
+    inline void evaluate_single(
+        solution::SolutionScore                            *a_score_ptr,  //
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const solution::SolutionScore &a_CURRENT_SCORE) const noexcept {
+        double total_violation_diff = 0.0;
+        double local_penalty_diff   = 0.0;
 
-            if (constraint_ptr->is_greater_or_equal()) {
-                total_violation -=
-                    (violation_diff = std::min(constraint_value, 0.0) +
-                                      constraint_ptr->negative_part());
+        this->compute_violation_diff_single(&total_violation_diff,
+                                            &local_penalty_diff, a_MOVE);
+        this->evaluate_single(a_score_ptr, a_MOVE, a_CURRENT_SCORE,
+                              total_violation_diff, local_penalty_diff);
+    }
 
-                local_penalty -=
-                    violation_diff *
-                    constraint_ptr->local_penalty_coefficient_greater();
-            }
-        }
+    /*************************************************************************/
+    inline void evaluate_single(
+        solution::SolutionScore                            *a_score_ptr,  //
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const solution::SolutionScore &a_CURRENT_SCORE,
+        const double                   a_TOTAL_VIOLATION_DIFF,
+        const double a_LOCAL_PENALTY_DIFF) const noexcept {
+        /**
+         * NOTE: This method assembles the score of a univariable move from the
+         * differences of the violation and the local penalty which have been
+         * computed by compute_violation_diff_single() in advance, possibly in
+         * earlier iterations.
+         */
+        const double TOTAL_VIOLATION =
+            a_CURRENT_SCORE.total_violation + a_TOTAL_VIOLATION_DIFF;
+        const double LOCAL_PENALTY =
+            a_CURRENT_SCORE.local_penalty + a_LOCAL_PENALTY_DIFF;
 
         const double OBJECTIVE =
             m_is_defined_objective ? m_objective.evaluate(a_MOVE) * this->sign()
@@ -2723,16 +3915,16 @@ class Model {
             m_objective.value() * this->sign() - OBJECTIVE;
 
         const double GLOBAL_PENALTY =
-            total_violation * m_global_penalty_coefficient;
+            TOTAL_VIOLATION * m_global_penalty_coefficient;
 
         a_score_ptr->objective                  = OBJECTIVE;
         a_score_ptr->objective_improvement      = OBJECTIVE_IMPROVEMENT;
-        a_score_ptr->total_violation            = total_violation;
-        a_score_ptr->local_penalty              = local_penalty;
+        a_score_ptr->total_violation            = TOTAL_VIOLATION;
+        a_score_ptr->local_penalty              = LOCAL_PENALTY;
         a_score_ptr->global_penalty             = GLOBAL_PENALTY;
-        a_score_ptr->local_augmented_objective  = OBJECTIVE + local_penalty;
+        a_score_ptr->local_augmented_objective  = OBJECTIVE + LOCAL_PENALTY;
         a_score_ptr->global_augmented_objective = OBJECTIVE + GLOBAL_PENALTY;
-        a_score_ptr->is_feasible = !(total_violation > constant::EPSILON);
+        a_score_ptr->is_feasible = !(TOTAL_VIOLATION > constant::EPSILON);
         a_score_ptr->is_objective_improvable =
             OBJECTIVE_IMPROVEMENT > constant::EPSILON;
         a_score_ptr->is_feasibility_improvable = true;  /// do not care.
@@ -2751,10 +3943,14 @@ class Model {
         const auto &variable_ptr = a_MOVE.alterations.front().first;
         const auto  variable_value_diff =
             a_MOVE.alterations.front().second - variable_ptr->value();
-        const auto &constraint_sensitivities =
-            variable_ptr->constraint_sensitivities();
 
-        for (const auto &sensitivity : constraint_sensitivities) {
+        const auto &STATE       = m_constraint_state_table;
+        const auto &INCIDENCE   = *m_incidence_matrix_ptr;
+        const int   VARIABLE_ID = variable_ptr->id();
+        const int   BEGIN       = INCIDENCE.column_ptrs[VARIABLE_ID];
+        const int   END         = INCIDENCE.column_ptrs[VARIABLE_ID + 1];
+
+        for (auto i = BEGIN; i < END; i++) {
             /**
              * NOTE: The difference from evaluate_single() is that this method
              * does not skip the evaluation of constraint function values based
@@ -2764,31 +3960,30 @@ class Model {
              * For such combined moves,constraint_ptr->is_evaluation_ignorable()
              * does not function correctly.
              */
-            const auto &constraint_ptr = sensitivity.first;
-            if (!constraint_ptr->is_enabled()) {
+            const auto ID = INCIDENCE.column_constraint_ids[i];
+            if (!STATE.is_enabled(ID)) {
                 continue;
             }
-            constraint_value = constraint_ptr->constraint_value() +
-                               sensitivity.second * variable_value_diff;
+            constraint_value =
+                STATE.constraint_values[ID] +
+                INCIDENCE.column_coefficients[i] * variable_value_diff;
 
-            if (constraint_ptr->is_less_or_equal()) {
+            if (STATE.is_less_or_equal(ID)) {
                 total_violation +=
                     (violation_diff = std::max(constraint_value, 0.0) -
-                                      constraint_ptr->positive_part());
+                                      STATE.positive_parts[ID]);
 
                 local_penalty +=
-                    violation_diff *
-                    constraint_ptr->local_penalty_coefficient_less();
+                    violation_diff * STATE.local_penalty_coefficients_less[ID];
             }
 
-            if (constraint_ptr->is_greater_or_equal()) {
+            if (STATE.is_greater_or_equal(ID)) {
                 total_violation -=
                     (violation_diff = std::min(constraint_value, 0.0) +
-                                      constraint_ptr->negative_part());
+                                      STATE.negative_parts[ID]);
 
-                local_penalty -=
-                    violation_diff *
-                    constraint_ptr->local_penalty_coefficient_greater();
+                local_penalty -= violation_diff *
+                                 STATE.local_penalty_coefficients_greater[ID];
             }
         }
 
@@ -2827,9 +4022,8 @@ class Model {
         double constraint_value = 0.0;
         double violation_diff   = 0.0;
 
-        const auto &RELATED_CONSTRAINT_PTRS = a_MOVE.alterations.front()
-                                                  .first->selection_ptr()
-                                                  ->related_constraint_ptrs;
+        const auto &STATE     = m_constraint_state_table;
+        const auto &INCIDENCE = *m_incidence_matrix_ptr;
 
         const auto &INDEX_MIN_FIRST =
             a_MOVE.alterations[0]
@@ -2868,86 +4062,53 @@ class Model {
                     const auto &variable_ptr = alteration.first;
                     const auto  variable_value_diff =
                         alteration.second - variable_ptr->value();
-                    const auto &constraint_sensitivities =
-                        variable_ptr->constraint_sensitivities();
+                    const int VARIABLE_ID = variable_ptr->id();
+                    const int BEGIN = INCIDENCE.column_ptrs[VARIABLE_ID];
+                    const int END   = INCIDENCE.column_ptrs[VARIABLE_ID + 1];
 
-                    for (const auto &sensitivity : constraint_sensitivities) {
-                        const auto &constraint_ptr = sensitivity.first;
-                        if (!constraint_ptr->is_enabled()) {
+                    for (auto j = BEGIN; j < END; j++) {
+                        const auto ID = INCIDENCE.column_constraint_ids[j];
+                        if (!STATE.is_enabled(ID)) {
                             continue;
                         }
-                        constraint_value =
-                            constraint_ptr->constraint_value() +
-                            sensitivity.second * variable_value_diff;
+                        constraint_value = STATE.constraint_values[ID] +
+                                           INCIDENCE.column_coefficients[j] *
+                                               variable_value_diff;
 
-                        if (constraint_ptr->is_less_or_equal()) {
+                        if (STATE.is_less_or_equal(ID)) {
                             total_violation +=
                                 (violation_diff =
                                      std::max(constraint_value, 0.0) -
-                                     constraint_ptr->positive_part());
+                                     STATE.positive_parts[ID]);
 
                             local_penalty +=
                                 violation_diff *
-                                constraint_ptr
-                                    ->local_penalty_coefficient_less();
+                                STATE.local_penalty_coefficients_less[ID];
                         }
 
-                        if (constraint_ptr->is_greater_or_equal()) {
+                        if (STATE.is_greater_or_equal(ID)) {
                             total_violation -=
                                 (violation_diff =
                                      std::min(constraint_value, 0.0) +
-                                     constraint_ptr->negative_part());
+                                     STATE.negative_parts[ID]);
 
                             local_penalty -=
                                 violation_diff *
-                                constraint_ptr
-                                    ->local_penalty_coefficient_greater();
+                                STATE.local_penalty_coefficients_greater[ID];
                         }
                     }
                 }
                 is_feasibility_improvable = true;
             } else {
-                double violation_diff_negative = 0.0;
-                double violation_diff_positive = 0.0;
-
-                for (auto i = index_min; i <= index_max; i++) {
-                    auto &constraint_ptr = RELATED_CONSTRAINT_PTRS[i];
-                    if (!constraint_ptr->is_enabled()) {
-                        continue;
-                    }
-
-                    constraint_value =
-                        constraint_ptr->evaluate_constraint(a_MOVE);
-
-                    if (std::fabs(constraint_value -
-                                  constraint_ptr->constraint_value()) <
-                        constant::EPSILON_10) {
-                        continue;
-                    }
-
-                    violation_diff_positive =
-                        constraint_ptr->is_less_or_equal()
-                            ? std::max(constraint_value, 0.0) -
-                                  constraint_ptr->positive_part()
-                            : 0.0;
-
-                    violation_diff_negative =
-                        constraint_ptr->is_greater_or_equal()
-                            ? std::max(-constraint_value, 0.0) -
-                                  constraint_ptr->negative_part()
-                            : 0.0;
-                    violation_diff =
-                        violation_diff_positive + violation_diff_negative;
-                    local_penalty +=
-                        violation_diff_positive *
-                            constraint_ptr->local_penalty_coefficient_less() +
-                        violation_diff_negative *
-                            constraint_ptr->local_penalty_coefficient_greater();
-
-                    total_violation += violation_diff;
-                    is_feasibility_improvable |=
-                        violation_diff < -constant::EPSILON;
-                }
+                this->for_each_related_constraint_value(
+                    a_MOVE,
+                    [this, &total_violation, &local_penalty,
+                     &is_feasibility_improvable](const int          a_ID,
+                                                 const T_Expression a_VALUE) {
+                        this->accumulate_violation_diff(
+                            &total_violation, &local_penalty,
+                            &is_feasibility_improvable, a_ID, a_VALUE);
+                    });
             }
         }
 
@@ -2975,52 +4136,65 @@ class Model {
     }
 
     /*************************************************************************/
-    inline void evaluate_multi(
-        solution::SolutionScore                            *a_score_ptr,  //
-        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
-        const solution::SolutionScore &a_CURRENT_SCORE) const noexcept {
-        bool is_feasibility_improvable = false;
+    inline void accumulate_violation_diff(double *a_total_violation_ptr,  //
+                                          double *a_local_penalty_ptr,    //
+                                          bool *a_is_feasibility_improvable_ptr,
+                                          const int    a_ID,
+                                          const double a_CONSTRAINT_VALUE)
+        const noexcept {
+        const auto &STATE = m_constraint_state_table;
+        if (!STATE.is_enabled(a_ID)) {
+            return;
+        }
 
-        double total_violation         = a_CURRENT_SCORE.total_violation;
-        double local_penalty           = a_CURRENT_SCORE.local_penalty;
-        double constraint_value        = 0.0;
-        double violation_diff_negative = 0.0;
-        double violation_diff_positive = 0.0;
-        double violation_diff          = 0.0;
+        if (std::fabs(a_CONSTRAINT_VALUE - STATE.constraint_values[a_ID]) <
+            constant::EPSILON_10) {
+            return;
+        }
 
-        for (const auto &constraint_ptr : a_MOVE.related_constraint_ptrs) {
-            if (!constraint_ptr->is_enabled()) {
-                continue;
-            }
+        const double VIOLATION_DIFF_POSITIVE =
+            STATE.is_less_or_equal(a_ID)
+                ? std::max(a_CONSTRAINT_VALUE, 0.0) - STATE.positive_parts[a_ID]
+                : 0.0;
 
-            constraint_value = constraint_ptr->evaluate_constraint(a_MOVE);
+        const double VIOLATION_DIFF_NEGATIVE =
+            STATE.is_greater_or_equal(a_ID)
+                ? std::max(-a_CONSTRAINT_VALUE, 0.0) -
+                      STATE.negative_parts[a_ID]
+                : 0.0;
 
-            if (std::fabs(constraint_value -
-                          constraint_ptr->constraint_value()) <
-                constant::EPSILON_10) {
-                continue;
-            }
+        const double VIOLATION_DIFF =
+            VIOLATION_DIFF_POSITIVE + VIOLATION_DIFF_NEGATIVE;
 
-            violation_diff_positive = constraint_ptr->is_less_or_equal()
-                                          ? std::max(constraint_value, 0.0) -
-                                                constraint_ptr->positive_part()
-                                          : 0.0;
+        *a_local_penalty_ptr +=
+            VIOLATION_DIFF_POSITIVE *
+                STATE.local_penalty_coefficients_less[a_ID] +
+            VIOLATION_DIFF_NEGATIVE *
+                STATE.local_penalty_coefficients_greater[a_ID];
+        *a_total_violation_ptr += VIOLATION_DIFF;
+        *a_is_feasibility_improvable_ptr |=
+            VIOLATION_DIFF < -constant::EPSILON;
+    }
 
-            violation_diff_negative = constraint_ptr->is_greater_or_equal()
-                                          ? std::max(-constraint_value, 0.0) -
-                                                constraint_ptr->negative_part()
-                                          : 0.0;
+    /*************************************************************************/
+    inline void evaluate_multi(
+        solution::SolutionScore                            *a_score_ptr,  //
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const solution::SolutionScore &a_CURRENT_SCORE) const noexcept {
+        bool is_feasibility_improvable = false;
 
-            violation_diff = violation_diff_positive + violation_diff_negative;
-            local_penalty +=
-                violation_diff_positive *
-                    constraint_ptr->local_penalty_coefficient_less() +
-                violation_diff_negative *
-                    constraint_ptr->local_penalty_coefficient_greater();
+        double total_violation = a_CURRENT_SCORE.total_violation;
+        double local_penalty   = a_CURRENT_SCORE.local_penalty;
 
-            total_violation += violation_diff;
-            is_feasibility_improvable |= violation_diff < -constant::EPSILON;
-        }
+        this->for_each_related_constraint_value(
+            a_MOVE, [this, &total_violation, &local_penalty,
+                     &is_feasibility_improvable](const int          a_ID,
+                                                 const T_Expression a_VALUE) {
+                this->accumulate_violation_diff(&total_violation,
+                                                &local_penalty,
+                                                &is_feasibility_improvable,
+                                                a_ID, a_VALUE);
+            });
 
         const double OBJECTIVE =
             m_is_defined_objective ? m_objective.evaluate(a_MOVE) * this->sign()
@@ -3302,6 +4476,98 @@ class Model {
         return solution;
     }
 
+    /*************************************************************************/
+    inline solution::IndexedSparseSolution<T_Variable, T_Expression>
+    export_indexed_sparse_solution(void) const {
+        /**
+         * NOTE: This method must be called after the ids of variables are
+         * assigned. The nonzero variables are stored in ascending order of
+         * the ids.
+         */
+        solution::IndexedSparseSolution<T_Variable, T_Expression> solution;
+
+        /// Decision variables
+        const auto &VARIABLE_PTRS  = m_variable_reference.variable_ptrs;
+        const int   VARIABLES_SIZE = VARIABLE_PTRS.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto VALUE = VARIABLE_PTRS[i]->value();
+            if (VALUE != 0) {
+                solution.variable_ids.push_back(i);
+                solution.variable_values.push_back(VALUE);
+            }
+        }
+
+        /// Total violation
+        T_Expression total_violation = 0;
+        for (const auto &proxy : m_constraint_proxies) {
+            for (const auto &constraint : proxy.flat_indexed_constraints()) {
+                total_violation += constraint.violation_value();
+            }
+        }
+
+        solution.objective       = m_objective.value();
+        solution.total_violation = total_violation;
+        solution.global_augmented_objective =
+            solution.objective + m_global_penalty_coefficient * total_violation;
+        solution.is_feasible = this->is_feasible();
+
+        return solution;
+    }
+
+    /*************************************************************************/
+    inline solution::IndexedSparseSolution<T_Variable, T_Expression>
+    export_indexed_sparse_solution(
+        const solution::DenseSolution<T_Variable, T_Expression> &a_SOLUTION)
+        const {
+        solution::IndexedSparseSolution<T_Variable, T_Expression> solution;
+
+        /// Decision variables
+        const auto &VARIABLE_PTRS  = m_variable_reference.variable_ptrs;
+        const int   VARIABLES_SIZE = VARIABLE_PTRS.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto VALUE =
+                a_SOLUTION
+                    .variable_value_proxies[VARIABLE_PTRS[i]->proxy_index()]
+                    .flat_indexed_values(VARIABLE_PTRS[i]->flat_index());
+            if (VALUE != 0) {
+                solution.variable_ids.push_back(i);
+                solution.variable_values.push_back(VALUE);
+            }
+        }
+
+        solution.objective       = a_SOLUTION.objective;
+        solution.total_violation = a_SOLUTION.total_violation;
+        solution.global_augmented_objective =
+            a_SOLUTION.global_augmented_objective;
+        solution.is_feasible = a_SOLUTION.is_feasible;
+
+        return solution;
+    }
+
+    /*************************************************************************/
+    inline solution::SparseSolution<T_Variable, T_Expression>
+    export_sparse_solution(
+        const solution::IndexedSparseSolution<T_Variable, T_Expression>
+            &a_SOLUTION) const {
+        solution::SparseSolution<T_Variable, T_Expression> solution;
+
+        /// Decision variables
+        const auto &VARIABLE_PTRS = m_variable_reference.variable_ptrs;
+        const int   NONZEROS_SIZE = a_SOLUTION.variable_ids.size();
+        for (auto i = 0; i < NONZEROS_SIZE; i++) {
+            solution.variables[VARIABLE_PTRS[a_SOLUTION.variable_ids[i]]
+                                   ->name()] = a_SOLUTION.variable_values[i];
+        }
+
+        solution.objective       = a_SOLUTION.objective;
+        solution.total_violation = a_SOLUTION.total_violation;
+        solution.global_augmented_objective =
+            a_SOLUTION.global_augmented_objective;
+        solution.is_feasible = a_SOLUTION.is_feasible;
+
+        return solution;
+    }
+
     /*************************************************************************/
     inline solution::NamedSolution<T_Variable, T_Expression>
     export_named_solution(void) const {
@@ -3534,28 +4800,42 @@ class Model {
 
     /*********************************************************************/
     void import_mps(const mps::MPS &a_MPS, const bool a_ACCEPT_CONTINUOUS) {
-        using VariableMap = std::unordered_map<
-            std::string, model_component::Variable<T_Variable, T_Expression> *>;
+        this->import_mps_instance(mps::MPSAccessor(a_MPS),
+                                  a_ACCEPT_CONTINUOUS);
+    }
+
+    /*********************************************************************/
+    void import_mps_snapshot(const mps::MPSSnapshot &a_SNAPSHOT,
+                             const bool              a_ACCEPT_CONTINUOUS) {
+        this->import_mps_instance(a_SNAPSHOT, a_ACCEPT_CONTINUOUS);
+    }
+
+    /*********************************************************************/
+    template <class T_Accessor>
+    void import_mps_instance(const T_Accessor &a_ACCESSOR,
+                             const bool        a_ACCEPT_CONTINUOUS) {
+        /**
+         * The accessor is either mps::MPSAccessor or mps::MPSSnapshot. Both
+         * of them refer to the variables and the constraints by their
+         * indices.
+         */
         using Sensitivities = std::unordered_map<
             model_component::Variable<T_Variable, T_Expression> *,
             T_Expression>;
 
-        VariableMap variable_ptrs;
-        m_is_minimization = a_MPS.objective.is_minimization;
-
-        auto &variable_proxy =
-            this->create_variables("variables", a_MPS.variables.size());
+        m_is_minimization = a_ACCESSOR.is_minimization();
 
         /**
          * Set up variables.
          */
-        const int NUMBER_OF_VARIABLES = a_MPS.variable_names.size();
+        const int NUMBER_OF_VARIABLES = a_ACCESSOR.number_of_variables();
+        auto     &variable_proxy =
+            this->create_variables("variables", NUMBER_OF_VARIABLES);
 
         for (auto i = 0; i < NUMBER_OF_VARIABLES; i++) {
-            const auto &VARIABLE_NAME = a_MPS.variable_names[i];
-            const auto &VARIABLE      = a_MPS.variables.at(VARIABLE_NAME);
-
-            if (VARIABLE.sense == mps::MPSVariableSense::Continuous) {
+            const std::string VARIABLE_NAME(a_ACCESSOR.variable_name(i));
+            if (a_ACCESSOR.variable_sense(i) ==
+                mps::MPSVariableSense::Continuous) {
                 if (a_ACCEPT_CONTINUOUS) {
                     utility::print_warning(
                         "The continuous variable " + VARIABLE_NAME +
@@ -3568,21 +4848,20 @@ class Model {
                 }
             }
 
-            variable_proxy(i).set_bound(VARIABLE.integer_lower_bound,
-                                        VARIABLE.integer_upper_bound);
+            variable_proxy(i).set_bound(a_ACCESSOR.variable_lower_bound(i),
+                                        a_ACCESSOR.variable_upper_bound(i));
 
-            if (VARIABLE.is_fixed) {
-                variable_proxy(i).fix_by(VARIABLE.integer_fixed_value);
+            if (a_ACCESSOR.variable_is_fixed(i)) {
+                variable_proxy(i).fix_by(a_ACCESSOR.variable_fixed_value(i));
             }
 
             variable_proxy(i).set_name(VARIABLE_NAME);
-            variable_ptrs[VARIABLE_NAME] = &variable_proxy(i);
         }
 
         /**
          * Set up constraints.
          */
-        const int NUMBER_OF_CONSTRAINTS = a_MPS.constraint_names.size();
+        const int NUMBER_OF_CONSTRAINTS = a_ACCESSOR.number_of_constraints();
         auto     &constraint_proxy =
             this->create_constraints("constraints", NUMBER_OF_CONSTRAINTS);
 
@@ -3590,39 +4869,38 @@ class Model {
 #pragma omp parallel for schedule(static)
 #endif
         for (auto i = 0; i < NUMBER_OF_CONSTRAINTS; i++) {
-            const auto &CONSTRAINT_NAME = a_MPS.constraint_names[i];
-            const auto &CONSTRAINT      = a_MPS.constraints.at(CONSTRAINT_NAME);
-            auto        expression =
+            auto expression =
                 model_component::Expression<T_Variable,
                                             T_Expression>::create_instance();
 
             Sensitivities expression_sensitivities;
-            for (const auto &sensitivity : CONSTRAINT.sensitivities) {
-                const auto        &VARIABLE_NAME = sensitivity.first;
-                const T_Expression COEFFICIENT =
-                    static_cast<T_Expression>(sensitivity.second);
-                expression_sensitivities[variable_ptrs[VARIABLE_NAME]] =
-                    COEFFICIENT;
-            }
+            a_ACCESSOR.for_each_constraint_coefficient(
+                i, [&expression_sensitivities, &variable_proxy](
+                       const int a_COLUMN_ID, const double a_VALUE) {
+                    expression_sensitivities[&variable_proxy(a_COLUMN_ID)] =
+                        static_cast<T_Expression>(a_VALUE);
+                });
             expression.set_sensitivities(expression_sensitivities);
 
-            switch (CONSTRAINT.sense) {
+            const double RHS = a_ACCESSOR.constraint_rhs(i);
+            switch (a_ACCESSOR.constraint_sense(i)) {
                 case mps::MPSConstraintSense::Less: {
-                    constraint_proxy(i) = (expression <= CONSTRAINT.rhs);
+                    constraint_proxy(i) = (expression <= RHS);
                     break;
                 }
 
                 case mps::MPSConstraintSense::Equal: {
-                    constraint_proxy(i) = (expression == CONSTRAINT.rhs);
+                    constraint_proxy(i) = (expression == RHS);
                     break;
                 }
 
                 case mps::MPSConstraintSense::Greater: {
-                    constraint_proxy(i) = (expression >= CONSTRAINT.rhs);
+                    constraint_proxy(i) = (expression >= RHS);
                     break;
                 }
             }
-            constraint_proxy(i).set_name(CONSTRAINT_NAME);
+            constraint_proxy(i).set_name(
+                std::string(a_ACCESSOR.constraint_name(i)));
         }
 
         /**
@@ -3632,12 +4910,12 @@ class Model {
             model_component::Expression<T_Variable,
                                         T_Expression>::create_instance();
         Sensitivities objective_sensitivities;
-        for (const auto &sensitivity : a_MPS.objective.sensitivities) {
-            const std::string  VARIABLE_NAME = sensitivity.first;
-            const T_Expression COEFFICIENT =
-                static_cast<T_Expression>(sensitivity.second);
-            objective_sensitivities[variable_ptrs[VARIABLE_NAME]] = COEFFICIENT;
-        }
+        a_ACCESSOR.for_each_objective_coefficient(
+            [&objective_sensitivities, &variable_proxy](const int    a_COLUMN_ID,
+                                                        const double a_VALUE) {
+                objective_sensitivities[&variable_proxy(a_COLUMN_ID)] =
+                    static_cast<T_Expression>(a_VALUE);
+            });
         objective.set_sensitivities(objective_sensitivities);
         this->minimize(objective);
     }
@@ -4258,11 +5536,35 @@ class Model {
         this->setup_unique_names();
 
         /**
-         * Determine the sensitivities.
+         * Determine the sensitivities. The constraint sensitivities of each
+         * variable are collected from the expressions of the constraints, and
+         * sorted by the names of the constraints.
          */
-        this->setup_variable_constraint_sensitivities();
         this->setup_variable_objective_sensitivities();
 
+        std::unordered_map<
+            const model_component::Variable<T_Variable, T_Expression> *,
+            std::vector<std::pair<
+                const model_component::Constraint<T_Variable, T_Expression> *,
+                T_Expression>>>
+            constraint_sensitivities;
+        for (const auto &proxy : m_constraint_proxies) {
+            for (const auto &constraint : proxy.flat_indexed_constraints()) {
+                for (const auto &sensitivity :
+                     constraint.expression().sensitivities()) {
+                    constraint_sensitivities[sensitivity.first].emplace_back(
+                        &constraint, sensitivity.second);
+                }
+            }
+        }
+        for (auto &&item : constraint_sensitivities) {
+            std::stable_sort(item.second.begin(), item.second.end(),
+                             [](const auto &a_FIRST, const auto &a_SECOND) {
+                                 return a_FIRST.first->name() <
+                                        a_SECOND.first->name();
+                             });
+        }
+
         /**
          * Write instance name.
          */
@@ -4325,8 +5627,12 @@ class Model {
                     }
                 }
                 /// Constraints
+                if (constraint_sensitivities.find(&variable) ==
+                    constraint_sensitivities.end()) {
+                    continue;
+                }
                 for (const auto &sensitivity :
-                     variable.constraint_sensitivities()) {
+                     constraint_sensitivities.at(&variable)) {
                     const auto CONSTRAINT_NAME =
                         utility::delete_space(sensitivity.first->name());
                     const auto COEFFICIENT = sensitivity.second;
@@ -4396,113 +5702,115 @@ class Model {
         /**
          * Determine the sensitivities.
          */
-        this->setup_variable_constraint_sensitivities();
         this->setup_variable_objective_sensitivities();
 
-        utility::json::JsonObject object;
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
 
         /**
          * Instance name
          */
         if (m_name.empty()) {
-            object.emplace_back("name", "untitled");
+            writer.member("name", "untitled");
         } else {
-            object.emplace_back("name", utility::delete_space(m_name));
+            writer.member("name", utility::delete_space(m_name));
         }
 
         /**
          * Minimization or not
          */
-        object.emplace_back("is_minimization", m_is_minimization);
+        writer.member("is_minimization", m_is_minimization);
 
         /**
          * Variables
          */
-        utility::json::JsonArray variable_array;
+        writer.key("variables");
+        writer.begin_array();
         for (const auto &proxy : m_variable_proxies) {
             for (const auto &variable : proxy.flat_indexed_variables()) {
-                utility::json::JsonObject v_object;
-                v_object.emplace_back("name", variable.name());
-                v_object.emplace_back("value", variable.value());
-                v_object.emplace_back("is_fixed", variable.is_fixed());
-                v_object.emplace_back("lower_bound", variable.lower_bound());
-                v_object.emplace_back("upper_bound", variable.upper_bound());
+                writer.begin_object();
+                writer.member("name", variable.name());
+                writer.member("value", variable.value());
+                writer.member("is_fixed", variable.is_fixed());
+                writer.member("lower_bound", variable.lower_bound());
+                writer.member("upper_bound", variable.upper_bound());
                 if (variable.sense() ==
                     model_component::VariableSense::Binary) {
-                    v_object.emplace_back("sense", std::string("Binary"));
+                    writer.member("sense", "Binary");
                 } else {
-                    v_object.emplace_back("sense", std::string("Integer"));
+                    writer.member("sense", "Integer");
                 }
-                variable_array.emplace_back(v_object);
+                writer.end_object();
             }
         }
-        object.emplace_back("variables", variable_array);
+        writer.end_array();
 
         /**
          * Objective
          */
-        utility::json::JsonObject objective_object;
-        utility::json::JsonArray  objective_sensitivity_array;
+        writer.key("objective");
+        writer.begin_object();
+        writer.key("sensitivities");
+        writer.begin_array();
         for (const auto &sensitivity :
              m_objective.expression().sensitivities()) {
-            utility::json::JsonObject sensitivity_object;
-            sensitivity_object.emplace_back("variable",
-                                            sensitivity.first->name());
-            sensitivity_object.emplace_back("coefficient", sensitivity.second);
-            objective_sensitivity_array.emplace_back(sensitivity_object);
+            writer.begin_object();
+            writer.member("variable", sensitivity.first->name());
+            writer.member("coefficient", sensitivity.second);
+            writer.end_object();
         }
-        objective_object.emplace_back("sensitivities",
-                                      objective_sensitivity_array);
-        object.emplace_back("objective", objective_object);
+        writer.end_array();
+        writer.end_object();
 
         /**
          * Constraints
          */
-        utility::json::JsonArray constraint_array;
+        writer.key("constraints");
+        writer.begin_array();
         for (const auto &proxy : m_constraint_proxies) {
             for (const auto &constraint : proxy.flat_indexed_constraints()) {
-                utility::json::JsonObject c_object;
-
                 const auto &EXPRESSION    = constraint.expression();
                 const auto &SENSITIVITIES = EXPRESSION.sensitivities();
-                c_object.emplace_back("name", constraint.name());
-                c_object.emplace_back("is_enabled", constraint.is_enabled());
-                c_object.emplace_back("rhs", -EXPRESSION.constant_value());
+
+                writer.begin_object();
+                writer.member("name", constraint.name());
+                writer.member("is_enabled", constraint.is_enabled());
+                writer.member("rhs", -EXPRESSION.constant_value());
                 switch (constraint.sense()) {
                     case model_component::ConstraintSense::Equal: {
-                        c_object.emplace_back("sense", std::string("="));
+                        writer.member("sense", "=");
                         break;
                     }
                     case model_component::ConstraintSense::Less: {
-                        c_object.emplace_back("sense", std::string("<="));
+                        writer.member("sense", "<=");
                         break;
                     }
                     case model_component::ConstraintSense::Greater: {
-                        c_object.emplace_back("sense", std::string(">="));
+                        writer.member("sense", ">=");
                         break;
                     }
                     default: {
                     }
                 }
 
-                utility::json::JsonArray constraint_sensitivity_array;
+                writer.key("sensitivities");
+                writer.begin_array();
                 for (const auto &sensitivity : SENSITIVITIES) {
-                    utility::json::JsonObject sensitivity_object;
-                    sensitivity_object.emplace_back("variable",
-                                                    sensitivity.first->name());
-                    sensitivity_object.emplace_back("coefficient",
-                                                    sensitivity.second);
-                    constraint_sensitivity_array.emplace_back(
-                        sensitivity_object);
+                    writer.begin_object();
+                    writer.member("variable", sensitivity.first->name());
+                    writer.member("coefficient", sensitivity.second);
+                    writer.end_object();
                 }
-                c_object.emplace_back("sensitivities",
-                                      constraint_sensitivity_array);
-                constraint_array.emplace_back(c_object);
+                writer.end_array();
+                writer.end_object();
             }
         }
+        writer.end_array();
 
-        object.emplace_back("constraints", constraint_array);
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_object();
+        writer.flush();
     }
 
     /*************************************************************************/
@@ -4686,6 +5994,33 @@ class Model {
         return m_constraint_type_reference;
     }
 
+    /*************************************************************************/
+    inline const model_component::ConstraintStateTable<T_Variable,
+                                                       T_Expression> &
+    constraint_state_table(void) const {
+        return m_constraint_state_table;
+    }
+
+    /*************************************************************************/
+    inline const model_component::IncidenceMatrix<T_Variable, T_Expression> &
+    incidence_matrix(void) const {
+        return *m_incidence_matrix_ptr;
+    }
+
+    /*************************************************************************/
+    inline const std::shared_ptr<
+        model_component::IncidenceMatrix<T_Variable, T_Expression>> &
+    incidence_matrix_ptr(void) const {
+        return m_incidence_matrix_ptr;
+    }
+
+    /*************************************************************************/
+    inline const model_component::VariableImprovabilityTable<T_Variable,
+                                                             T_Expression> &
+    variable_improvability_table(void) const {
+        return m_variable_improvability_table;
+    }
+
     /*************************************************************************/
     inline model_component::ConstraintTypeReference<T_Variable, T_Expression> &
     constraint_type_reference_original(void) {
@@ -4803,6 +6138,15 @@ class Model {
         return m_variable_type_reference.dependent_integer_variable_ptrs.size();
     }
 
+    /*************************************************************************/
+    inline int number_of_expressions(void) const {
+        int number_of_expressions = 0;
+        for (const auto &proxy : m_expression_proxies) {
+            number_of_expressions += proxy.number_of_elements();
+        }
+        return number_of_expressions;
+    }
+
     /*************************************************************************/
     inline int number_of_constraints(void) const {
         return m_constraint_reference.constraint_ptrs.size();
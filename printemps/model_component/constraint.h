@@ -47,6 +47,7 @@ class Constraint : public multi_array::AbstractMultiArrayElement {
     Variable<T_Variable, T_Expression> *m_key_variable_ptr;
 
     long m_violation_count;
+    int  m_id;
 
     bool m_is_integer;
     bool m_is_enabled;
@@ -172,6 +173,7 @@ class Constraint : public multi_array::AbstractMultiArrayElement {
 
         m_key_variable_ptr = nullptr;
         m_violation_count  = 0;
+        m_id               = 0;
 
         m_is_integer          = false;
         m_is_enabled          = true;
@@ -911,11 +913,18 @@ class Constraint : public multi_array::AbstractMultiArrayElement {
     /*************************************************************************/
     inline void update(
         const neighborhood::Move<T_Variable, T_Expression> &a_MOVE) {
+        this->update_by_constraint_value(m_expression.evaluate(a_MOVE));
+    }
+
+    /*************************************************************************/
+    inline void update_by_constraint_value(
+        const T_Expression a_CONSTRAINT_VALUE) {
         /**
-         * m_expression must be updated after m_constraint_value and
-         * m_violation.
+         * This method updates the states of the constraint with the new
+         * constraint value computed outside, e.g., by using the incidence
+         * matrix of the model.
          */
-        m_constraint_value = m_expression.evaluate(a_MOVE);
+        m_constraint_value = a_CONSTRAINT_VALUE;
         m_positive_part =
             std::max(m_constraint_value, static_cast<T_Expression>(0));
         m_negative_part =
@@ -944,7 +953,7 @@ class Constraint : public multi_array::AbstractMultiArrayElement {
         }
         m_has_margin = m_has_only_binary_variable &
                        (m_margin_value >= m_max_abs_coefficient);
-        m_expression.update(a_MOVE);
+        m_expression.set_value(a_CONSTRAINT_VALUE);
     }
 
     /*************************************************************************/
@@ -1062,6 +1071,16 @@ class Constraint : public multi_array::AbstractMultiArrayElement {
         return m_violation_count;
     }
 
+    /*************************************************************************/
+    inline void set_id(const int a_ID) noexcept {
+        m_id = a_ID;
+    }
+
+    /*************************************************************************/
+    inline int id(void) const noexcept {
+        return m_id;
+    }
+
     /*************************************************************************/
     inline bool is_user_defined_selection(void) const noexcept {
         return m_is_user_defined_selection;
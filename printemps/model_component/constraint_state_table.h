@@ -0,0 +1,456 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_COMPONENT_CONSTRAINT_STATE_TABLE_H__
+#define PRINTEMPS_MODEL_COMPONENT_CONSTRAINT_STATE_TABLE_H__
+
+namespace printemps::model_component {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Constraint;
+
+/*****************************************************************************/
+struct ConstraintStateTableConstant {
+    static constexpr std::uint8_t IS_ENABLED              = 1 << 0;
+    static constexpr std::uint8_t IS_LESS_OR_EQUAL        = 1 << 1;
+    static constexpr std::uint8_t IS_GREATER_OR_EQUAL     = 1 << 2;
+    static constexpr std::uint8_t IS_EVALUATION_IGNORABLE = 1 << 3;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct ConstraintStateTable {
+    /**
+     * This structure holds the states of constraints referred in the move
+     * evaluation as contiguous arrays indexed by the constraint id, so that
+     * the evaluators do not have to dereference each constraint object.
+     */
+    std::vector<T_Expression> constraint_values;
+    std::vector<T_Expression> positive_parts;
+    std::vector<T_Expression> negative_parts;
+    std::vector<double>       local_penalty_coefficients_less;
+    std::vector<double>       local_penalty_coefficients_greater;
+    std::vector<std::uint8_t> flags;
+
+    std::vector<Constraint<T_Variable, T_Expression> *> constraint_ptrs;
+
+    /*************************************************************************/
+    ConstraintStateTable(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->constraint_values.clear();
+        this->positive_parts.clear();
+        this->negative_parts.clear();
+        this->local_penalty_coefficients_less.clear();
+        this->local_penalty_coefficients_greater.clear();
+        this->flags.clear();
+        this->constraint_ptrs.clear();
+    }
+
+    /*************************************************************************/
+    inline void setup(const std::vector<Constraint<T_Variable, T_Expression> *>
+                          &a_CONSTRAINT_PTRS) {
+        /**
+         * NOTE: This method assigns the ids of constraints as the indices of
+         * the arrays.
+         */
+        this->constraint_ptrs = a_CONSTRAINT_PTRS;
+
+        const int CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+        this->constraint_values.resize(CONSTRAINTS_SIZE);
+        this->positive_parts.resize(CONSTRAINTS_SIZE);
+        this->negative_parts.resize(CONSTRAINTS_SIZE);
+        this->local_penalty_coefficients_less.resize(CONSTRAINTS_SIZE);
+        this->local_penalty_coefficients_greater.resize(CONSTRAINTS_SIZE);
+        this->flags.resize(CONSTRAINTS_SIZE);
+
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            this->constraint_ptrs[i]->set_id(i);
+        }
+        this->update();
+    }
+
+    /*************************************************************************/
+    inline void extend(const std::vector<Constraint<T_Variable, T_Expression> *>
+                           &a_CONSTRAINT_PTRS) {
+        /**
+         * NOTE: This method appends the constraints in a_CONSTRAINT_PTRS
+         * beyond the current size, which have been created after the setup,
+         * and assigns their ids. The states of the existing constraints are
+         * not updated.
+         */
+        const int OLD_CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+        const int CONSTRAINTS_SIZE     = a_CONSTRAINT_PTRS.size();
+
+        this->constraint_ptrs.insert(
+            this->constraint_ptrs.end(),
+            a_CONSTRAINT_PTRS.begin() + OLD_CONSTRAINTS_SIZE,
+            a_CONSTRAINT_PTRS.end());
+        this->constraint_values.resize(CONSTRAINTS_SIZE);
+        this->positive_parts.resize(CONSTRAINTS_SIZE);
+        this->negative_parts.resize(CONSTRAINTS_SIZE);
+        this->local_penalty_coefficients_less.resize(CONSTRAINTS_SIZE);
+        this->local_penalty_coefficients_greater.resize(CONSTRAINTS_SIZE);
+        this->flags.resize(CONSTRAINTS_SIZE);
+
+        for (auto i = OLD_CONSTRAINTS_SIZE; i < CONSTRAINTS_SIZE; i++) {
+            this->constraint_ptrs[i]->set_id(i);
+            this->update(i);
+        }
+    }
+
+    /*************************************************************************/
+    inline void update(const int a_ID) noexcept {
+        const auto &CONSTRAINT = *(this->constraint_ptrs[a_ID]);
+
+        this->constraint_values[a_ID] = CONSTRAINT.constraint_value();
+        this->positive_parts[a_ID]    = CONSTRAINT.positive_part();
+        this->negative_parts[a_ID]    = CONSTRAINT.negative_part();
+        this->local_penalty_coefficients_less[a_ID] =
+            CONSTRAINT.local_penalty_coefficient_less();
+        this->local_penalty_coefficients_greater[a_ID] =
+            CONSTRAINT.local_penalty_coefficient_greater();
+
+        std::uint8_t flag = 0;
+        if (CONSTRAINT.is_enabled()) {
+            flag |= ConstraintStateTableConstant::IS_ENABLED;
+        }
+        if (CONSTRAINT.is_less_or_equal()) {
+            flag |= ConstraintStateTableConstant::IS_LESS_OR_EQUAL;
+        }
+        if (CONSTRAINT.is_greater_or_equal()) {
+            flag |= ConstraintStateTableConstant::IS_GREATER_OR_EQUAL;
+        }
+        if (CONSTRAINT.is_evaluation_ignorable()) {
+            flag |= ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+        }
+        this->flags[a_ID] = flag;
+    }
+
+    /*************************************************************************/
+    inline void update(
+        const Constraint<T_Variable, T_Expression> *a_CONSTRAINT_PTR) noexcept {
+        this->update(a_CONSTRAINT_PTR->id());
+    }
+
+    /*************************************************************************/
+    inline void update(void) noexcept {
+        const int CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            this->update(i);
+        }
+    }
+
+    /*************************************************************************/
+    inline int size(void) const noexcept {
+        return this->constraint_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline bool is_enabled(const int a_ID) const noexcept {
+        return this->flags[a_ID] & ConstraintStateTableConstant::IS_ENABLED;
+    }
+
+    /*************************************************************************/
+    inline bool is_less_or_equal(const int a_ID) const noexcept {
+        return this->flags[a_ID] &
+               ConstraintStateTableConstant::IS_LESS_OR_EQUAL;
+    }
+
+    /*************************************************************************/
+    inline bool is_greater_or_equal(const int a_ID) const noexcept {
+        return this->flags[a_ID] &
+               ConstraintStateTableConstant::IS_GREATER_OR_EQUAL;
+    }
+
+    /*************************************************************************/
+    inline bool is_evaluation_ignorable(const int a_ID) const noexcept {
+        return this->flags[a_ID] &
+               ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+    }
+
+    /*************************************************************************/
+    inline void accumulate_violation_diff(
+        double *a_total_violation_ptr,  //
+        double *a_local_penalty_ptr,    //
+        const int *a_CONSTRAINT_IDS, const T_Expression *a_COEFFICIENTS,
+        const int a_SIZE, const T_Expression a_VARIABLE_VALUE_DIFF,
+        const utility::simd::InstructionSet a_INSTRUCTION_SET) const noexcept {
+        /**
+         * This method accumulates the differences of the total violation and
+         * the local penalty caused by changing the value of a variable whose
+         * coefficients in the constraints are given by a_CONSTRAINT_IDS and
+         * a_COEFFICIENTS. Constraints which are evaluation-ignorable are
+         * skipped.
+         */
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+        if constexpr (std::is_same_v<T_Expression, double>) {
+            switch (a_INSTRUCTION_SET) {
+                case utility::simd::InstructionSet::AVX512: {
+                    this->accumulate_violation_diff_avx512(
+                        a_total_violation_ptr, a_local_penalty_ptr,
+                        a_CONSTRAINT_IDS, a_COEFFICIENTS, a_SIZE,
+                        a_VARIABLE_VALUE_DIFF);
+                    return;
+                }
+                case utility::simd::InstructionSet::AVX2: {
+                    this->accumulate_violation_diff_avx2(
+                        a_total_violation_ptr, a_local_penalty_ptr,
+                        a_CONSTRAINT_IDS, a_COEFFICIENTS, a_SIZE,
+                        a_VARIABLE_VALUE_DIFF);
+                    return;
+                }
+                default: {
+                    break;
+                }
+            }
+        }
+#endif
+        static_cast<void>(a_INSTRUCTION_SET);
+        this->accumulate_violation_diff_scalar(
+            a_total_violation_ptr, a_local_penalty_ptr, a_CONSTRAINT_IDS,
+            a_COEFFICIENTS, 0, a_SIZE, a_VARIABLE_VALUE_DIFF);
+    }
+
+    /*************************************************************************/
+    inline void accumulate_violation_diff_scalar(
+        double *a_total_violation_ptr,  //
+        double *a_local_penalty_ptr,    //
+        const int *a_CONSTRAINT_IDS, const T_Expression *a_COEFFICIENTS,
+        const int a_BEGIN, const int a_END,
+        const T_Expression a_VARIABLE_VALUE_DIFF) const noexcept {
+        double total_violation  = *a_total_violation_ptr;
+        double local_penalty    = *a_local_penalty_ptr;
+        double constraint_value = 0.0;
+        double violation_diff   = 0.0;
+
+        for (auto i = a_BEGIN; i < a_END; i++) {
+            const auto ID = a_CONSTRAINT_IDS[i];
+            if (this->is_evaluation_ignorable(ID)) {
+                continue;
+            }
+            constraint_value = this->constraint_values[ID] +
+                               a_COEFFICIENTS[i] * a_VARIABLE_VALUE_DIFF;
+
+            if (this->is_less_or_equal(ID)) {
+                total_violation +=
+                    (violation_diff = std::max(constraint_value, 0.0) -
+                                      this->positive_parts[ID]);
+
+                local_penalty +=
+                    violation_diff * this->local_penalty_coefficients_less[ID];
+            }
+
+            if (this->is_greater_or_equal(ID)) {
+                total_violation -=
+                    (violation_diff = std::min(constraint_value, 0.0) +
+                                      this->negative_parts[ID]);
+
+                local_penalty -= violation_diff *
+                                 this->local_penalty_coefficients_greater[ID];
+            }
+        }
+
+        *a_total_violation_ptr = total_violation;
+        *a_local_penalty_ptr   = local_penalty;
+    }
+
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+/**
+ * NOTE: Some intrinsics of GCC use undefined vectors internally, which result
+ * in false-positive warnings on uninitialized variables.
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    /*************************************************************************/
+    __attribute__((target("avx2,fma"))) inline void
+    accumulate_violation_diff_avx2(
+        double *a_total_violation_ptr,  //
+        double *a_local_penalty_ptr,    //
+        const int *a_CONSTRAINT_IDS, const double *a_COEFFICIENTS,
+        const int a_SIZE, const double a_VARIABLE_VALUE_DIFF) const noexcept {
+        constexpr std::uint8_t LESS_MASK =
+            ConstraintStateTableConstant::IS_LESS_OR_EQUAL |
+            ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+        constexpr std::uint8_t GREATER_MASK =
+            ConstraintStateTableConstant::IS_GREATER_OR_EQUAL |
+            ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+
+        const __m256d ZERO = _mm256_setzero_pd();
+        const __m256d DIFF = _mm256_set1_pd(a_VARIABLE_VALUE_DIFF);
+
+        __m256d total_violation = ZERO;
+        __m256d local_penalty   = ZERO;
+
+        int lane_mask_less[4];
+        int lane_mask_greater[4];
+
+        const int BLOCK_END = a_SIZE - (a_SIZE % 4);
+        for (auto i = 0; i < BLOCK_END; i += 4) {
+            const __m128i INDICES = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(a_CONSTRAINT_IDS + i));
+
+            for (auto j = 0; j < 4; j++) {
+                const auto FLAG = this->flags[a_CONSTRAINT_IDS[i + j]];
+                lane_mask_less[j] =
+                    -((FLAG & LESS_MASK) ==
+                      ConstraintStateTableConstant::IS_LESS_OR_EQUAL);
+                lane_mask_greater[j] =
+                    -((FLAG & GREATER_MASK) ==
+                      ConstraintStateTableConstant::IS_GREATER_OR_EQUAL);
+            }
+            const __m256d MASK_LESS = _mm256_castsi256_pd(_mm256_set_epi64x(
+                lane_mask_less[3], lane_mask_less[2], lane_mask_less[1],
+                lane_mask_less[0]));
+            const __m256d MASK_GREATER =
+                _mm256_castsi256_pd(_mm256_set_epi64x(
+                    lane_mask_greater[3], lane_mask_greater[2],
+                    lane_mask_greater[1], lane_mask_greater[0]));
+
+            const __m256d CONSTRAINT_VALUE = _mm256_fmadd_pd(
+                _mm256_loadu_pd(a_COEFFICIENTS + i), DIFF,
+                _mm256_i32gather_pd(this->constraint_values.data(), INDICES,
+                                    8));
+            const __m256d VIOLATION_DIFF_LESS = _mm256_sub_pd(
+                _mm256_max_pd(CONSTRAINT_VALUE, ZERO),
+                _mm256_i32gather_pd(this->positive_parts.data(), INDICES, 8));
+            const __m256d VIOLATION_DIFF_GREATER = _mm256_add_pd(
+                _mm256_min_pd(CONSTRAINT_VALUE, ZERO),
+                _mm256_i32gather_pd(this->negative_parts.data(), INDICES, 8));
+
+            /**
+             * The masks are applied after the multiplications so that
+             * infinite penalty coefficients of skipped constraints do not
+             * yield NaN.
+             */
+            total_violation = _mm256_add_pd(
+                total_violation,
+                _mm256_sub_pd(
+                    _mm256_and_pd(VIOLATION_DIFF_LESS, MASK_LESS),
+                    _mm256_and_pd(VIOLATION_DIFF_GREATER, MASK_GREATER)));
+            local_penalty = _mm256_add_pd(
+                local_penalty,
+                _mm256_sub_pd(
+                    _mm256_and_pd(
+                        _mm256_mul_pd(
+                            VIOLATION_DIFF_LESS,
+                            _mm256_i32gather_pd(
+                                this->local_penalty_coefficients_less.data(),
+                                INDICES, 8)),
+                        MASK_LESS),
+                    _mm256_and_pd(
+                        _mm256_mul_pd(
+                            VIOLATION_DIFF_GREATER,
+                            _mm256_i32gather_pd(
+                                this->local_penalty_coefficients_greater
+                                    .data(),
+                                INDICES, 8)),
+                        MASK_GREATER)));
+        }
+
+        double total_violation_lanes[4];
+        double local_penalty_lanes[4];
+        _mm256_storeu_pd(total_violation_lanes, total_violation);
+        _mm256_storeu_pd(local_penalty_lanes, local_penalty);
+        for (auto j = 0; j < 4; j++) {
+            *a_total_violation_ptr += total_violation_lanes[j];
+            *a_local_penalty_ptr += local_penalty_lanes[j];
+        }
+
+        this->accumulate_violation_diff_scalar(
+            a_total_violation_ptr, a_local_penalty_ptr, a_CONSTRAINT_IDS,
+            a_COEFFICIENTS, BLOCK_END, a_SIZE, a_VARIABLE_VALUE_DIFF);
+    }
+
+    /*************************************************************************/
+    __attribute__((target("avx512f"))) inline void
+    accumulate_violation_diff_avx512(
+        double *a_total_violation_ptr,  //
+        double *a_local_penalty_ptr,    //
+        const int *a_CONSTRAINT_IDS, const double *a_COEFFICIENTS,
+        const int a_SIZE, const double a_VARIABLE_VALUE_DIFF) const noexcept {
+        constexpr std::uint8_t LESS_MASK =
+            ConstraintStateTableConstant::IS_LESS_OR_EQUAL |
+            ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+        constexpr std::uint8_t GREATER_MASK =
+            ConstraintStateTableConstant::IS_GREATER_OR_EQUAL |
+            ConstraintStateTableConstant::IS_EVALUATION_IGNORABLE;
+
+        const __m512d ZERO = _mm512_setzero_pd();
+        const __m512d DIFF = _mm512_set1_pd(a_VARIABLE_VALUE_DIFF);
+
+        __m512d total_violation = ZERO;
+        __m512d local_penalty   = ZERO;
+
+        const int BLOCK_END = a_SIZE - (a_SIZE % 8);
+        for (auto i = 0; i < BLOCK_END; i += 8) {
+            const __m256i INDICES = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(a_CONSTRAINT_IDS + i));
+
+            __mmask8 mask_less    = 0;
+            __mmask8 mask_greater = 0;
+            for (auto j = 0; j < 8; j++) {
+                const auto FLAG = this->flags[a_CONSTRAINT_IDS[i + j]];
+                mask_less |=
+                    ((FLAG & LESS_MASK) ==
+                     ConstraintStateTableConstant::IS_LESS_OR_EQUAL)
+                    << j;
+                mask_greater |=
+                    ((FLAG & GREATER_MASK) ==
+                     ConstraintStateTableConstant::IS_GREATER_OR_EQUAL)
+                    << j;
+            }
+
+            const __m512d CONSTRAINT_VALUE = _mm512_fmadd_pd(
+                _mm512_loadu_pd(a_COEFFICIENTS + i), DIFF,
+                _mm512_i32gather_pd(INDICES, this->constraint_values.data(),
+                                    8));
+            const __m512d VIOLATION_DIFF_LESS = _mm512_sub_pd(
+                _mm512_max_pd(CONSTRAINT_VALUE, ZERO),
+                _mm512_i32gather_pd(INDICES, this->positive_parts.data(), 8));
+            const __m512d VIOLATION_DIFF_GREATER = _mm512_add_pd(
+                _mm512_min_pd(CONSTRAINT_VALUE, ZERO),
+                _mm512_i32gather_pd(INDICES, this->negative_parts.data(), 8));
+
+            total_violation = _mm512_mask_add_pd(total_violation, mask_less,
+                                                 total_violation,
+                                                 VIOLATION_DIFF_LESS);
+            total_violation = _mm512_mask_sub_pd(total_violation,
+                                                 mask_greater, total_violation,
+                                                 VIOLATION_DIFF_GREATER);
+
+            local_penalty = _mm512_mask3_fmadd_pd(
+                VIOLATION_DIFF_LESS,
+                _mm512_mask_i32gather_pd(
+                    ZERO, mask_less, INDICES,
+                    this->local_penalty_coefficients_less.data(), 8),
+                local_penalty, mask_less);
+            local_penalty = _mm512_mask3_fnmadd_pd(
+                VIOLATION_DIFF_GREATER,
+                _mm512_mask_i32gather_pd(
+                    ZERO, mask_greater, INDICES,
+                    this->local_penalty_coefficients_greater.data(), 8),
+                local_penalty, mask_greater);
+        }
+
+        *a_total_violation_ptr += _mm512_reduce_add_pd(total_violation);
+        *a_local_penalty_ptr += _mm512_reduce_add_pd(local_penalty);
+
+        this->accumulate_violation_diff_scalar(
+            a_total_violation_ptr, a_local_penalty_ptr, a_CONSTRAINT_IDS,
+            a_COEFFICIENTS, BLOCK_END, a_SIZE, a_VARIABLE_VALUE_DIFF);
+    }
+#pragma GCC diagnostic pop
+#endif
+};
+}  // namespace printemps::model_component
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -300,6 +300,11 @@ class Expression : public multi_array::AbstractMultiArrayElement {
         m_value = this->evaluate(a_MOVE);
     }
 
+    /*************************************************************************/
+    inline void set_value(const T_Expression a_VALUE) noexcept {
+        m_value = a_VALUE;
+    }
+
     /*************************************************************************/
     inline T_Expression value(void) const noexcept {
         return m_value;
@@ -0,0 +1,220 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_COMPONENT_INCIDENCE_MATRIX_H__
+#define PRINTEMPS_MODEL_COMPONENT_INCIDENCE_MATRIX_H__
+
+namespace printemps::model_component {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Variable;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Constraint;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct IncidenceMatrix {
+    /**
+     * This structure holds the coefficients of constraints in the compressed
+     * sparse column (CSC) format. Rows and columns correspond to the ids of
+     * constraints and variables, respectively. The constraint ids in each
+     * column are sorted in ascending order. The rows are not stored since
+     * each constraint refers to its variables through its expression.
+     */
+    std::vector<int>          column_ptrs;
+    std::vector<int>          column_constraint_ids;
+    std::vector<T_Expression> column_coefficients;
+
+    int number_of_variables;
+    int number_of_constraints;
+
+    /*************************************************************************/
+    IncidenceMatrix(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->column_ptrs.clear();
+        this->column_constraint_ids.clear();
+        this->column_coefficients.clear();
+
+        this->number_of_variables   = 0;
+        this->number_of_constraints = 0;
+    }
+
+    /*************************************************************************/
+    inline void setup(
+        const std::vector<Variable<T_Variable, T_Expression> *>
+            &a_VARIABLE_PTRS,
+        const std::vector<Constraint<T_Variable, T_Expression> *>
+            &a_CONSTRAINT_PTRS) {
+        /**
+         * NOTE: This method assigns the ids of variables as the indices of
+         * columns. The ids of constraints must have been assigned in advance
+         * so that they coincide with the positions in a_CONSTRAINT_PTRS.
+         */
+        this->initialize();
+        this->number_of_variables   = a_VARIABLE_PTRS.size();
+        this->number_of_constraints = a_CONSTRAINT_PTRS.size();
+
+        for (auto i = 0; i < this->number_of_variables; i++) {
+            a_VARIABLE_PTRS[i]->set_id(i);
+        }
+
+        this->column_ptrs.resize(this->number_of_variables + 1, 0);
+        for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
+            for (const auto &sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                this->column_ptrs[sensitivity.first->id() + 1]++;
+            }
+        }
+        for (auto i = 0; i < this->number_of_variables; i++) {
+            this->column_ptrs[i + 1] += this->column_ptrs[i];
+        }
+
+        const int NONZERO_SIZE = this->column_ptrs.back();
+        this->column_constraint_ids.resize(NONZERO_SIZE);
+        this->column_coefficients.resize(NONZERO_SIZE);
+
+        /**
+         * Since the constraints are scanned in ascending order of the ids,
+         * the constraint ids in each column are also sorted in ascending
+         * order.
+         */
+        std::vector<int> positions(this->column_ptrs.begin(),
+                                   this->column_ptrs.end() - 1);
+        for (auto i = 0; i < this->number_of_constraints; i++) {
+            for (const auto &sensitivity :
+                 a_CONSTRAINT_PTRS[i]->expression().sensitivities()) {
+                const int POSITION = positions[sensitivity.first->id()]++;
+                this->column_constraint_ids[POSITION] = i;
+                this->column_coefficients[POSITION]   = sensitivity.second;
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline void update(
+        const std::vector<Variable<T_Variable, T_Expression> *>
+            &a_VARIABLE_PTRS,
+        const std::vector<Constraint<T_Variable, T_Expression> *>
+                 &a_CONSTRAINT_PTRS,
+        const int a_NUMBER_OF_CONSTRAINTS) {
+        /**
+         * This method updates the columns for a_VARIABLE_PTRS so that the
+         * coefficients in a_CONSTRAINT_PTRS, whose expressions have been
+         * modified or which have been created after the setup, coincide with
+         * the current expressions. a_VARIABLE_PTRS must include all the
+         * variables in those constraints before and after the modifications,
+         * and a_CONSTRAINT_PTRS must be sorted in ascending order of the ids.
+         * The other columns are copied as they are without referring to the
+         * expressions.
+         */
+        std::vector<std::uint8_t> is_updated_constraint(
+            a_NUMBER_OF_CONSTRAINTS, 0);
+        for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
+            is_updated_constraint[constraint_ptr->id()] = 1;
+        }
+
+        std::vector<int> updated_column_indices(this->number_of_variables, -1);
+        const int        VARIABLES_SIZE = a_VARIABLE_PTRS.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            updated_column_indices[a_VARIABLE_PTRS[i]->id()] = i;
+        }
+
+        /**
+         * Since the constraints are scanned in ascending order of the ids, the
+         * new entries of each column are also sorted in ascending order.
+         */
+        std::vector<std::vector<std::pair<int, T_Expression>>> new_entries(
+            VARIABLES_SIZE);
+        for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
+            for (const auto &sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                new_entries[updated_column_indices[sensitivity.first->id()]]
+                    .emplace_back(constraint_ptr->id(), sensitivity.second);
+            }
+        }
+
+        std::vector<int>          column_ptrs(this->number_of_variables + 1, 0);
+        std::vector<int>          column_constraint_ids;
+        std::vector<T_Expression> column_coefficients;
+        column_constraint_ids.reserve(this->column_constraint_ids.size());
+        column_coefficients.reserve(this->column_coefficients.size());
+
+        for (auto i = 0; i < this->number_of_variables; i++) {
+            const int BEGIN = this->column_ptrs[i];
+            const int END   = this->column_ptrs[i + 1];
+
+            if (updated_column_indices[i] < 0) {
+                column_constraint_ids.insert(
+                    column_constraint_ids.end(),
+                    this->column_constraint_ids.begin() + BEGIN,
+                    this->column_constraint_ids.begin() + END);
+                column_coefficients.insert(
+                    column_coefficients.end(),
+                    this->column_coefficients.begin() + BEGIN,
+                    this->column_coefficients.begin() + END);
+            } else {
+                const auto &ENTRIES  = new_entries[updated_column_indices[i]];
+                auto        entry_it = ENTRIES.begin();
+                for (auto j = BEGIN; j < END; j++) {
+                    const int CONSTRAINT_ID = this->column_constraint_ids[j];
+                    if (is_updated_constraint[CONSTRAINT_ID]) {
+                        continue;
+                    }
+                    while (entry_it != ENTRIES.end() &&
+                           entry_it->first < CONSTRAINT_ID) {
+                        column_constraint_ids.push_back(entry_it->first);
+                        column_coefficients.push_back(entry_it->second);
+                        entry_it++;
+                    }
+                    column_constraint_ids.push_back(CONSTRAINT_ID);
+                    column_coefficients.push_back(
+                        this->column_coefficients[j]);
+                }
+                for (; entry_it != ENTRIES.end(); entry_it++) {
+                    column_constraint_ids.push_back(entry_it->first);
+                    column_coefficients.push_back(entry_it->second);
+                }
+            }
+            column_ptrs[i + 1] = column_constraint_ids.size();
+        }
+
+        this->column_ptrs           = std::move(column_ptrs);
+        this->column_constraint_ids = std::move(column_constraint_ids);
+        this->column_coefficients   = std::move(column_coefficients);
+        this->number_of_constraints = a_NUMBER_OF_CONSTRAINTS;
+    }
+
+    /*************************************************************************/
+    inline T_Expression coefficient(const int a_VARIABLE_ID,
+                                    const int a_CONSTRAINT_ID) const noexcept {
+        const auto FIRST = this->column_constraint_ids.begin() +
+                           this->column_ptrs[a_VARIABLE_ID];
+        const auto LAST  = this->column_constraint_ids.begin() +
+                           this->column_ptrs[a_VARIABLE_ID + 1];
+        const auto ITERATOR = std::lower_bound(FIRST, LAST, a_CONSTRAINT_ID);
+
+        if (ITERATOR == LAST || *ITERATOR != a_CONSTRAINT_ID) {
+            return 0;
+        }
+        return this->column_coefficients[ITERATOR -
+                                         this->column_constraint_ids.begin()];
+    }
+
+    /*************************************************************************/
+    inline int number_of_nonzeros(void) const noexcept {
+        return this->column_constraint_ids.size();
+    }
+};
+}  // namespace printemps::model_component
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -24,6 +24,10 @@
 #include "variable_type_reference.h"
 #include "constraint_reference.h"
 #include "constraint_type_reference.h"
+#include "constraint_state_table.h"
+#include "variable_improvability_table.h"
+#include "incidence_matrix.h"
+#include "structure_dirty_set.h"
 
 #endif
 /*****************************************************************************/
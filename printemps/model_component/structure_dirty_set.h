@@ -0,0 +1,316 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_COMPONENT_STRUCTURE_DIRTY_SET_H__
+#define PRINTEMPS_MODEL_COMPONENT_STRUCTURE_DIRTY_SET_H__
+
+namespace printemps::model_component {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Variable;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Constraint;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Expression;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct StructureDirtySet {
+    /**
+     * This structure holds the variables, constraints, and expressions whose
+     * structure may have been changed since the last structure setup of the
+     * model, so that the model can update the categorization and the
+     * incidence between variables and constraints only for them. Changes of
+     * the bounds, the fixed status, and the sense of variables, and those of
+     * the enabled status and the sense of constraints, are detected by
+     * comparing them with the values recorded at the setup. Constraints and
+     * expressions whose sensitivities will be modified must be registered
+     * before the modification, and those created after the setup are
+     * identified by the numbers recorded at the setup. In debug builds, the
+     * fingerprints of the constraint expressions are also recorded to detect
+     * modifications which have not been registered.
+     */
+    std::vector<Variable<T_Variable, T_Expression> *> variable_ptrs;
+    std::vector<T_Variable>                           lower_bounds;
+    std::vector<T_Variable>                           upper_bounds;
+    std::vector<std::uint8_t>                         is_fixed_flags;
+    std::vector<VariableSense>                        senses;
+
+    std::vector<Constraint<T_Variable, T_Expression> *> constraint_ptrs;
+    std::vector<std::uint8_t>    constraint_is_enabled_flags;
+    std::vector<ConstraintSense> constraint_senses;
+    std::vector<std::uint64_t>   constraint_fingerprints;
+    int                          number_of_expressions;
+
+    std::vector<Constraint<T_Variable, T_Expression> *> dirty_constraint_ptrs;
+    std::vector<Variable<T_Variable, T_Expression> *>   dirty_variable_ptrs;
+    std::vector<Expression<T_Variable, T_Expression> *> dirty_expression_ptrs;
+    std::vector<Variable<T_Variable, T_Expression> *>
+         dirty_expression_variable_ptrs;
+    bool is_objective_dirty;
+
+    /*************************************************************************/
+    StructureDirtySet(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->variable_ptrs.clear();
+        this->lower_bounds.clear();
+        this->upper_bounds.clear();
+        this->is_fixed_flags.clear();
+        this->senses.clear();
+
+        this->constraint_ptrs.clear();
+        this->constraint_is_enabled_flags.clear();
+        this->constraint_senses.clear();
+        this->constraint_fingerprints.clear();
+        this->number_of_expressions = 0;
+
+        this->clear_dirty();
+    }
+
+    /*************************************************************************/
+    inline void setup(const std::vector<Variable<T_Variable, T_Expression> *>
+                          &a_VARIABLE_PTRS,
+                      const std::vector<Constraint<T_Variable, T_Expression> *>
+                                &a_CONSTRAINT_PTRS,
+                      const int  a_NUMBER_OF_EXPRESSIONS) {
+        const int VARIABLES_SIZE = a_VARIABLE_PTRS.size();
+
+        this->variable_ptrs = a_VARIABLE_PTRS;
+        this->lower_bounds.resize(VARIABLES_SIZE);
+        this->upper_bounds.resize(VARIABLES_SIZE);
+        this->is_fixed_flags.resize(VARIABLES_SIZE);
+        this->senses.resize(VARIABLES_SIZE);
+
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            this->record_variable(i);
+        }
+
+        const int CONSTRAINTS_SIZE = a_CONSTRAINT_PTRS.size();
+
+        this->constraint_ptrs = a_CONSTRAINT_PTRS;
+        this->constraint_is_enabled_flags.resize(CONSTRAINTS_SIZE);
+        this->constraint_senses.resize(CONSTRAINTS_SIZE);
+        this->constraint_fingerprints.resize(CONSTRAINTS_SIZE);
+
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            this->record_constraint(i);
+        }
+        this->number_of_expressions = a_NUMBER_OF_EXPRESSIONS;
+
+        this->clear_dirty();
+    }
+
+    /*************************************************************************/
+    inline void update(
+        const std::vector<Variable<T_Variable, T_Expression> *>
+            &a_CHANGED_VARIABLE_PTRS,
+        const std::vector<Constraint<T_Variable, T_Expression> *>
+            &a_CHANGED_CONSTRAINT_PTRS,
+        const std::vector<Constraint<T_Variable, T_Expression> *>
+                 &a_CONSTRAINT_PTRS,
+        const int a_NUMBER_OF_EXPRESSIONS) {
+        /**
+         * This method records again only the variables and constraints which
+         * have been changed, and the constraints created after the setup,
+         * instead of recording all of them. The ids of the variables and the
+         * constraints must coincide with the positions in the recorded
+         * arrays.
+         */
+        for (const auto &variable_ptr : a_CHANGED_VARIABLE_PTRS) {
+            this->record_variable(variable_ptr->id());
+        }
+
+        const int CONSTRAINTS_SIZE     = a_CONSTRAINT_PTRS.size();
+        const int OLD_CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+
+        this->constraint_ptrs.insert(
+            this->constraint_ptrs.end(),
+            a_CONSTRAINT_PTRS.begin() + OLD_CONSTRAINTS_SIZE,
+            a_CONSTRAINT_PTRS.end());
+        this->constraint_is_enabled_flags.resize(CONSTRAINTS_SIZE);
+        this->constraint_senses.resize(CONSTRAINTS_SIZE);
+        this->constraint_fingerprints.resize(CONSTRAINTS_SIZE);
+
+        for (const auto &constraint_ptr : a_CHANGED_CONSTRAINT_PTRS) {
+            this->record_constraint(constraint_ptr->id());
+        }
+        for (auto i = OLD_CONSTRAINTS_SIZE; i < CONSTRAINTS_SIZE; i++) {
+            this->record_constraint(i);
+        }
+        this->number_of_expressions = a_NUMBER_OF_EXPRESSIONS;
+
+        this->clear_dirty();
+    }
+
+    /*************************************************************************/
+    inline void record_variable(const int a_INDEX) {
+        const auto VARIABLE_PTR       = this->variable_ptrs[a_INDEX];
+        this->lower_bounds[a_INDEX]   = VARIABLE_PTR->lower_bound();
+        this->upper_bounds[a_INDEX]   = VARIABLE_PTR->upper_bound();
+        this->is_fixed_flags[a_INDEX] = VARIABLE_PTR->is_fixed();
+        this->senses[a_INDEX]         = VARIABLE_PTR->sense();
+    }
+
+    /*************************************************************************/
+    inline void record_constraint(const int a_INDEX) {
+        const auto CONSTRAINT_PTR = this->constraint_ptrs[a_INDEX];
+        this->constraint_is_enabled_flags[a_INDEX] =
+            CONSTRAINT_PTR->is_enabled();
+        this->constraint_senses[a_INDEX] = CONSTRAINT_PTR->sense();
+#ifndef NDEBUG
+        this->constraint_fingerprints[a_INDEX] =
+            compute_fingerprint(CONSTRAINT_PTR->expression());
+#endif
+    }
+
+    /*************************************************************************/
+    inline void clear_dirty(void) {
+        this->dirty_constraint_ptrs.clear();
+        this->dirty_variable_ptrs.clear();
+        this->dirty_expression_ptrs.clear();
+        this->dirty_expression_variable_ptrs.clear();
+        this->is_objective_dirty = false;
+    }
+
+    /*************************************************************************/
+    inline void register_constraint_ptr(
+        Constraint<T_Variable, T_Expression> *a_constraint_ptr) {
+        /**
+         * The variables currently included in the constraint are registered
+         * together, because they would lose the constraint from their related
+         * constraints by the modification.
+         */
+        this->dirty_constraint_ptrs.push_back(a_constraint_ptr);
+        for (const auto &sensitivity :
+             a_constraint_ptr->expression().sensitivities()) {
+            this->dirty_variable_ptrs.push_back(sensitivity.first);
+        }
+    }
+
+    /*************************************************************************/
+    inline void register_expression_ptr(
+        Expression<T_Variable, T_Expression> *a_expression_ptr) {
+        /**
+         * The variables currently included in the expression are registered
+         * together, because they would lose the expression from their related
+         * expressions by the modification.
+         */
+        this->dirty_expression_ptrs.push_back(a_expression_ptr);
+        for (const auto &sensitivity : a_expression_ptr->sensitivities()) {
+            this->dirty_expression_variable_ptrs.push_back(sensitivity.first);
+        }
+    }
+
+    /*************************************************************************/
+    inline void register_objective(void) noexcept {
+        this->is_objective_dirty = true;
+    }
+
+    /*************************************************************************/
+    inline std::vector<Variable<T_Variable, T_Expression> *>
+    changed_variable_ptrs(void) const {
+        std::vector<Variable<T_Variable, T_Expression> *> result;
+
+        const int VARIABLES_SIZE = this->variable_ptrs.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto VARIABLE_PTR = this->variable_ptrs[i];
+            if (VARIABLE_PTR->lower_bound() != this->lower_bounds[i] ||
+                VARIABLE_PTR->upper_bound() != this->upper_bounds[i] ||
+                VARIABLE_PTR->is_fixed() != this->is_fixed_flags[i] ||
+                VARIABLE_PTR->sense() != this->senses[i]) {
+                result.push_back(VARIABLE_PTR);
+            }
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    inline std::vector<Constraint<T_Variable, T_Expression> *>
+    changed_constraint_ptrs(void) const {
+        std::vector<Constraint<T_Variable, T_Expression> *> result;
+
+        const int CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto CONSTRAINT_PTR = this->constraint_ptrs[i];
+            if (CONSTRAINT_PTR->is_enabled() !=
+                    this->constraint_is_enabled_flags[i] ||
+                CONSTRAINT_PTR->sense() != this->constraint_senses[i]) {
+                result.push_back(CONSTRAINT_PTR);
+            }
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    inline std::vector<Constraint<T_Variable, T_Expression> *>
+    unregistered_modified_constraint_ptrs(void) const {
+        /**
+         * This method returns the constraints whose expressions have been
+         * modified without the registration, which are detected by the
+         * fingerprints recorded in debug builds. It always returns an empty
+         * vector in release builds.
+         */
+        std::vector<Constraint<T_Variable, T_Expression> *> result;
+#ifndef NDEBUG
+        std::unordered_set<Constraint<T_Variable, T_Expression> *>
+            dirty_constraint_ptr_set(this->dirty_constraint_ptrs.begin(),
+                                     this->dirty_constraint_ptrs.end());
+
+        const int CONSTRAINTS_SIZE = this->constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto CONSTRAINT_PTR = this->constraint_ptrs[i];
+            if (dirty_constraint_ptr_set.find(CONSTRAINT_PTR) !=
+                dirty_constraint_ptr_set.end()) {
+                continue;
+            }
+            if (compute_fingerprint(CONSTRAINT_PTR->expression()) !=
+                this->constraint_fingerprints[i]) {
+                result.push_back(CONSTRAINT_PTR);
+            }
+        }
+#endif
+        return result;
+    }
+
+    /*************************************************************************/
+    inline int number_of_variables(void) const noexcept {
+        return this->variable_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline int number_of_constraints(void) const noexcept {
+        return this->constraint_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline static std::uint64_t compute_fingerprint(
+        const Expression<T_Variable, T_Expression> &a_EXPRESSION) {
+        /**
+         * The fingerprint does not depend on the order of the sensitivities,
+         * which is not deterministic in std::unordered_map.
+         */
+        std::uint64_t fingerprint = a_EXPRESSION.sensitivities().size();
+        for (const auto &sensitivity : a_EXPRESSION.sensitivities()) {
+            fingerprint +=
+                (reinterpret_cast<std::uint64_t>(sensitivity.first) *
+                 0x9E3779B97F4A7C15ULL) ^
+                std::hash<T_Expression>()(sensitivity.second);
+        }
+        return fingerprint;
+    }
+};
+}  // namespace printemps::model_component
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
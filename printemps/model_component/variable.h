@@ -25,6 +25,10 @@ class Constraint;
 template <class T_Variable, class T_Expression>
 struct Selection;
 
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct VariableImprovabilityTable;
+
 /*****************************************************************************/
 struct VariableConstant {
     static constexpr int INITIAL_LOCAL_LAST_UPDATE_ITERATION = -1000;
@@ -40,9 +44,8 @@ struct VariableExtension {
     std::vector<Constraint<T_Variable, T_Expression> *> related_constraint_ptrs;
     std::vector<Constraint<T_Variable, T_Expression> *>
         related_binary_coefficient_constraint_ptrs;
+    std::vector<Expression<T_Variable, T_Expression> *> related_expression_ptrs;
     Expression<T_Variable, T_Expression> *dependent_expression_ptr;
-    std::vector<std::pair<Constraint<T_Variable, T_Expression> *, T_Expression>>
-        constraint_sensitivities;
 
     T_Expression objective_sensitivity;
 
@@ -78,8 +81,11 @@ class Variable : public multi_array::AbstractMultiArrayElement {
     int        m_local_last_update_iteration;
     int        m_global_last_update_iteration;
     long       m_update_count;
+    int        m_id;
 
     std::unique_ptr<VariableExtension<T_Variable, T_Expression>> m_extension;
+    VariableImprovabilityTable<T_Variable, T_Expression>
+        *m_improvability_table_ptr;
 
     bool m_has_bounds;
     bool m_is_fixed;
@@ -142,6 +148,7 @@ class Variable : public multi_array::AbstractMultiArrayElement {
 
         m_is_objective_improvable   = false;
         m_is_feasibility_improvable = false;
+        m_improvability_table_ptr   = nullptr;
 
         m_has_lower_bound_margin = true;
         m_has_upper_bound_margin = true;
@@ -150,14 +157,15 @@ class Variable : public multi_array::AbstractMultiArrayElement {
             VariableConstant::INITIAL_LOCAL_LAST_UPDATE_ITERATION;
         m_global_last_update_iteration = 0;
         m_update_count                 = 0;
+        m_id                           = 0;
 
         m_extension->sense                  = VariableSense::Integer;
         m_extension->lagrangian_coefficient = 0.0;
         m_extension->selection_ptr          = nullptr;
         m_extension->related_constraint_ptrs.clear();
         m_extension->related_binary_coefficient_constraint_ptrs.clear();
+        m_extension->related_expression_ptrs.clear();
         m_extension->dependent_expression_ptr = nullptr;
-        m_extension->constraint_sensitivities.clear();
         m_extension->objective_sensitivity                      = 0.0;
         m_extension->hash                                       = 0;
         m_extension->related_selection_constraint_ptr_index_min = -1;
@@ -314,11 +322,26 @@ class Variable : public multi_array::AbstractMultiArrayElement {
         m_update_count = 0;
     }
 
+    /*************************************************************************/
+    inline void set_update_count(const long a_UPDATE_COUNT) noexcept {
+        m_update_count = a_UPDATE_COUNT;
+    }
+
     /*************************************************************************/
     inline long update_count(void) const noexcept {
         return m_update_count;
     }
 
+    /*************************************************************************/
+    inline void set_id(const int a_ID) noexcept {
+        m_id = a_ID;
+    }
+
+    /*************************************************************************/
+    inline int id(void) const noexcept {
+        return m_id;
+    }
+
     /*************************************************************************/
     inline void fix(void) {
         m_is_fixed = true;
@@ -341,67 +364,111 @@ class Variable : public multi_array::AbstractMultiArrayElement {
         this->update_margin();
     }
 
+    /*************************************************************************/
+    inline void set_improvability_table_ptr(
+        VariableImprovabilityTable<T_Variable, T_Expression>
+            *a_IMPROVABILITY_TABLE_PTR) noexcept {
+        m_improvability_table_ptr = a_IMPROVABILITY_TABLE_PTR;
+    }
+
+    /*************************************************************************/
+    inline VariableImprovabilityTable<T_Variable, T_Expression>
+        *improvability_table_ptr(void) const noexcept {
+        return m_improvability_table_ptr;
+    }
+
     /*************************************************************************/
     inline void set_is_objective_improvable(
         const bool a_IS_OBJECTIVE_IMPROVABLE) noexcept {
+        /**
+         * NOTE: If the variable is attached to an improvability table, the
+         * improvabilities are stored in the table instead of the members.
+         */
+        if (m_improvability_table_ptr != nullptr) {
+            m_improvability_table_ptr->objective_improvable_bits.set(
+                m_id, a_IS_OBJECTIVE_IMPROVABLE);
+            return;
+        }
         m_is_objective_improvable = a_IS_OBJECTIVE_IMPROVABLE;
     }
 
     /*************************************************************************/
     inline void set_is_objective_improvable_or(
         const bool a_IS_OBJECTIVE_IMPROVABLE) noexcept {
-        m_is_objective_improvable |= a_IS_OBJECTIVE_IMPROVABLE;
+        if (a_IS_OBJECTIVE_IMPROVABLE) {
+            this->set_is_objective_improvable(true);
+        }
     }
 
     /*************************************************************************/
     inline void set_is_objective_improvable_and(
         const bool a_IS_OBJECTIVE_IMPROVABLE) noexcept {
-        m_is_objective_improvable &= a_IS_OBJECTIVE_IMPROVABLE;
+        if (!a_IS_OBJECTIVE_IMPROVABLE) {
+            this->set_is_objective_improvable(false);
+        }
     }
 
     /*************************************************************************/
     inline bool is_objective_improvable(void) const noexcept {
+        if (m_improvability_table_ptr != nullptr) {
+            return m_improvability_table_ptr->objective_improvable_bits.test(
+                m_id);
+        }
         return m_is_objective_improvable;
     }
 
     /*************************************************************************/
     inline void set_is_feasibility_improvable(
         const bool a_IS_FEASIBILITY_IMPROVABLE) noexcept {
+        if (m_improvability_table_ptr != nullptr) {
+            m_improvability_table_ptr->feasibility_improvable_bits.set(
+                m_id, a_IS_FEASIBILITY_IMPROVABLE);
+            return;
+        }
         m_is_feasibility_improvable = a_IS_FEASIBILITY_IMPROVABLE;
     }
 
     /*************************************************************************/
     inline void set_is_feasibility_improvable_or(
         const bool a_IS_FEASIBILITY_IMPROVABLE) noexcept {
-        m_is_feasibility_improvable |= a_IS_FEASIBILITY_IMPROVABLE;
+        if (a_IS_FEASIBILITY_IMPROVABLE) {
+            this->set_is_feasibility_improvable(true);
+        }
     }
 
     /*************************************************************************/
     inline void set_is_feasibility_improvable_and(
         const bool a_IS_FEASIBILITY_IMPROVABLE) noexcept {
-        m_is_feasibility_improvable &= a_IS_FEASIBILITY_IMPROVABLE;
+        if (!a_IS_FEASIBILITY_IMPROVABLE) {
+            this->set_is_feasibility_improvable(false);
+        }
     }
 
     /*************************************************************************/
     inline void set_is_feasibility_improvable_if_has_lower_bound_margin(
         void) noexcept {
-        m_is_feasibility_improvable |= m_has_lower_bound_margin;
+        this->set_is_feasibility_improvable_or(m_has_lower_bound_margin);
     }
 
     /*************************************************************************/
     inline void set_is_feasibility_improvable_if_has_upper_bound_margin(
         void) noexcept {
-        m_is_feasibility_improvable |= m_has_upper_bound_margin;
+        this->set_is_feasibility_improvable_or(m_has_upper_bound_margin);
     }
 
     /*************************************************************************/
     inline bool is_feasibility_improvable(void) const noexcept {
+        if (m_improvability_table_ptr != nullptr) {
+            return m_improvability_table_ptr->feasibility_improvable_bits.test(
+                m_id);
+        }
         return m_is_feasibility_improvable;
     }
 
     /*************************************************************************/
     inline bool is_improvable(void) const noexcept {
-        return m_is_feasibility_improvable || m_is_objective_improvable;
+        return this->is_feasibility_improvable() ||
+               this->is_objective_improvable();
     }
 
     /*************************************************************************/
@@ -536,6 +603,44 @@ class Variable : public multi_array::AbstractMultiArrayElement {
         return m_extension->related_constraint_ptrs;
     }
 
+    /*************************************************************************/
+    inline void register_related_expression_ptr(
+        Expression<T_Variable, T_Expression> *a_expression_ptr) {
+        m_extension->related_expression_ptrs.push_back(a_expression_ptr);
+    }
+
+    /*************************************************************************/
+    inline void reset_related_expression_ptrs(void) {
+        m_extension->related_expression_ptrs.clear();
+    }
+
+    /*************************************************************************/
+    inline void sort_and_unique_related_expression_ptrs(void) {
+        /**
+         * The expressions are sorted by their addresses, which coincide with
+         * the order of creation in each proxy.
+         */
+        std::sort(m_extension->related_expression_ptrs.begin(),
+                  m_extension->related_expression_ptrs.end());
+
+        m_extension->related_expression_ptrs.erase(
+            std::unique(m_extension->related_expression_ptrs.begin(),  //
+                        m_extension->related_expression_ptrs.end()),
+            m_extension->related_expression_ptrs.end());
+    }
+
+    /*************************************************************************/
+    inline std::vector<Expression<T_Variable, T_Expression> *> &
+    related_expression_ptrs(void) {
+        return m_extension->related_expression_ptrs;
+    }
+
+    /*************************************************************************/
+    inline const std::vector<Expression<T_Variable, T_Expression> *> &
+    related_expression_ptrs(void) const {
+        return m_extension->related_expression_ptrs;
+    }
+
     /*************************************************************************/
     inline void setup_related_binary_coefficient_constraint_ptrs(void) {
         /**
@@ -612,43 +717,6 @@ class Variable : public multi_array::AbstractMultiArrayElement {
             m_extension->dependent_expression_ptr);
     }
 
-    /*************************************************************************/
-    inline void register_constraint_sensitivity(
-        Constraint<T_Variable, T_Expression> *a_constraint_ptr,
-        const T_Expression                    a_SENSITIVITY) {
-        m_extension->constraint_sensitivities.emplace_back(a_constraint_ptr,
-                                                           a_SENSITIVITY);
-    }
-
-    /*************************************************************************/
-    inline void reset_constraint_sensitivities(void) {
-        m_extension->constraint_sensitivities.clear();
-    }
-
-    /*************************************************************************/
-    inline void sort_constraint_sensitivities(void) {
-        std::stable_sort(m_extension->constraint_sensitivities.begin(),
-                         m_extension->constraint_sensitivities.end(),
-                         [](const auto &a_FIRST, const auto &a_SECOND) {
-                             return a_FIRST.first->name() <
-                                    a_SECOND.first->name();
-                         });
-    }
-
-    /*************************************************************************/
-    inline std::vector<
-        std::pair<Constraint<T_Variable, T_Expression> *, T_Expression>> &
-    constraint_sensitivities(void) {
-        return m_extension->constraint_sensitivities;
-    }
-
-    /*************************************************************************/
-    inline const std::vector<
-        std::pair<Constraint<T_Variable, T_Expression> *, T_Expression>> &
-    constraint_sensitivities(void) const {
-        return m_extension->constraint_sensitivities;
-    }
-
     /*************************************************************************/
     inline void set_objective_sensitivity(const T_Expression a_SENSITIVITY) {
         m_extension->objective_sensitivity = a_SENSITIVITY;
@@ -666,8 +734,9 @@ class Variable : public multi_array::AbstractMultiArrayElement {
          * preprocess::remove_redundant_set_variables().
          */
         std::uint64_t hash = 0;
-        for (const auto &sensitivity : m_extension->constraint_sensitivities) {
-            hash += reinterpret_cast<std::uint64_t>(sensitivity.first);
+        for (const auto &constraint_ptr :
+             m_extension->related_constraint_ptrs) {
+            hash += reinterpret_cast<std::uint64_t>(constraint_ptr);
         }
         m_extension->hash = hash;
     }
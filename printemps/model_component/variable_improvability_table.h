@@ -0,0 +1,96 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_COMPONENT_VARIABLE_IMPROVABILITY_TABLE_H__
+#define PRINTEMPS_MODEL_COMPONENT_VARIABLE_IMPROVABILITY_TABLE_H__
+
+namespace printemps::model_component {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Variable;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct VariableImprovabilityTable {
+    /**
+     * This structure holds the objective and feasibility improvabilities of
+     * variables as bitsets indexed by the variable id. Once a variable is
+     * attached to the table, its improvability accessors read and write the
+     * bits instead of its own members, so that the improvabilities of all
+     * variables can be reset and scanned word by word, e.g., by the binary
+     * and integer move generators to extract the candidate moves.
+     */
+    utility::Bitset objective_improvable_bits;
+    utility::Bitset feasibility_improvable_bits;
+
+    /*************************************************************************/
+    VariableImprovabilityTable(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->objective_improvable_bits.initialize();
+        this->feasibility_improvable_bits.initialize();
+    }
+
+    /*************************************************************************/
+    inline void setup(const std::vector<Variable<T_Variable, T_Expression> *>
+                          &a_VARIABLE_PTRS) {
+        /**
+         * NOTE: This method must be called after the ids of variables are
+         * assigned. The current improvabilities of the variables are carried
+         * over to the table.
+         */
+        const int VARIABLES_SIZE = a_VARIABLE_PTRS.size();
+
+        utility::Bitset objective_bits(VARIABLES_SIZE);
+        utility::Bitset feasibility_bits(VARIABLES_SIZE);
+
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto VARIABLE_PTR = a_VARIABLE_PTRS[i];
+            const auto ID           = VARIABLE_PTR->id();
+            objective_bits.set(ID, VARIABLE_PTR->is_objective_improvable());
+            feasibility_bits.set(ID, VARIABLE_PTR->is_feasibility_improvable());
+        }
+
+        this->objective_improvable_bits   = std::move(objective_bits);
+        this->feasibility_improvable_bits = std::move(feasibility_bits);
+
+        for (auto &&variable_ptr : a_VARIABLE_PTRS) {
+            variable_ptr->set_improvability_table_ptr(this);
+        }
+    }
+
+    /*************************************************************************/
+    inline int number_of_variables(void) const noexcept {
+        return this->objective_improvable_bits.size();
+    }
+
+    /*************************************************************************/
+    inline int number_of_words(void) const noexcept {
+        return this->objective_improvable_bits.number_of_words();
+    }
+
+    /*************************************************************************/
+    inline std::uint64_t improvable_word(
+        const int  a_WORD_INDEX,                   //
+        const bool a_ACCEPT_OBJECTIVE_IMPROVABLE,  //
+        const bool a_ACCEPT_FEASIBILITY_IMPROVABLE) const noexcept {
+        std::uint64_t word = 0;
+        if (a_ACCEPT_OBJECTIVE_IMPROVABLE) {
+            word |= this->objective_improvable_bits.words()[a_WORD_INDEX];
+        }
+        if (a_ACCEPT_FEASIBILITY_IMPROVABLE) {
+            word |= this->feasibility_improvable_bits.words()[a_WORD_INDEX];
+        }
+        return word;
+    }
+};
+}  // namespace printemps::model_component
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
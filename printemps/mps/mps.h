@@ -11,6 +11,9 @@
 #include "mps_objective.h"
 #include "mps_read_mode.h"
 #include "mps_bound_sense.h"
+#include "mps_name_table.h"
+#include "mps_matrix.h"
+#include "mps_columns_chunk.h"
 
 namespace printemps::mps {
 /*****************************************************************************/
@@ -23,15 +26,27 @@ struct MPS {
     std::vector<std::string> variable_names;
     std::vector<std::string> constraint_names;
 
+    /**
+     * The following members are set up only by the parallel reader. The
+     * coefficients are stored in matrix instead of the sensitivities of the
+     * constraints and the objective function.
+     */
+    MPSNameTable row_name_table;
+    MPSNameTable column_name_table;
+    MPSMatrix    matrix;
+
     /*************************************************************************/
     MPS(void) {
         this->initialize();
     }
 
     /*************************************************************************/
-    MPS(const std::string &a_FILE_NAME) {
+    MPS(const std::string &a_FILE_NAME,                //
+        const bool         a_IS_ENABLED_PARALLEL = false,  //
+        const int          a_NUMBER_OF_THREADS   = 1) {
         this->initialize();
-        this->read_mps(a_FILE_NAME);
+        this->read_mps(a_FILE_NAME, a_IS_ENABLED_PARALLEL,
+                       a_NUMBER_OF_THREADS);
     }
 
     /*************************************************************************/
@@ -42,6 +57,33 @@ struct MPS {
         this->objective.initialize();
         this->variable_names.clear();
         this->constraint_names.clear();
+
+        this->row_name_table.initialize();
+        this->column_name_table.initialize();
+        this->matrix.initialize();
+    }
+
+    /*************************************************************************/
+    inline std::string_view extract_line(const std::string_view &a_CONTENT,
+                                         std::size_t            *a_pos_ptr) {
+        const std::size_t SIZE     = a_CONTENT.size();
+        std::size_t       pos      = *a_pos_ptr;
+        std::size_t       line_end = pos;
+        while (line_end < SIZE && a_CONTENT[line_end] != '\n' &&
+               a_CONTENT[line_end] != '\r') {
+            line_end++;
+        }
+
+        std::string_view line_view = a_CONTENT.substr(pos, line_end - pos);
+
+        pos = line_end;
+        while (pos < SIZE &&
+               (a_CONTENT[pos] == '\n' || a_CONTENT[pos] == '\r')) {
+            pos++;
+        }
+        *a_pos_ptr = pos;
+
+        return line_view;
     }
 
     /*************************************************************************/
@@ -456,7 +498,379 @@ struct MPS {
     }
 
     /*************************************************************************/
-    inline void read_mps(const std::string &a_FILE_NAME) {
+    inline std::size_t find_columns_end(const std::string_view &a_CONTENT,
+                                        const std::size_t       a_BEGIN) {
+        /**
+         * The COLUMNS section ends at the first line which consists of a
+         * single section keyword. Lines starting with NAME, OBJSENSE, or
+         * OBJNAME are also left to the sequential reader.
+         */
+        const std::size_t SIZE = a_CONTENT.size();
+        std::size_t       pos  = a_BEGIN;
+
+        while (pos < SIZE) {
+            const std::size_t LINE_BEGIN = pos;
+            const auto        LINE_VIEW  = this->extract_line(a_CONTENT, &pos);
+            const std::size_t LENGTH     = LINE_VIEW.size();
+
+            std::size_t first_begin = 0;
+            while (first_begin < LENGTH &&
+                   utility::is_space_or_tab(
+                       static_cast<unsigned char>(LINE_VIEW[first_begin]))) {
+                first_begin++;
+            }
+            std::size_t first_end = first_begin;
+            while (first_end < LENGTH &&
+                   !utility::is_space_or_tab(
+                       static_cast<unsigned char>(LINE_VIEW[first_end]))) {
+                first_end++;
+            }
+            std::size_t rest = first_end;
+            while (rest < LENGTH &&
+                   utility::is_space_or_tab(
+                       static_cast<unsigned char>(LINE_VIEW[rest]))) {
+                rest++;
+            }
+
+            const auto FIRST =
+                LINE_VIEW.substr(first_begin, first_end - first_begin);
+            if (FIRST.empty() || FIRST.size() > 8) {
+                continue;
+            }
+
+            const std::string TOKEN = utility::to_uppercase(FIRST);
+            if (TOKEN == "NAME" || TOKEN == "OBJSENSE" || TOKEN == "OBJNAME") {
+                return LINE_BEGIN;
+            }
+            if (rest == LENGTH &&
+                MPSReadModeMap.find(TOKEN) != MPSReadModeMap.end()) {
+                return LINE_BEGIN;
+            }
+        }
+        return SIZE;
+    }
+
+    /*************************************************************************/
+    inline void parse_columns_chunk(const std::string_view &a_CONTENT,
+                                    MPSColumnsChunk        *a_chunk_ptr) {
+        /**
+         * This method parses a chunk of the COLUMNS section. It only reads
+         * row_name_table and objective, so that it can be called concurrently
+         * for disjoint chunks.
+         */
+        std::unordered_map<std::string_view, int> column_indices;
+        std::vector<std::string_view>             items;
+        items.reserve(8);
+
+        const int INTEGER    = static_cast<int>(MPSVariableSense::Integer);
+        const int CONTINUOUS = static_cast<int>(MPSVariableSense::Continuous);
+
+        auto &chunk = *a_chunk_ptr;
+
+        std::string_view  last_column_name;
+        int               last_column_index = -1;
+        std::size_t       pos               = 0;
+        const std::size_t SIZE              = a_CONTENT.size();
+
+        while (pos < SIZE) {
+            const auto LINE_VIEW = this->extract_line(a_CONTENT, &pos);
+            utility::split_items(LINE_VIEW, &items);
+
+            if (items.empty()) {
+                continue;
+            }
+
+            if (!items.front().empty() && items.front().front() == '*') {
+                continue;
+            }
+
+            const std::size_t ITEMS_SIZE = items.size();
+            if (ITEMS_SIZE < 3 || (ITEMS_SIZE & 1) == 0) {
+                throw std::runtime_error(utility::format_error_location(
+                    __FILE__, __LINE__, __func__,
+                    "The MPS file has something wrong in COLUMNS section."));
+            }
+
+            if (items[2].size() > 0 && items[2].front() == '\'') {
+                if (items[2] == "'INTORG'") {
+                    chunk.last_sense = INTEGER;
+                    continue;
+                } else if (items[2] == "'INTEND'") {
+                    chunk.last_sense = CONTINUOUS;
+                    continue;
+                }
+            }
+
+            const auto &COLUMN_NAME = items[0];
+            if (last_column_index < 0 || COLUMN_NAME != last_column_name) {
+                auto [it, inserted] = column_indices.try_emplace(
+                    COLUMN_NAME, static_cast<int>(chunk.column_names.size()));
+                if (inserted) {
+                    chunk.column_names.push_back(COLUMN_NAME);
+                    chunk.column_senses.push_back(chunk.last_sense);
+                }
+                last_column_name  = COLUMN_NAME;
+                last_column_index = it->second;
+            }
+
+            const int WIDTH = static_cast<int>((ITEMS_SIZE - 1) / 2);
+            for (auto i = 0; i < WIDTH; ++i) {
+                const auto k = 2 * i;
+
+                const auto &EXPRESSION_NAME = items[k + 1];
+                const double SENSITIVITY    = this->parse_value(items[k + 2]);
+                if (std::fabs(SENSITIVITY) < constant::EPSILON_10) {
+                    continue;
+                }
+
+                int row_id = -1;
+                if (this->objective.name.empty() ||
+                    EXPRESSION_NAME != this->objective.name) {
+                    row_id = this->row_name_table.find(EXPRESSION_NAME);
+                    if (row_id < 0) {
+                        throw std::runtime_error(utility::format_error_location(
+                            __FILE__, __LINE__, __func__,
+                            "An undefined constraint or objective function "
+                            "name is specified in COLUMNS section: " +
+                                std::string(EXPRESSION_NAME)));
+                    }
+                }
+
+                chunk.row_ids.push_back(row_id);
+                chunk.column_indices.push_back(last_column_index);
+                chunk.values.push_back(SENSITIVITY);
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline std::size_t parse_columns_parallel(
+        const std::string_view       &a_CONTENT,              //
+        const std::size_t             a_BEGIN,                //
+        MPSVariableSense             *a_variable_sense_ptr,   //
+        const int                     a_NUMBER_OF_THREADS,    //
+        std::vector<MPSColumnsChunk> *a_chunks_ptr,           //
+        std::vector<int>             *a_column_variable_indices_ptr) {
+        /**
+         * The COLUMNS section is split into chunks at line boundaries and the
+         * chunks are parsed in parallel. Then the column names are interned
+         * and the variables are registered sequentially in the order of the
+         * chunks, so that the result coincides with that of the sequential
+         * reader.
+         */
+        const std::size_t END = this->find_columns_end(a_CONTENT, a_BEGIN);
+
+        if (this->row_name_table.size() == 0) {
+            this->row_name_table.reserve(this->constraint_names.size());
+            for (const auto &CONSTRAINT_NAME : this->constraint_names) {
+                this->row_name_table.intern(CONSTRAINT_NAME);
+            }
+        }
+
+        /**
+         * Determine the boundaries of the chunks.
+         */
+        const int NUMBER_OF_CHUNKS = std::max(1, a_NUMBER_OF_THREADS);
+        const std::size_t LENGTH   = END - a_BEGIN;
+
+        std::vector<std::size_t> boundaries(NUMBER_OF_CHUNKS + 1, END);
+        boundaries[0] = a_BEGIN;
+        for (auto i = 1; i < NUMBER_OF_CHUNKS; i++) {
+            std::size_t pos = std::max(
+                boundaries[i - 1], a_BEGIN + LENGTH * i / NUMBER_OF_CHUNKS);
+            if (pos > a_BEGIN) {
+                while (pos < END && a_CONTENT[pos - 1] != '\n' &&
+                       a_CONTENT[pos - 1] != '\r') {
+                    pos++;
+                }
+            }
+            boundaries[i] = pos;
+        }
+
+        /**
+         * Parse the chunks in parallel.
+         */
+        const std::size_t OFFSET = a_chunks_ptr->size();
+        a_chunks_ptr->resize(OFFSET + NUMBER_OF_CHUNKS);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(NUMBER_OF_CHUNKS)
+#endif
+        for (auto i = 0; i < NUMBER_OF_CHUNKS; i++) {
+            auto &chunk = (*a_chunks_ptr)[OFFSET + i];
+            try {
+                this->parse_columns_chunk(
+                    a_CONTENT.substr(boundaries[i],
+                                     boundaries[i + 1] - boundaries[i]),
+                    &chunk);
+            } catch (const std::exception &e) {
+                chunk.error_message = e.what();
+            }
+        }
+
+        for (auto i = 0; i < NUMBER_OF_CHUNKS; i++) {
+            const auto &CHUNK = (*a_chunks_ptr)[OFFSET + i];
+            if (!CHUNK.error_message.empty()) {
+                throw std::runtime_error(CHUNK.error_message);
+            }
+        }
+
+        /**
+         * Intern the column names and register the variables.
+         */
+        int variable_sense = static_cast<int>(*a_variable_sense_ptr);
+        for (auto i = 0; i < NUMBER_OF_CHUNKS; i++) {
+            auto     &chunk             = (*a_chunks_ptr)[OFFSET + i];
+            const int NUMBER_OF_COLUMNS = chunk.column_names.size();
+
+            std::vector<int> variable_indices(NUMBER_OF_COLUMNS);
+            for (auto j = 0; j < NUMBER_OF_COLUMNS; j++) {
+                const auto &COLUMN_NAME = chunk.column_names[j];
+                const int   SENSE       = chunk.column_senses[j] >= 0
+                                              ? chunk.column_senses[j]
+                                              : variable_sense;
+
+                const auto [ID, IS_INSERTED] =
+                    this->column_name_table.intern(COLUMN_NAME);
+                if (!IS_INSERTED) {
+                    variable_indices[j] = (*a_column_variable_indices_ptr)[ID];
+                    continue;
+                }
+
+                const std::string NAME(COLUMN_NAME);
+                auto [it, inserted] = this->variables.try_emplace(NAME);
+                if (inserted) {
+                    auto &variable = it->second;
+                    variable.sense = static_cast<MPSVariableSense>(SENSE);
+                    variable.name  = it->first;
+                    variable_indices[j] = this->variable_names.size();
+                    this->variable_names.emplace_back(it->first);
+                } else {
+                    variable_indices[j] = std::distance(
+                        this->variable_names.begin(),
+                        std::find(this->variable_names.begin(),
+                                  this->variable_names.end(), NAME));
+                }
+                a_column_variable_indices_ptr->push_back(variable_indices[j]);
+            }
+
+            for (auto &&column_index : chunk.column_indices) {
+                column_index = variable_indices[column_index];
+            }
+
+            if (chunk.last_sense >= 0) {
+                variable_sense = chunk.last_sense;
+            }
+        }
+        *a_variable_sense_ptr = static_cast<MPSVariableSense>(variable_sense);
+
+        return END;
+    }
+
+    /*************************************************************************/
+    inline void setup_matrix(const std::vector<MPSColumnsChunk> &a_CHUNKS) {
+        /**
+         * This method builds the CSR matrix from the parsed chunks. The
+         * coefficients are first gathered for the interned rows, and then
+         * assigned to the rows in the order of constraint_names. The rows
+         * appended by RANGES section take over the coefficients of their
+         * original rows.
+         */
+        const int NUMBER_OF_BASE_ROWS = this->row_name_table.size();
+        const int NUMBER_OF_ROWS      = this->constraint_names.size();
+
+        /**
+         * Gather the coefficients for the interned rows.
+         */
+        std::vector<int> base_row_ptrs(NUMBER_OF_BASE_ROWS + 1, 0);
+        int              number_of_objective_nonzeros = 0;
+        for (const auto &CHUNK : a_CHUNKS) {
+            for (const auto &ROW_ID : CHUNK.row_ids) {
+                if (ROW_ID < 0) {
+                    number_of_objective_nonzeros++;
+                } else {
+                    base_row_ptrs[ROW_ID + 1]++;
+                }
+            }
+        }
+        for (auto i = 0; i < NUMBER_OF_BASE_ROWS; i++) {
+            base_row_ptrs[i + 1] += base_row_ptrs[i];
+        }
+
+        std::vector<int>    base_column_ids(base_row_ptrs.back());
+        std::vector<double> base_values(base_row_ptrs.back());
+        std::vector<int>    positions(base_row_ptrs.begin(),
+                                      base_row_ptrs.end() - 1);
+
+        this->matrix.objective_column_ids.reserve(number_of_objective_nonzeros);
+        this->matrix.objective_values.reserve(number_of_objective_nonzeros);
+
+        for (const auto &CHUNK : a_CHUNKS) {
+            const int SIZE = CHUNK.row_ids.size();
+            for (auto i = 0; i < SIZE; i++) {
+                const int ROW_ID = CHUNK.row_ids[i];
+                if (ROW_ID < 0) {
+                    this->matrix.objective_column_ids.push_back(
+                        CHUNK.column_indices[i]);
+                    this->matrix.objective_values.push_back(CHUNK.values[i]);
+                } else {
+                    const int POSITION        = positions[ROW_ID]++;
+                    base_column_ids[POSITION] = CHUNK.column_indices[i];
+                    base_values[POSITION]     = CHUNK.values[i];
+                }
+            }
+        }
+
+        /**
+         * Assign the coefficients to the rows.
+         */
+        const std::string_view SUFFIX("_range");
+        std::vector<int>       base_row_ids(NUMBER_OF_ROWS, -1);
+        for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+            const std::string_view NAME(this->constraint_names[i]);
+            base_row_ids[i] = this->row_name_table.find(NAME);
+            if (base_row_ids[i] < 0 && NAME.size() > SUFFIX.size() &&
+                NAME.substr(NAME.size() - SUFFIX.size()) == SUFFIX) {
+                base_row_ids[i] = this->row_name_table.find(
+                    NAME.substr(0, NAME.size() - SUFFIX.size()));
+            }
+        }
+
+        auto &row_ptrs = this->matrix.row_ptrs;
+        row_ptrs.assign(NUMBER_OF_ROWS + 1, 0);
+        for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+            const int BASE_ROW_ID = base_row_ids[i];
+            row_ptrs[i + 1] =
+                row_ptrs[i] + (BASE_ROW_ID >= 0
+                                   ? base_row_ptrs[BASE_ROW_ID + 1] -
+                                         base_row_ptrs[BASE_ROW_ID]
+                                   : 0);
+        }
+
+        this->matrix.column_ids.resize(row_ptrs.back());
+        this->matrix.values.resize(row_ptrs.back());
+
+        for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+            const int BASE_ROW_ID = base_row_ids[i];
+            if (BASE_ROW_ID < 0) {
+                continue;
+            }
+            const int BEGIN = base_row_ptrs[BASE_ROW_ID];
+            const int END   = base_row_ptrs[BASE_ROW_ID + 1];
+            std::copy(base_column_ids.begin() + BEGIN,
+                      base_column_ids.begin() + END,
+                      this->matrix.column_ids.begin() + row_ptrs[i]);
+            std::copy(base_values.begin() + BEGIN, base_values.begin() + END,
+                      this->matrix.values.begin() + row_ptrs[i]);
+        }
+
+        this->matrix.is_enabled = true;
+    }
+
+    /*************************************************************************/
+    inline void read_mps(const std::string &a_FILE_NAME,                //
+                         const bool         a_IS_ENABLED_PARALLEL = false,  //
+                         const int          a_NUMBER_OF_THREADS   = 1) {
         std::ifstream ifs(a_FILE_NAME, std::ios::binary | std::ios::in);
         if (!ifs) {
             throw std::runtime_error(utility::format_error_location(
@@ -500,23 +914,12 @@ struct MPS {
         std::vector<std::string_view> items;
         items.reserve(8);
 
-        while (pos < SIZE) {
-            std::size_t line_end = pos;
-            while (line_end < SIZE && content[line_end] != '\n' &&
-                   content[line_end] != '\r') {
-                line_end++;
-            }
+        std::vector<MPSColumnsChunk> chunks;
+        std::vector<int>             column_variable_indices;
 
-            const std::size_t LINE_LENGTH = line_end - pos;
-            std::string_view  line_view   = content.substr(pos, LINE_LENGTH);
-
-            pos = line_end;
-            while (pos < SIZE &&
-                   (content[pos] == '\n' || content[pos] == '\r')) {
-                pos++;
-            }
-
-            utility::split_items(line_view, &items);
+        while (pos < SIZE) {
+            const auto LINE_VIEW = this->extract_line(content, &pos);
+            utility::split_items(LINE_VIEW, &items);
 
             if (items.empty()) {
                 continue;
@@ -559,6 +962,12 @@ struct MPS {
                         break;
                     }
                     read_mode = it->second;
+                    if (read_mode == MPSReadMode::Columns &&
+                        a_IS_ENABLED_PARALLEL) {
+                        pos = this->parse_columns_parallel(
+                            content, pos, &variable_sense, a_NUMBER_OF_THREADS,
+                            &chunks, &column_variable_indices);
+                    }
                     continue;
                 }
             }
@@ -619,6 +1028,10 @@ struct MPS {
                 variable.second.integer_upper_bound = 1;
             }
         }
+
+        if (a_IS_ENABLED_PARALLEL) {
+            this->setup_matrix(chunks);
+        }
     }
 };
 }  // namespace printemps::mps
@@ -0,0 +1,148 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MPS_MPS_ACCESSOR_H__
+#define PRINTEMPS_MPS_MPS_ACCESSOR_H__
+
+namespace printemps::mps {
+/*****************************************************************************/
+class MPSAccessor {
+    /**
+     * This class provides index-based access to an MPS instance with the same
+     * interface as MPSSnapshot, so that a model can be built from both of
+     * them by the same procedure. If the MPS instance was read by the
+     * sequential reader, the coefficients are looked up by the variable names.
+     */
+   private:
+    const MPS                                           *m_mps_ptr;
+    std::unordered_map<std::string_view, std::int32_t> m_variable_indices;
+
+   public:
+    /*************************************************************************/
+    MPSAccessor(const MPS &a_MPS) : m_mps_ptr(&a_MPS) {
+        if (!a_MPS.matrix.is_enabled) {
+            const int NUMBER_OF_VARIABLES = a_MPS.variable_names.size();
+            m_variable_indices.reserve(NUMBER_OF_VARIABLES);
+            for (auto i = 0; i < NUMBER_OF_VARIABLES; i++) {
+                m_variable_indices[a_MPS.variable_names[i]] = i;
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline bool is_minimization(void) const noexcept {
+        return m_mps_ptr->objective.is_minimization;
+    }
+
+    /*************************************************************************/
+    inline int number_of_variables(void) const noexcept {
+        return static_cast<int>(m_mps_ptr->variable_names.size());
+    }
+
+    /*************************************************************************/
+    inline int number_of_constraints(void) const noexcept {
+        return static_cast<int>(m_mps_ptr->constraint_names.size());
+    }
+
+    /*************************************************************************/
+    inline std::string_view variable_name(const int a_INDEX) const noexcept {
+        return m_mps_ptr->variable_names[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline std::string_view constraint_name(const int a_INDEX) const noexcept {
+        return m_mps_ptr->constraint_names[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline const MPSVariable &variable(const int a_INDEX) const {
+        return m_mps_ptr->variables.at(m_mps_ptr->variable_names[a_INDEX]);
+    }
+
+    /*************************************************************************/
+    inline const MPSConstraint &constraint(const int a_INDEX) const {
+        return m_mps_ptr->constraints.at(m_mps_ptr->constraint_names[a_INDEX]);
+    }
+
+    /*************************************************************************/
+    inline MPSVariableSense variable_sense(const int a_INDEX) const {
+        return this->variable(a_INDEX).sense;
+    }
+
+    /*************************************************************************/
+    inline int variable_lower_bound(const int a_INDEX) const {
+        return this->variable(a_INDEX).integer_lower_bound;
+    }
+
+    /*************************************************************************/
+    inline int variable_upper_bound(const int a_INDEX) const {
+        return this->variable(a_INDEX).integer_upper_bound;
+    }
+
+    /*************************************************************************/
+    inline int variable_fixed_value(const int a_INDEX) const {
+        return this->variable(a_INDEX).integer_fixed_value;
+    }
+
+    /*************************************************************************/
+    inline bool variable_is_fixed(const int a_INDEX) const {
+        return this->variable(a_INDEX).is_fixed;
+    }
+
+    /*************************************************************************/
+    inline MPSConstraintSense constraint_sense(const int a_INDEX) const {
+        return this->constraint(a_INDEX).sense;
+    }
+
+    /*************************************************************************/
+    inline double constraint_rhs(const int a_INDEX) const {
+        return this->constraint(a_INDEX).rhs;
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_constraint_coefficient(
+        const int a_INDEX, const T_Function &a_FUNCTION) const {
+        const auto &MATRIX = m_mps_ptr->matrix;
+        if (MATRIX.is_enabled) {
+            for (auto j = MATRIX.row_ptrs[a_INDEX];
+                 j < MATRIX.row_ptrs[a_INDEX + 1]; j++) {
+                a_FUNCTION(MATRIX.column_ids[j], MATRIX.values[j]);
+            }
+        } else {
+            for (const auto &sensitivity :
+                 this->constraint(a_INDEX).sensitivities) {
+                a_FUNCTION(m_variable_indices.at(sensitivity.first),
+                           sensitivity.second);
+            }
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_objective_coefficient(
+        const T_Function &a_FUNCTION) const {
+        const auto &MATRIX = m_mps_ptr->matrix;
+        if (MATRIX.is_enabled) {
+            const int NUMBER_OF_OBJECTIVE_NONZEROS =
+                MATRIX.objective_column_ids.size();
+            for (auto j = 0; j < NUMBER_OF_OBJECTIVE_NONZEROS; j++) {
+                a_FUNCTION(MATRIX.objective_column_ids[j],
+                           MATRIX.objective_values[j]);
+            }
+        } else {
+            for (const auto &sensitivity :
+                 m_mps_ptr->objective.sensitivities) {
+                a_FUNCTION(m_variable_indices.at(sensitivity.first),
+                           sensitivity.second);
+            }
+        }
+    }
+};
+}  // namespace printemps::mps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,51 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MPS_MPS_COLUMNS_CHUNK_H__
+#define PRINTEMPS_MPS_MPS_COLUMNS_CHUNK_H__
+
+namespace printemps::mps {
+/*****************************************************************************/
+struct MPSColumnsChunk {
+    /**
+     * This structure holds the result of parsing a chunk of the COLUMNS
+     * section by a worker thread. The column indices of the entries refer to
+     * column_names of the chunk until they are replaced by the interned ids.
+     * The sense of a column is -1 if it is determined by the markers in the
+     * preceding chunks.
+     */
+    std::vector<std::string_view> column_names;
+    std::vector<int>              column_senses;
+
+    std::vector<int>    row_ids;
+    std::vector<int>    column_indices;
+    std::vector<double> values;
+
+    int         last_sense;
+    std::string error_message;
+
+    /*************************************************************************/
+    MPSColumnsChunk(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->column_names.clear();
+        this->column_senses.clear();
+
+        this->row_ids.clear();
+        this->column_indices.clear();
+        this->values.clear();
+
+        this->last_sense = -1;
+        this->error_message.clear();
+    }
+};
+}  // namespace printemps::mps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
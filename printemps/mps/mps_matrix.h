@@ -0,0 +1,60 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MPS_MPS_MATRIX_H__
+#define PRINTEMPS_MPS_MPS_MATRIX_H__
+
+namespace printemps::mps {
+/*****************************************************************************/
+struct MPSMatrix {
+    /**
+     * This structure holds the coefficients of the constraints in the
+     * compressed sparse row (CSR) format and those of the objective function
+     * as a sparse vector. The rows and columns correspond to the indices of
+     * MPS::constraint_names and MPS::variable_names, respectively.
+     */
+    bool is_enabled;
+
+    std::vector<int>    row_ptrs;
+    std::vector<int>    column_ids;
+    std::vector<double> values;
+
+    std::vector<int>    objective_column_ids;
+    std::vector<double> objective_values;
+
+    /*************************************************************************/
+    MPSMatrix(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->is_enabled = false;
+
+        this->row_ptrs.clear();
+        this->column_ids.clear();
+        this->values.clear();
+
+        this->objective_column_ids.clear();
+        this->objective_values.clear();
+    }
+
+    /*************************************************************************/
+    inline int number_of_rows(void) const noexcept {
+        return this->row_ptrs.empty()
+                   ? 0
+                   : static_cast<int>(this->row_ptrs.size()) - 1;
+    }
+
+    /*************************************************************************/
+    inline int number_of_nonzeros(void) const noexcept {
+        return static_cast<int>(this->values.size());
+    }
+};
+}  // namespace printemps::mps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
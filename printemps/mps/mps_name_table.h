@@ -0,0 +1,114 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MPS_MPS_NAME_TABLE_H__
+#define PRINTEMPS_MPS_MPS_NAME_TABLE_H__
+
+namespace printemps::mps {
+/*****************************************************************************/
+struct MPSNameTableConstant {
+    static constexpr std::size_t BLOCK_SIZE = 1 << 20;
+};
+
+/*****************************************************************************/
+class MPSNameTable {
+    /**
+     * This class interns names into arena blocks and assigns sequential
+     * integer ids to them. The interned names are referred by
+     * std::string_view, which remains valid since the blocks are never
+     * reallocated. For the same reason, this class is not copyable.
+     */
+   private:
+    std::vector<std::unique_ptr<char[]>>      m_blocks;
+    std::size_t                               m_block_position;
+    std::size_t                               m_block_capacity;
+    std::unordered_map<std::string_view, int> m_ids;
+    std::vector<std::string_view>             m_names;
+
+    /*************************************************************************/
+    inline std::string_view store(const std::string_view &a_NAME) {
+        const std::size_t SIZE = a_NAME.size();
+        if (m_blocks.empty() || m_block_position + SIZE > m_block_capacity) {
+            m_block_capacity =
+                std::max(MPSNameTableConstant::BLOCK_SIZE, SIZE);
+            m_blocks.emplace_back(std::make_unique<char[]>(m_block_capacity));
+            m_block_position = 0;
+        }
+
+        char *destination = m_blocks.back().get() + m_block_position;
+        std::memcpy(destination, a_NAME.data(), SIZE);
+        m_block_position += SIZE;
+
+        return std::string_view(destination, SIZE);
+    }
+
+   public:
+    /*************************************************************************/
+    MPSNameTable(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    MPSNameTable(const MPSNameTable &) = delete;
+    MPSNameTable &operator=(const MPSNameTable &) = delete;
+    MPSNameTable(MPSNameTable &&)                 = default;
+    MPSNameTable &operator=(MPSNameTable &&) = default;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_blocks.clear();
+        m_block_position = 0;
+        m_block_capacity = 0;
+        m_ids.clear();
+        m_names.clear();
+    }
+
+    /*************************************************************************/
+    inline void reserve(const std::size_t a_SIZE) {
+        m_ids.reserve(a_SIZE);
+        m_names.reserve(a_SIZE);
+    }
+
+    /*************************************************************************/
+    inline std::pair<int, bool> intern(const std::string_view &a_NAME) {
+        const auto IT = m_ids.find(a_NAME);
+        if (IT != m_ids.end()) {
+            return {IT->second, false};
+        }
+
+        const int  ID   = static_cast<int>(m_names.size());
+        const auto NAME = this->store(a_NAME);
+        m_ids.emplace(NAME, ID);
+        m_names.push_back(NAME);
+
+        return {ID, true};
+    }
+
+    /*************************************************************************/
+    inline int find(const std::string_view &a_NAME) const noexcept {
+        const auto IT = m_ids.find(a_NAME);
+        return IT != m_ids.end() ? IT->second : -1;
+    }
+
+    /*************************************************************************/
+    inline const std::string_view &name(const int a_ID) const noexcept {
+        return m_names[a_ID];
+    }
+
+    /*************************************************************************/
+    inline const std::vector<std::string_view> &names(void) const noexcept {
+        return m_names;
+    }
+
+    /*************************************************************************/
+    inline int size(void) const noexcept {
+        return static_cast<int>(m_names.size());
+    }
+};
+}  // namespace printemps::mps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,578 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MPS_MPS_SNAPSHOT_H__
+#define PRINTEMPS_MPS_MPS_SNAPSHOT_H__
+
+namespace printemps::mps {
+/*****************************************************************************/
+struct MPSSnapshotConstant {
+    static constexpr char          MAGIC[8]  = {'P', 'R', 'T', 'M',
+                                                'S', 'N', 'A', 'P'};
+    static constexpr std::uint32_t VERSION   = 1;
+    static constexpr std::size_t   ALIGNMENT = 8;
+};
+
+/*****************************************************************************/
+struct MPSSnapshotHeader {
+    /**
+     * The header is followed by the sections below, each of which is aligned
+     * to MPSSnapshotConstant::ALIGNMENT bytes:
+     *  - variable senses, lower bounds, upper bounds, fixed values (int32),
+     *    and fixed flags (uint8),
+     *  - constraint senses (int32) and right-hand sides (double),
+     *  - row pointers, column ids (int32), and values (double) of the CSR
+     *    coefficient matrix,
+     *  - column ids (int32) and values (double) of the objective function,
+     *  - offsets (uint64) and bytes of the names, in the order of the
+     *    instance name, the objective name, the variable names, and the
+     *    constraint names.
+     */
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t is_minimization;
+    std::uint64_t number_of_variables;
+    std::uint64_t number_of_constraints;
+    std::uint64_t number_of_nonzeros;
+    std::uint64_t number_of_objective_nonzeros;
+    std::uint64_t number_of_name_bytes;
+};
+
+/*****************************************************************************/
+class MPSSnapshot {
+    /**
+     * This class provides read-only access to a binary snapshot of an MPS
+     * instance. The snapshot is mapped into memory and the arrays are referred
+     * to directly without copying. The snapshot holds the instance as parsed
+     * from the MPS file, so that loading it skips only the parsing.
+     */
+   private:
+    utility::MemoryMappedFile m_file;
+    MPSSnapshotHeader         m_header;
+
+    const std::int32_t  *m_variable_senses;
+    const std::int32_t  *m_variable_lower_bounds;
+    const std::int32_t  *m_variable_upper_bounds;
+    const std::int32_t  *m_variable_fixed_values;
+    const std::uint8_t  *m_variable_is_fixed;
+    const std::int32_t  *m_constraint_senses;
+    const double        *m_constraint_rhs;
+    const std::int32_t  *m_row_ptrs;
+    const std::int32_t  *m_column_ids;
+    const double        *m_values;
+    const std::int32_t  *m_objective_column_ids;
+    const double        *m_objective_values;
+    const std::uint64_t *m_name_offsets;
+    const char          *m_name_bytes;
+
+    /*************************************************************************/
+    static inline std::size_t align(const std::size_t a_SIZE) noexcept {
+        constexpr std::size_t ALIGNMENT = MPSSnapshotConstant::ALIGNMENT;
+        return (a_SIZE + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    /*************************************************************************/
+    template <class T>
+    static inline void write_section(std::ofstream        &a_ofs,
+                                     const std::vector<T> &a_VALUES) {
+        const std::size_t SIZE = sizeof(T) * a_VALUES.size();
+        const char        PADDING[MPSSnapshotConstant::ALIGNMENT] = {};
+
+        a_ofs.write(reinterpret_cast<const char *>(a_VALUES.data()), SIZE);
+        a_ofs.write(PADDING, align(SIZE) - SIZE);
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline const T *map_section(std::size_t      *a_offset_ptr,
+                                const std::size_t a_COUNT) {
+        const std::size_t OFFSET = *a_offset_ptr;
+        *a_offset_ptr += align(sizeof(T) * a_COUNT);
+        return reinterpret_cast<const T *>(m_file.data() + OFFSET);
+    }
+
+   public:
+    /*************************************************************************/
+    MPSSnapshot(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    MPSSnapshot(const std::string &a_FILE_NAME) {
+        this->initialize();
+        this->read(a_FILE_NAME);
+    }
+
+    /*************************************************************************/
+    MPSSnapshot(const MPSSnapshot &) = delete;
+    MPSSnapshot &operator=(const MPSSnapshot &) = delete;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_file.close();
+        std::memset(&m_header, 0, sizeof(m_header));
+
+        m_variable_senses       = nullptr;
+        m_variable_lower_bounds = nullptr;
+        m_variable_upper_bounds = nullptr;
+        m_variable_fixed_values = nullptr;
+        m_variable_is_fixed     = nullptr;
+        m_constraint_senses     = nullptr;
+        m_constraint_rhs        = nullptr;
+        m_row_ptrs              = nullptr;
+        m_column_ids            = nullptr;
+        m_values                = nullptr;
+        m_objective_column_ids  = nullptr;
+        m_objective_values      = nullptr;
+        m_name_offsets          = nullptr;
+        m_name_bytes            = nullptr;
+    }
+
+    /*************************************************************************/
+    static inline void write(const MPS &a_MPS, const std::string &a_FILE_NAME) {
+        const std::size_t NUMBER_OF_VARIABLES   = a_MPS.variable_names.size();
+        const std::size_t NUMBER_OF_CONSTRAINTS = a_MPS.constraint_names.size();
+
+        /**
+         * Variables.
+         */
+        std::vector<std::int32_t> variable_senses(NUMBER_OF_VARIABLES);
+        std::vector<std::int32_t> variable_lower_bounds(NUMBER_OF_VARIABLES);
+        std::vector<std::int32_t> variable_upper_bounds(NUMBER_OF_VARIABLES);
+        std::vector<std::int32_t> variable_fixed_values(NUMBER_OF_VARIABLES);
+        std::vector<std::uint8_t> variable_is_fixed(NUMBER_OF_VARIABLES);
+
+        std::unordered_map<std::string_view, std::int32_t> variable_indices;
+        variable_indices.reserve(NUMBER_OF_VARIABLES);
+
+        for (std::size_t i = 0; i < NUMBER_OF_VARIABLES; i++) {
+            const auto &VARIABLE_NAME = a_MPS.variable_names[i];
+            const auto &VARIABLE      = a_MPS.variables.at(VARIABLE_NAME);
+            variable_senses[i]       = static_cast<std::int32_t>(VARIABLE.sense);
+            variable_lower_bounds[i] = VARIABLE.integer_lower_bound;
+            variable_upper_bounds[i] = VARIABLE.integer_upper_bound;
+            variable_fixed_values[i] = VARIABLE.integer_fixed_value;
+            variable_is_fixed[i]     = VARIABLE.is_fixed;
+            variable_indices[VARIABLE_NAME] = static_cast<std::int32_t>(i);
+        }
+
+        /**
+         * Constraints.
+         */
+        std::vector<std::int32_t> constraint_senses(NUMBER_OF_CONSTRAINTS);
+        std::vector<double>       constraint_rhs(NUMBER_OF_CONSTRAINTS);
+        for (std::size_t i = 0; i < NUMBER_OF_CONSTRAINTS; i++) {
+            const auto &CONSTRAINT =
+                a_MPS.constraints.at(a_MPS.constraint_names[i]);
+            constraint_senses[i] = static_cast<std::int32_t>(CONSTRAINT.sense);
+            constraint_rhs[i]    = CONSTRAINT.rhs;
+        }
+
+        /**
+         * Coefficients. If the MPS file was read by the sequential reader, the
+         * CSR matrix is built from the sensitivities.
+         */
+        std::vector<std::int32_t> row_ptrs;
+        std::vector<std::int32_t> column_ids;
+        std::vector<double>       values;
+        std::vector<std::int32_t> objective_column_ids;
+        std::vector<double>       objective_values;
+
+        if (a_MPS.matrix.is_enabled) {
+            row_ptrs.assign(a_MPS.matrix.row_ptrs.begin(),
+                            a_MPS.matrix.row_ptrs.end());
+            column_ids.assign(a_MPS.matrix.column_ids.begin(),
+                              a_MPS.matrix.column_ids.end());
+            values               = a_MPS.matrix.values;
+            objective_column_ids.assign(
+                a_MPS.matrix.objective_column_ids.begin(),
+                a_MPS.matrix.objective_column_ids.end());
+            objective_values = a_MPS.matrix.objective_values;
+        } else {
+            row_ptrs.reserve(NUMBER_OF_CONSTRAINTS + 1);
+            row_ptrs.push_back(0);
+            for (const auto &CONSTRAINT_NAME : a_MPS.constraint_names) {
+                const auto &CONSTRAINT = a_MPS.constraints.at(CONSTRAINT_NAME);
+                for (const auto &sensitivity : CONSTRAINT.sensitivities) {
+                    column_ids.push_back(variable_indices.at(sensitivity.first));
+                    values.push_back(sensitivity.second);
+                }
+                row_ptrs.push_back(static_cast<std::int32_t>(values.size()));
+            }
+            for (const auto &sensitivity : a_MPS.objective.sensitivities) {
+                objective_column_ids.push_back(
+                    variable_indices.at(sensitivity.first));
+                objective_values.push_back(sensitivity.second);
+            }
+        }
+
+        /**
+         * Names.
+         */
+        std::vector<std::uint64_t> name_offsets;
+        std::vector<char>          name_bytes;
+        name_offsets.reserve(NUMBER_OF_VARIABLES + NUMBER_OF_CONSTRAINTS + 3);
+
+        const auto append_name = [&name_offsets,
+                                  &name_bytes](const std::string &a_NAME) {
+            name_offsets.push_back(name_bytes.size());
+            name_bytes.insert(name_bytes.end(), a_NAME.begin(), a_NAME.end());
+        };
+
+        append_name(a_MPS.name);
+        append_name(a_MPS.objective.name);
+        for (const auto &VARIABLE_NAME : a_MPS.variable_names) {
+            append_name(VARIABLE_NAME);
+        }
+        for (const auto &CONSTRAINT_NAME : a_MPS.constraint_names) {
+            append_name(CONSTRAINT_NAME);
+        }
+        name_offsets.push_back(name_bytes.size());
+
+        /**
+         * Write the header and the sections.
+         */
+        MPSSnapshotHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, MPSSnapshotConstant::MAGIC,
+                    sizeof(header.magic));
+        header.version             = MPSSnapshotConstant::VERSION;
+        header.is_minimization     = a_MPS.objective.is_minimization;
+        header.number_of_variables = NUMBER_OF_VARIABLES;
+        header.number_of_constraints        = NUMBER_OF_CONSTRAINTS;
+        header.number_of_nonzeros           = values.size();
+        header.number_of_objective_nonzeros = objective_values.size();
+        header.number_of_name_bytes         = name_bytes.size();
+
+        std::ofstream ofs(a_FILE_NAME, std::ios::binary | std::ios::out);
+        if (!ofs) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Cannot open the specified file: " + a_FILE_NAME));
+        }
+
+        ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        write_section(ofs, variable_senses);
+        write_section(ofs, variable_lower_bounds);
+        write_section(ofs, variable_upper_bounds);
+        write_section(ofs, variable_fixed_values);
+        write_section(ofs, variable_is_fixed);
+        write_section(ofs, constraint_senses);
+        write_section(ofs, constraint_rhs);
+        write_section(ofs, row_ptrs);
+        write_section(ofs, column_ids);
+        write_section(ofs, values);
+        write_section(ofs, objective_column_ids);
+        write_section(ofs, objective_values);
+        write_section(ofs, name_offsets);
+        write_section(ofs, name_bytes);
+
+        if (!ofs) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Failed to write the snapshot file: " + a_FILE_NAME));
+        }
+    }
+
+    /*************************************************************************/
+    inline void read(const std::string &a_FILE_NAME) {
+        this->initialize();
+        m_file.open(a_FILE_NAME);
+
+        if (m_file.size() < sizeof(MPSSnapshotHeader)) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The snapshot file is truncated: " + a_FILE_NAME));
+        }
+
+        std::memcpy(&m_header, m_file.data(), sizeof(m_header));
+        if (std::memcmp(m_header.magic, MPSSnapshotConstant::MAGIC,
+                        sizeof(m_header.magic)) != 0) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The specified file is not a snapshot file: " + a_FILE_NAME));
+        }
+        if (m_header.version != MPSSnapshotConstant::VERSION) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The version of the snapshot file is not supported: " +
+                    std::to_string(m_header.version)));
+        }
+
+        const std::size_t NUMBER_OF_VARIABLES = m_header.number_of_variables;
+        const std::size_t NUMBER_OF_CONSTRAINTS =
+            m_header.number_of_constraints;
+        const std::size_t NUMBER_OF_NONZEROS = m_header.number_of_nonzeros;
+        const std::size_t NUMBER_OF_OBJECTIVE_NONZEROS =
+            m_header.number_of_objective_nonzeros;
+        const std::size_t NUMBER_OF_NAMES =
+            NUMBER_OF_VARIABLES + NUMBER_OF_CONSTRAINTS + 2;
+
+        /**
+         * Every element occupies at least one byte, so the counts larger than
+         * the file size are broken. This also prevents the expected size
+         * below from overflowing.
+         */
+        const std::size_t FILE_SIZE = m_file.size();
+        if (NUMBER_OF_VARIABLES > FILE_SIZE ||
+            NUMBER_OF_CONSTRAINTS > FILE_SIZE ||
+            NUMBER_OF_NONZEROS > FILE_SIZE ||
+            NUMBER_OF_OBJECTIVE_NONZEROS > FILE_SIZE ||
+            m_header.number_of_name_bytes > FILE_SIZE) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The snapshot file is broken: " + a_FILE_NAME));
+        }
+
+        const std::size_t EXPECTED_SIZE =
+            align(sizeof(MPSSnapshotHeader)) +
+            4 * align(sizeof(std::int32_t) * NUMBER_OF_VARIABLES) +
+            align(sizeof(std::uint8_t) * NUMBER_OF_VARIABLES) +
+            align(sizeof(std::int32_t) * NUMBER_OF_CONSTRAINTS) +
+            align(sizeof(double) * NUMBER_OF_CONSTRAINTS) +
+            align(sizeof(std::int32_t) * (NUMBER_OF_CONSTRAINTS + 1)) +
+            align(sizeof(std::int32_t) * NUMBER_OF_NONZEROS) +
+            align(sizeof(double) * NUMBER_OF_NONZEROS) +
+            align(sizeof(std::int32_t) * NUMBER_OF_OBJECTIVE_NONZEROS) +
+            align(sizeof(double) * NUMBER_OF_OBJECTIVE_NONZEROS) +
+            align(sizeof(std::uint64_t) * (NUMBER_OF_NAMES + 1)) +
+            align(m_header.number_of_name_bytes);
+
+        if (m_file.size() != EXPECTED_SIZE) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The snapshot file is broken: " + a_FILE_NAME));
+        }
+
+        std::size_t offset = align(sizeof(MPSSnapshotHeader));
+
+        m_variable_senses = map_section<std::int32_t>(&offset,  //
+                                                      NUMBER_OF_VARIABLES);
+        m_variable_lower_bounds =
+            map_section<std::int32_t>(&offset, NUMBER_OF_VARIABLES);
+        m_variable_upper_bounds =
+            map_section<std::int32_t>(&offset, NUMBER_OF_VARIABLES);
+        m_variable_fixed_values =
+            map_section<std::int32_t>(&offset, NUMBER_OF_VARIABLES);
+        m_variable_is_fixed =
+            map_section<std::uint8_t>(&offset, NUMBER_OF_VARIABLES);
+        m_constraint_senses =
+            map_section<std::int32_t>(&offset, NUMBER_OF_CONSTRAINTS);
+        m_constraint_rhs = map_section<double>(&offset, NUMBER_OF_CONSTRAINTS);
+        m_row_ptrs =
+            map_section<std::int32_t>(&offset, NUMBER_OF_CONSTRAINTS + 1);
+        m_column_ids = map_section<std::int32_t>(&offset, NUMBER_OF_NONZEROS);
+        m_values     = map_section<double>(&offset, NUMBER_OF_NONZEROS);
+        m_objective_column_ids =
+            map_section<std::int32_t>(&offset, NUMBER_OF_OBJECTIVE_NONZEROS);
+        m_objective_values =
+            map_section<double>(&offset, NUMBER_OF_OBJECTIVE_NONZEROS);
+        m_name_offsets =
+            map_section<std::uint64_t>(&offset, NUMBER_OF_NAMES + 1);
+        m_name_bytes = map_section<char>(&offset, m_header.number_of_name_bytes);
+
+        this->validate(a_FILE_NAME);
+    }
+
+    /*************************************************************************/
+    inline void validate(const std::string &a_FILE_NAME) const {
+        /**
+         * The arrays referred to as indices are verified here once, so that
+         * a broken snapshot file does not cause out-of-bounds accesses.
+         */
+        const std::int64_t NUMBER_OF_VARIABLES = m_header.number_of_variables;
+        const std::size_t  NUMBER_OF_CONSTRAINTS =
+            m_header.number_of_constraints;
+        const std::size_t NUMBER_OF_NONZEROS = m_header.number_of_nonzeros;
+        const std::size_t NUMBER_OF_OBJECTIVE_NONZEROS =
+            m_header.number_of_objective_nonzeros;
+        const std::size_t NUMBER_OF_NAMES =
+            m_header.number_of_variables + NUMBER_OF_CONSTRAINTS + 2;
+
+        const auto is_valid_column_id =
+            [NUMBER_OF_VARIABLES](const std::int32_t a_COLUMN_ID) {
+                return a_COLUMN_ID >= 0 && a_COLUMN_ID < NUMBER_OF_VARIABLES;
+            };
+
+        std::string broken_section;
+
+        if (m_row_ptrs[0] != 0 ||
+            static_cast<std::size_t>(m_row_ptrs[NUMBER_OF_CONSTRAINTS]) !=
+                NUMBER_OF_NONZEROS) {
+            broken_section = "row pointers";
+        }
+        for (std::size_t i = 0; i < NUMBER_OF_CONSTRAINTS; i++) {
+            if (m_row_ptrs[i] > m_row_ptrs[i + 1]) {
+                broken_section = "row pointers";
+                break;
+            }
+        }
+
+        for (std::size_t j = 0; j < NUMBER_OF_NONZEROS; j++) {
+            if (!is_valid_column_id(m_column_ids[j])) {
+                broken_section = "column ids";
+                break;
+            }
+        }
+
+        for (std::size_t j = 0; j < NUMBER_OF_OBJECTIVE_NONZEROS; j++) {
+            if (!is_valid_column_id(m_objective_column_ids[j])) {
+                broken_section = "objective column ids";
+                break;
+            }
+        }
+
+        if (m_name_offsets[0] != 0 ||
+            m_name_offsets[NUMBER_OF_NAMES] != m_header.number_of_name_bytes) {
+            broken_section = "name offsets";
+        }
+        for (std::size_t i = 0; i < NUMBER_OF_NAMES; i++) {
+            if (m_name_offsets[i] > m_name_offsets[i + 1]) {
+                broken_section = "name offsets";
+                break;
+            }
+        }
+
+        if (!broken_section.empty()) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The snapshot file is broken in " + broken_section + ": " +
+                    a_FILE_NAME));
+        }
+    }
+
+    /*************************************************************************/
+    inline std::string_view name_at(const std::size_t a_INDEX) const noexcept {
+        return std::string_view(
+            m_name_bytes + m_name_offsets[a_INDEX],
+            m_name_offsets[a_INDEX + 1] - m_name_offsets[a_INDEX]);
+    }
+
+    /*************************************************************************/
+    inline std::string_view name(void) const noexcept {
+        return this->name_at(0);
+    }
+
+    /*************************************************************************/
+    inline std::string_view objective_name(void) const noexcept {
+        return this->name_at(1);
+    }
+
+    /*************************************************************************/
+    inline std::string_view variable_name(const int a_INDEX) const noexcept {
+        return this->name_at(2 + a_INDEX);
+    }
+
+    /*************************************************************************/
+    inline std::string_view constraint_name(const int a_INDEX) const noexcept {
+        return this->name_at(2 + m_header.number_of_variables + a_INDEX);
+    }
+
+    /*************************************************************************/
+    inline bool is_minimization(void) const noexcept {
+        return m_header.is_minimization != 0;
+    }
+
+    /*************************************************************************/
+    inline int number_of_variables(void) const noexcept {
+        return static_cast<int>(m_header.number_of_variables);
+    }
+
+    /*************************************************************************/
+    inline int number_of_constraints(void) const noexcept {
+        return static_cast<int>(m_header.number_of_constraints);
+    }
+
+    /*************************************************************************/
+    inline int number_of_objective_nonzeros(void) const noexcept {
+        return static_cast<int>(m_header.number_of_objective_nonzeros);
+    }
+
+    /*************************************************************************/
+    inline MPSVariableSense variable_sense(const int a_INDEX) const noexcept {
+        return static_cast<MPSVariableSense>(m_variable_senses[a_INDEX]);
+    }
+
+    /*************************************************************************/
+    inline int variable_lower_bound(const int a_INDEX) const noexcept {
+        return m_variable_lower_bounds[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline int variable_upper_bound(const int a_INDEX) const noexcept {
+        return m_variable_upper_bounds[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline int variable_fixed_value(const int a_INDEX) const noexcept {
+        return m_variable_fixed_values[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline bool variable_is_fixed(const int a_INDEX) const noexcept {
+        return m_variable_is_fixed[a_INDEX] != 0;
+    }
+
+    /*************************************************************************/
+    inline MPSConstraintSense constraint_sense(const int a_INDEX) const
+        noexcept {
+        return static_cast<MPSConstraintSense>(m_constraint_senses[a_INDEX]);
+    }
+
+    /*************************************************************************/
+    inline double constraint_rhs(const int a_INDEX) const noexcept {
+        return m_constraint_rhs[a_INDEX];
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_constraint_coefficient(
+        const int a_INDEX, const T_Function &a_FUNCTION) const {
+        for (auto j = m_row_ptrs[a_INDEX]; j < m_row_ptrs[a_INDEX + 1]; j++) {
+            a_FUNCTION(m_column_ids[j], m_values[j]);
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_objective_coefficient(
+        const T_Function &a_FUNCTION) const {
+        const int NUMBER_OF_OBJECTIVE_NONZEROS =
+            m_header.number_of_objective_nonzeros;
+        for (auto j = 0; j < NUMBER_OF_OBJECTIVE_NONZEROS; j++) {
+            a_FUNCTION(m_objective_column_ids[j], m_objective_values[j]);
+        }
+    }
+
+    /*************************************************************************/
+    inline const std::int32_t *row_ptrs(void) const noexcept {
+        return m_row_ptrs;
+    }
+
+    /*************************************************************************/
+    inline const std::int32_t *column_ids(void) const noexcept {
+        return m_column_ids;
+    }
+
+    /*************************************************************************/
+    inline const double *values(void) const noexcept {
+        return m_values;
+    }
+
+    /*************************************************************************/
+    inline const std::int32_t *objective_column_ids(void) const noexcept {
+        return m_objective_column_ids;
+    }
+
+    /*************************************************************************/
+    inline const double *objective_values(void) const noexcept {
+        return m_objective_values;
+    }
+};
+}  // namespace printemps::mps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
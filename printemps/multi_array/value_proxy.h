@@ -351,6 +351,75 @@ utility::json::JsonObject create_json_array(
     str += "}";
     return utility::json::parse_json_object(str);
 }
+
+/*****************************************************************************/
+template <class T_Value>
+void write_json_object(
+    utility::json::JsonWriter *a_writer_ptr,
+    const std::unordered_map<std::string, ValueProxy<T_Value>>
+        &a_VALUE_PROXIES) {
+    /**
+     * NOTE: This function streams the same content as create_json_object()
+     * without building an intermediate JSON object.
+     */
+    a_writer_ptr->begin_object();
+    for (const auto &item : a_VALUE_PROXIES) {
+        auto &    proxy              = item.second;
+        const int NUMBER_OF_ELEMENTS = proxy.number_of_elements();
+        for (auto i = 0; i < NUMBER_OF_ELEMENTS; i++) {
+            a_writer_ptr->member(proxy.flat_indexed_names(i),
+                                 proxy.flat_indexed_values(i));
+        }
+    }
+    a_writer_ptr->end_object();
+}
+
+/*****************************************************************************/
+template <class T_Value>
+void write_json_array(
+    utility::json::JsonWriter *a_writer_ptr,
+    const std::unordered_map<std::string, ValueProxy<T_Value>>
+        &a_VALUE_PROXIES) {
+    /**
+     * NOTE: This function streams the same content as create_json_array()
+     * without building an intermediate JSON object. Nested arrays are opened
+     * and closed according to the multi-dimensional index of each element.
+     */
+    a_writer_ptr->begin_object();
+    for (const auto &item : a_VALUE_PROXIES) {
+        auto &    proxy                = item.second;
+        const int NUMBER_OF_ELEMENTS   = proxy.number_of_elements();
+        const int NUMBER_OF_DIMENSIONS = proxy.number_of_dimensions();
+        int       dimension            = 0;
+
+        a_writer_ptr->key(item.first);
+        a_writer_ptr->begin_array();
+        for (auto i = 0; i < NUMBER_OF_ELEMENTS; i++) {
+            const auto INDEX = proxy.multi_dimensional_index(i);
+            for (auto j = dimension; j < NUMBER_OF_DIMENSIONS - 1; j++) {
+                if (INDEX[j + 1] == 0) {
+                    a_writer_ptr->begin_array();
+                    dimension++;
+                } else {
+                    break;
+                }
+            }
+
+            a_writer_ptr->value(proxy.flat_indexed_values(i));
+
+            for (auto j = dimension; j > 0; j--) {
+                if (INDEX[j] == proxy.shape()[j] - 1) {
+                    a_writer_ptr->end_array();
+                    dimension--;
+                } else {
+                    break;
+                }
+            }
+        }
+        a_writer_ptr->end_array();
+    }
+    a_writer_ptr->end_object();
+}
 }  // namespace printemps::multi_array
 #endif
 
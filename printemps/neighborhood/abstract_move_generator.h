@@ -18,7 +18,9 @@ class AbstractMoveGenerator {
 
     std::vector<Move<T_Variable, T_Expression>> m_moves;
     std::vector<short>                          m_flags;
-    bool                                        m_is_enabled;
+    RelatedConstraintPtrsPool<T_Variable, T_Expression>
+         m_related_constraint_ptrs_pool;
+    bool m_is_enabled;
 
    public:
     /*************************************************************************/
@@ -37,6 +39,7 @@ class AbstractMoveGenerator {
                             const int) {};
         m_moves.clear();
         m_flags.clear();
+        m_related_constraint_ptrs_pool.initialize();
         m_is_enabled = false;
     }
 
@@ -93,6 +96,12 @@ class AbstractMoveGenerator {
         m_flags = a_FLAGS;
     }
 
+    /*************************************************************************/
+    inline const RelatedConstraintPtrsPool<T_Variable, T_Expression>
+        &related_constraint_ptrs_pool(void) const {
+        return m_related_constraint_ptrs_pool;
+    }
+
     /*************************************************************************/
     inline bool is_enabled(void) const {
         return m_is_enabled;
@@ -130,6 +139,85 @@ extract_mutable_variable_ptrs(
     return results;
 }
 
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+inline std::vector<int> create_variable_id_to_index_map(
+    const std::vector<model_component::Variable<T_Variable, T_Expression> *>
+        &a_VARIABLE_PTRS) {
+    /**
+     * This function returns the map from the variable ids to the indices in
+     * the specified list, where -1 means that the variable is not included.
+     * An empty map is returned if the ids have not been assigned uniquely.
+     */
+    int max_id = -1;
+    for (const auto &variable_ptr : a_VARIABLE_PTRS) {
+        max_id = std::max(max_id, variable_ptr->id());
+    }
+
+    std::vector<int> indices(max_id + 1, -1);
+    const int        VARIABLES_SIZE = a_VARIABLE_PTRS.size();
+    for (auto i = 0; i < VARIABLES_SIZE; i++) {
+        const auto ID = a_VARIABLE_PTRS[i]->id();
+        if (ID < 0 || indices[ID] >= 0) {
+            return {};
+        }
+        indices[ID] = i;
+    }
+    return indices;
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression, class T_Function>
+inline bool for_each_improvable_variable_index(
+    const std::vector<model_component::Variable<T_Variable, T_Expression> *>
+                           &a_VARIABLE_PTRS,                  //
+    const std::vector<int> &a_VARIABLE_INDICES,               //
+    const bool              a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
+    const bool              a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
+#ifdef _OPENMP
+    const bool a_IS_ENABLED_PARALLEL,  //
+    const int  a_NUMBER_OF_THREADS,    //
+#else
+    [[maybe_unused]] const bool a_IS_ENABLED_PARALLEL,  //
+    [[maybe_unused]] const int  a_NUMBER_OF_THREADS,    //
+#endif
+    const T_Function &a_FUNCTION) {
+    /**
+     * This function calls the specified function with the index of each
+     * improvable variable in the list, by scanning the improvability table
+     * word by word instead of testing the variables one by one. It returns
+     * false without any call if the variables are not attached to a table.
+     */
+    if (a_VARIABLE_PTRS.empty() || a_VARIABLE_INDICES.empty()) {
+        return false;
+    }
+
+    const auto TABLE_PTR = a_VARIABLE_PTRS.front()->improvability_table_ptr();
+    const int  INDICES_SIZE = a_VARIABLE_INDICES.size();
+    if (TABLE_PTR == nullptr ||
+        TABLE_PTR->number_of_variables() < INDICES_SIZE) {
+        return false;
+    }
+
+    const int WORDS_SIZE = TABLE_PTR->number_of_words();
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static) \
+    num_threads(a_NUMBER_OF_THREADS)
+#endif
+    for (auto i = 0; i < WORDS_SIZE; i++) {
+        utility::Bitset::for_each_set_bit(
+            TABLE_PTR->improvable_word(i, a_ACCEPT_OBJECTIVE_IMPROVABLE,
+                                       a_ACCEPT_FEASIBILITY_IMPROVABLE),
+            i << 6,
+            [&a_VARIABLE_INDICES, &a_FUNCTION, INDICES_SIZE](const int a_ID) {
+                if (a_ID < INDICES_SIZE && a_VARIABLE_INDICES[a_ID] >= 0) {
+                    a_FUNCTION(a_VARIABLE_INDICES[a_ID]);
+                }
+            });
+    }
+    return true;
+}
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 inline std::vector<model_component::Constraint<T_Variable, T_Expression> *>
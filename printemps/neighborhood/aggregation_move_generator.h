@@ -41,6 +41,7 @@ class AggregationMoveGenerator
         const int BINOMIALS_SIZE = binomials.size();
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
 
         this->m_moves.resize(4 * BINOMIALS_SIZE);
         this->m_flags.resize(4 * BINOMIALS_SIZE);
@@ -56,25 +57,9 @@ class AggregationMoveGenerator
             move.is_available                 = true;
             move.overlap_rate                 = 0.0;
 
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                binomials[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .begin(),
-                binomials[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .end());
-
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                binomials[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .begin(),
-                binomials[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .end());
-
-            move.sort_and_unique_related_constraint_ptrs();
+            move.related_constraint_ptrs =
+                this->m_related_constraint_ptrs_pool.store_union(
+                    move.alterations);
 
             this->m_moves[4 * i + 1] = move;
             this->m_moves[4 * i + 2] = move;
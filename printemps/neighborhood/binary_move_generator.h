@@ -62,11 +62,14 @@ class BinaryMoveGenerator
                 mutable_variable_ptrs[i]->related_constraint_ptrs();
         }
 
+        const auto VARIABLE_INDICES =
+            create_variable_id_to_index_map(mutable_variable_ptrs);
+
         /**
          * Setup move updater.
          */
         auto move_updater =  //
-            [mutable_variable_ptrs, VARIABLES_SIZE](
+            [mutable_variable_ptrs, VARIABLE_INDICES, VARIABLES_SIZE](
                 auto *     a_moves_ptr,                      //
                 auto *     a_flags,                          //
                 const bool a_ACCEPT_ALL,                     //
@@ -93,6 +96,33 @@ class BinaryMoveGenerator
                     return;
                 }
 
+                /**
+                 * If the variables are attached to an improvability table,
+                 * only the improvable variables are visited. As in the loops
+                 * below, both improvabilities are accepted if neither is
+                 * specified.
+                 */
+                std::fill(a_flags->begin(), a_flags->end(), 0);
+                if (for_each_improvable_variable_index(
+                        mutable_variable_ptrs,            //
+                        VARIABLE_INDICES,                 //
+                        a_ACCEPT_OBJECTIVE_IMPROVABLE ||
+                            !a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
+                        a_ACCEPT_FEASIBILITY_IMPROVABLE ||
+                            !a_ACCEPT_OBJECTIVE_IMPROVABLE,  //
+                        a_IS_ENABLED_PARALLEL,            //
+                        a_NUMBER_OF_THREADS,              //
+                        [&mutable_variable_ptrs, a_moves_ptr,
+                         a_flags](const int a_INDEX) {
+                            (*a_moves_ptr)[a_INDEX]
+                                .alterations.front()
+                                .second = 1 - mutable_variable_ptrs[a_INDEX]
+                                                  ->value();
+                            (*a_flags)[a_INDEX] = 1;
+                        })) {
+                    return;
+                }
+
                 if (a_ACCEPT_OBJECTIVE_IMPROVABLE &&
                     !a_ACCEPT_FEASIBILITY_IMPROVABLE) {
 #ifdef _OPENMP
@@ -14,6 +14,30 @@ template <class T_Variable, class T_Expression>
 class ChainMoveGenerator
     : public AbstractMoveGenerator<T_Variable, T_Expression> {
    private:
+    /*************************************************************************/
+    inline void compact_related_constraint_ptrs_pool(void) {
+        /**
+         * The related constraints of removed moves are left in the pool. The
+         * pool is rebuilt if it is more than twice as large as the related
+         * constraints of the remaining moves.
+         */
+        std::size_t size = 0;
+        for (const auto &move : this->m_moves) {
+            size += move.related_constraint_ptrs.size();
+        }
+        if (this->m_related_constraint_ptrs_pool.size() <= 2 * size) {
+            return;
+        }
+
+        RelatedConstraintPtrsPool<T_Variable, T_Expression> pool;
+        for (auto &&move : this->m_moves) {
+            move.related_constraint_ptrs =
+                pool.store(move.related_constraint_ptrs.begin(),
+                           move.related_constraint_ptrs.end());
+        }
+        this->m_related_constraint_ptrs_pool = std::move(pool);
+    }
+
    public:
     /*************************************************************************/
     ChainMoveGenerator(void) {
@@ -83,12 +107,25 @@ class ChainMoveGenerator
     inline void register_move(const Move<T_Variable, T_Expression> &a_MOVE) {
         this->m_moves.push_back(a_MOVE);
         this->m_flags.resize(this->m_moves.size());
+
+        /**
+         * A move composed by operator+() has no related constraints. They are
+         * stored in the pool here. A move which already refers to a stored
+         * range (e.g. the backward move of a registered move) shares it.
+         */
+        auto &move = this->m_moves.back();
+        if (move.related_constraint_ptrs.empty()) {
+            move.related_constraint_ptrs =
+                this->m_related_constraint_ptrs_pool.store_union(
+                    move.alterations);
+        }
     }
 
     /*************************************************************************/
     inline void clear_moves() {
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
     }
 
     /*************************************************************************/
@@ -97,6 +134,7 @@ class ChainMoveGenerator
                                         this->m_moves.end()),
                             this->m_moves.end());
         this->m_flags.resize(this->m_moves.size());
+        this->compact_related_constraint_ptrs_pool();
     }
 
     /*************************************************************************/
@@ -198,6 +236,7 @@ class ChainMoveGenerator
 
         this->m_moves.resize(a_NUMBER_OF_MOVES);
         this->m_flags.resize(a_NUMBER_OF_MOVES);
+        this->compact_related_constraint_ptrs_pool();
     }
 
     /*************************************************************************/
@@ -208,6 +247,7 @@ class ChainMoveGenerator
                 [](const auto &a_MOVE) { return a_MOVE.has_fixed_variable(); }),
             this->m_moves.end());
         this->m_flags.resize(this->m_moves.size());
+        this->compact_related_constraint_ptrs_pool();
     }
 };
 }  // namespace printemps::neighborhood
@@ -42,6 +42,7 @@ class ConstantSumIntegersMoveGenerator
 
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
 
         this->m_moves.resize(2 * BINOMIALS_SIZE);
         this->m_flags.resize(2 * BINOMIALS_SIZE);
@@ -59,25 +60,9 @@ class ConstantSumIntegersMoveGenerator
             move.is_available                 = true;
             move.overlap_rate                 = 0.0;
 
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                binomials[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .begin(),
-                binomials[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .end());
-
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                binomials[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .begin(),
-                binomials[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .end());
-
-            move.sort_and_unique_related_constraint_ptrs();
+            move.related_constraint_ptrs =
+                this->m_related_constraint_ptrs_pool.store_union(
+                    move.alterations);
 
             constant_values[i] =
                 constraint_ptrs[i]->expression().constant_value();
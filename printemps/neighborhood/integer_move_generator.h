@@ -67,11 +67,14 @@ class IntegerMoveGenerator
             this->m_moves[4 * i + 3] = move;
         }
 
+        const auto VARIABLE_INDICES =
+            create_variable_id_to_index_map(mutable_variable_ptrs);
+
         /**
          * Setup move updater.
          */
         auto move_updater =  //
-            [mutable_variable_ptrs, VARIABLES_SIZE](
+            [mutable_variable_ptrs, VARIABLE_INDICES, VARIABLES_SIZE](
                 auto *     a_moves_ptr,                      //
                 auto *     a_flags,                          //
                 const bool a_ACCEPT_ALL,                     //
@@ -86,63 +89,87 @@ class IntegerMoveGenerator
 #endif
             ) {
                 const int DELTA_MAX = 10000;
-#ifdef _OPENMP
-#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static) \
-    num_threads(a_NUMBER_OF_THREADS)
-#endif
-                for (auto i = 0; i < VARIABLES_SIZE; i++) {
+
+                auto update_moves = [&mutable_variable_ptrs, a_moves_ptr,
+                                     a_flags, DELTA_MAX](const int i) {
                     const auto value = mutable_variable_ptrs[i]->value();
                     const auto lower_bound =
                         mutable_variable_ptrs[i]->lower_bound();
                     const auto upper_bound =
                         mutable_variable_ptrs[i]->upper_bound();
 
+                    if (value == upper_bound) {
+                        (*a_flags)[4 * i] = 0;
+                    } else {
+                        (*a_moves_ptr)[4 * i].alterations.front().second =
+                            value + 1;
+                        (*a_flags)[4 * i] = 1;
+                    }
+
+                    if (value == lower_bound) {
+                        (*a_flags)[4 * i + 1] = 0;
+                    } else {
+                        (*a_moves_ptr)[4 * i + 1]
+                            .alterations.front()
+                            .second           = value - 1;
+                        (*a_flags)[4 * i + 1] = 1;
+                    }
+
+                    if (value >= upper_bound - 4 ||
+                        upper_bound == constant::INT_HALF_MAX) {
+                        (*a_flags)[4 * i + 2] = 0;
+                    } else {
+                        const auto DELTA =
+                            std::min(DELTA_MAX, (upper_bound - value) / 2);
+                        (*a_moves_ptr)[4 * i + 2]
+                            .alterations.front()
+                            .second           = value + DELTA;
+                        (*a_flags)[4 * i + 2] = 1;
+                    }
+
+                    if (value <= lower_bound + 4 ||
+                        lower_bound == constant::INT_HALF_MIN) {
+                        (*a_flags)[4 * i + 3] = 0;
+                    } else {
+                        const auto DELTA =
+                            std::max(-DELTA_MAX, (lower_bound - value) / 2);
+                        (*a_moves_ptr)[4 * i + 3]
+                            .alterations.front()
+                            .second           = value + DELTA;
+                        (*a_flags)[4 * i + 3] = 1;
+                    }
+                };
+
+                /**
+                 * If the variables are attached to an improvability table,
+                 * only the improvable variables are visited.
+                 */
+                if (!a_ACCEPT_ALL) {
+                    std::fill(a_flags->begin(), a_flags->end(), 0);
+                    if (for_each_improvable_variable_index(
+                            mutable_variable_ptrs,            //
+                            VARIABLE_INDICES,                 //
+                            a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
+                            a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
+                            a_IS_ENABLED_PARALLEL,            //
+                            a_NUMBER_OF_THREADS,              //
+                            update_moves)) {
+                        return;
+                    }
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static) \
+    num_threads(a_NUMBER_OF_THREADS)
+#endif
+                for (auto i = 0; i < VARIABLES_SIZE; i++) {
                     if (a_ACCEPT_ALL ||
                         (a_ACCEPT_OBJECTIVE_IMPROVABLE &&
                          mutable_variable_ptrs[i]->is_objective_improvable()) ||
                         (a_ACCEPT_FEASIBILITY_IMPROVABLE &&
                          mutable_variable_ptrs[i]
                              ->is_feasibility_improvable())) {
-                        if (value == upper_bound) {
-                            (*a_flags)[4 * i] = 0;
-                        } else {
-                            (*a_moves_ptr)[4 * i].alterations.front().second =
-                                value + 1;
-                            (*a_flags)[4 * i] = 1;
-                        }
-
-                        if (value == lower_bound) {
-                            (*a_flags)[4 * i + 1] = 0;
-                        } else {
-                            (*a_moves_ptr)[4 * i + 1]
-                                .alterations.front()
-                                .second           = value - 1;
-                            (*a_flags)[4 * i + 1] = 1;
-                        }
-
-                        if (value >= upper_bound - 4 ||
-                            upper_bound == constant::INT_HALF_MAX) {
-                            (*a_flags)[4 * i + 2] = 0;
-                        } else {
-                            const auto DELTA =
-                                std::min(DELTA_MAX, (upper_bound - value) / 2);
-                            (*a_moves_ptr)[4 * i + 2]
-                                .alterations.front()
-                                .second           = value + DELTA;
-                            (*a_flags)[4 * i + 2] = 1;
-                        }
-
-                        if (value <= lower_bound + 4 ||
-                            lower_bound == constant::INT_HALF_MIN) {
-                            (*a_flags)[4 * i + 3] = 0;
-                        } else {
-                            const auto DELTA =
-                                std::max(-DELTA_MAX, (lower_bound - value) / 2);
-                            (*a_moves_ptr)[4 * i + 3]
-                                .alterations.front()
-                                .second           = value + DELTA;
-                            (*a_flags)[4 * i + 3] = 1;
-                        }
+                        update_moves(i);
                     } else {
                         for (auto j = 0; j < 4; j++) {
                             (*a_flags)[4 * i]     = 0;
@@ -13,13 +13,37 @@ using Alteration =
     std::pair<model_component::Variable<T_Variable, T_Expression> *,
               T_Variable>;
 
+/*****************************************************************************/
+struct MoveConstant {
+    /**
+     * Most of the moves alter at most four variables, and their alterations
+     * are stored without heap allocation.
+     */
+    static constexpr std::size_t INLINE_ALTERATIONS_CAPACITY = 4;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+using Alterations =
+    utility::SmallVector<Alteration<T_Variable, T_Expression>,
+                         MoveConstant::INLINE_ALTERATIONS_CAPACITY>;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+using RelatedConstraintPtrs =
+    utility::Span<model_component::Constraint<T_Variable, T_Expression> *>;
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 struct Move {
-    std::vector<Alteration<T_Variable, T_Expression>> alterations;
-    MoveSense                                         sense;
-    std::vector<model_component::Constraint<T_Variable, T_Expression> *>
-        related_constraint_ptrs;
+    Alterations<T_Variable, T_Expression> alterations;
+
+    /**
+     * The related constraints are not owned by the move. They refer to the
+     * list owned by the variable, the selection, or the pool of the move
+     * generator.
+     */
+    RelatedConstraintPtrs<T_Variable, T_Expression> related_constraint_ptrs;
 
     /**
      * The following two members are for Chain moves.
@@ -27,14 +51,19 @@ struct Move {
     std::uint_fast64_t hash;
     double             overlap_rate;
 
-    bool is_univariable_move;
-    bool is_selection_move;
+    /**
+     * The sense and the flags are packed into a single word.
+     */
+    MoveSense sense : 8;
+
+    bool is_univariable_move : 1;
+    bool is_selection_move : 1;
 
     /**
      * The following two members are for special neighborhood moves.
      */
-    bool is_special_neighborhood_move;
-    bool is_available;
+    bool is_special_neighborhood_move : 1;
+    bool is_available : 1;
 
     /*************************************************************************/
     Move(void) {
@@ -241,20 +270,6 @@ struct Move {
         }
         this->hash = hash;
     };
-
-    /*****************************************************************************/
-    void sort_and_unique_related_constraint_ptrs(void) {
-        std::stable_sort(this->related_constraint_ptrs.begin(),
-                         this->related_constraint_ptrs.end(),
-                         [](const auto &a_FIRST, const auto &a_SECOND) {
-                             return a_FIRST->name() < a_SECOND->name();
-                         });
-
-        this->related_constraint_ptrs.erase(
-            std::unique(this->related_constraint_ptrs.begin(),  //
-                        this->related_constraint_ptrs.end()),
-            this->related_constraint_ptrs.end());
-    }
 };
 
 /*****************************************************************************/
@@ -268,10 +283,11 @@ inline Move<T_Variable, T_Expression> operator+(
                               a_MOVE_SECOND.alterations.begin(),
                               a_MOVE_SECOND.alterations.end());
 
-    result.related_constraint_ptrs.insert(
-        result.related_constraint_ptrs.end(),
-        a_MOVE_SECOND.related_constraint_ptrs.begin(),
-        a_MOVE_SECOND.related_constraint_ptrs.end());
+    /**
+     * NOTE: The related constraints of the resulting move are left empty. They
+     * are stored in the pool of ChainMoveGenerator by register_move().
+     */
+    result.related_constraint_ptrs.clear();
 
     result.sense                        = MoveSense::Chain;
     result.is_univariable_move          = false;
@@ -280,7 +296,6 @@ inline Move<T_Variable, T_Expression> operator+(
 
     result.setup_overlap_rate();
     result.setup_hash();
-    result.sort_and_unique_related_constraint_ptrs();
 
     return result;
 };
@@ -8,7 +8,7 @@
 
 namespace printemps::neighborhood {
 /*****************************************************************************/
-enum class MoveSense {
+enum class MoveSense : std::uint8_t {
     Binary,                      //
     Integer,                     //
     Selection,                   //
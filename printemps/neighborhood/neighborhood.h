@@ -8,6 +8,7 @@
 
 #include "move_sense.h"
 #include "move.h"
+#include "related_constraint_ptrs_pool.h"
 #include "binomial_constraint.h"
 #include "trinomial_constraint.h"
 
@@ -31,6 +32,20 @@
 #include "user_defined_move_generator.h"
 
 namespace printemps::neighborhood {
+/*****************************************************************************/
+struct NeighborhoodConstant {
+    static constexpr int MOVE_BLOCK_SIZE = 4096;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct MoveBlock {
+    AbstractMoveGenerator<T_Variable, T_Expression> *move_generator_ptr;
+    int                                              begin;
+    int                                              end;
+    int                                              offset;
+};
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 class Neighborhood {
@@ -61,8 +76,9 @@ class Neighborhood {
     UserDefinedMoveGenerator<T_Variable, T_Expression> m_user_defined;
 
     std::vector<AbstractMoveGenerator<T_Variable, T_Expression> *>
-                                                  m_move_generator_ptrs;
-    std::vector<Move<T_Variable, T_Expression> *> m_move_ptrs;
+                                                     m_move_generator_ptrs;
+    std::vector<Move<T_Variable, T_Expression> *>    m_move_ptrs;
+    std::vector<MoveBlock<T_Variable, T_Expression>> m_move_blocks;
 
     long m_number_of_updated_moves;
 
@@ -113,6 +129,7 @@ class Neighborhood {
                                  &m_user_defined};
 
         m_move_ptrs.clear();
+        m_move_blocks.clear();
 
         m_number_of_updated_moves = 0;
     }
@@ -123,39 +140,78 @@ class Neighborhood {
                              const bool a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
                              const bool a_IS_ENABLED_PARALLEL,            //
                              const int  a_NUMBER_OF_THREADS) {
-        auto number_of_candidate_moves = 0;
+        /**
+         * The moves of the enabled generators are divided into blocks. The
+         * candidate moves are counted and compacted into m_move_ptrs block by
+         * block, and the positions of the blocks in m_move_ptrs are given by
+         * the prefix sum of the counts.
+         */
+        auto &move_blocks = m_move_blocks;
+        move_blocks.clear();
+        m_number_of_updated_moves = 0;
 
         for (auto &&move_generator_ptr : m_move_generator_ptrs) {
-            if (move_generator_ptr->is_enabled()) {
-                move_generator_ptr->update_moves(
-                    a_ACCEPT_ALL,                     //
-                    a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
-                    a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                    a_IS_ENABLED_PARALLEL,            //
-                    a_NUMBER_OF_THREADS);
-                auto &flags = move_generator_ptr->flags();
-                number_of_candidate_moves +=
-                    std::accumulate(flags.begin(), flags.end(), 0);
+            if (!move_generator_ptr->is_enabled()) {
+                continue;
             }
+            move_generator_ptr->update_moves(
+                a_ACCEPT_ALL,                     //
+                a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
+                a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
+                a_IS_ENABLED_PARALLEL,            //
+                a_NUMBER_OF_THREADS);
+
+            const int MOVES_SIZE = move_generator_ptr->moves().size();
+            for (auto begin = 0; begin < MOVES_SIZE;
+                 begin += NeighborhoodConstant::MOVE_BLOCK_SIZE) {
+                move_blocks.push_back(
+                    {move_generator_ptr, begin,
+                     std::min(begin + NeighborhoodConstant::MOVE_BLOCK_SIZE,
+                              MOVES_SIZE),
+                     0});
+            }
+            m_number_of_updated_moves += MOVES_SIZE;
+        }
+
+        const int MOVE_BLOCKS_SIZE = move_blocks.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL && MOVE_BLOCKS_SIZE > 1) \
+    schedule(static) num_threads(a_NUMBER_OF_THREADS)
+#endif
+        for (auto i = 0; i < MOVE_BLOCKS_SIZE; i++) {
+            auto       &move_block = move_blocks[i];
+            const auto &flags      = move_block.move_generator_ptr->flags();
+            int         count      = 0;
+            for (auto j = move_block.begin; j < move_block.end; j++) {
+                count += (flags[j] != 0);
+            }
+            move_block.offset = count;
+        }
+
+        int number_of_candidate_moves = 0;
+        for (auto &&move_block : move_blocks) {
+            const int COUNT   = move_block.offset;
+            move_block.offset = number_of_candidate_moves;
+            number_of_candidate_moves += COUNT;
         }
 
         auto &move_ptrs = m_move_ptrs;
         move_ptrs.resize(number_of_candidate_moves);
-        auto index                = 0;
-        m_number_of_updated_moves = 0;
 
-        for (const auto &move_generator_ptr : m_move_generator_ptrs) {
-            if (move_generator_ptr->is_enabled()) {
-                auto &    moves     = move_generator_ptr->moves();
-                auto &    flags     = move_generator_ptr->flags();
-                const int MOVE_SIZE = move_generator_ptr->moves().size();
-
-                for (auto i = 0; i < MOVE_SIZE; i++) {
-                    if (flags[i]) {
-                        move_ptrs[index++] = &moves[i];
-                    }
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL && MOVE_BLOCKS_SIZE > 1) \
+    schedule(static) num_threads(a_NUMBER_OF_THREADS)
+#endif
+        for (auto i = 0; i < MOVE_BLOCKS_SIZE; i++) {
+            const auto &move_block = move_blocks[i];
+            auto       &moves      = move_block.move_generator_ptr->moves();
+            const auto &flags      = move_block.move_generator_ptr->flags();
+            auto        index      = move_block.offset;
+            for (auto j = move_block.begin; j < move_block.end; j++) {
+                if (flags[j]) {
+                    move_ptrs[index++] = &moves[j];
                 }
-                m_number_of_updated_moves += moves.size();
             }
         }
     }
@@ -0,0 +1,118 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_NEIGHBORHOOD_RELATED_CONSTRAINT_PTRS_POOL_H__
+#define PRINTEMPS_NEIGHBORHOOD_RELATED_CONSTRAINT_PTRS_POOL_H__
+
+namespace printemps::neighborhood {
+/*****************************************************************************/
+struct RelatedConstraintPtrsPoolConstant {
+    static constexpr std::size_t CHUNK_CAPACITY = 1 << 14;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class RelatedConstraintPtrsPool {
+    /**
+     * This class stores the related constraint lists of moves in a shared
+     * buffer, and each move refers its list as a range of the buffer. The
+     * buffer consists of chunks which are never reallocated, so that the
+     * ranges remain valid until initialize() is called.
+     */
+   private:
+    std::vector<
+        std::vector<model_component::Constraint<T_Variable, T_Expression> *>>
+                m_chunks;
+    std::size_t m_size;
+
+    /*************************************************************************/
+    inline std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+        &chunk(const std::size_t a_SIZE) {
+        if (m_chunks.empty() || m_chunks.back().capacity() -
+                                        m_chunks.back().size() <
+                                    a_SIZE) {
+            m_chunks.emplace_back();
+            m_chunks.back().reserve(std::max(
+                a_SIZE, RelatedConstraintPtrsPoolConstant::CHUNK_CAPACITY));
+        }
+        return m_chunks.back();
+    }
+
+    /*************************************************************************/
+    inline RelatedConstraintPtrs<T_Variable, T_Expression> sort_and_unique(
+        std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+                         *a_chunk_ptr,
+        const std::size_t a_OFFSET) {
+        auto &chunk = *a_chunk_ptr;
+        std::stable_sort(chunk.begin() + a_OFFSET, chunk.end(),
+                         [](const auto &a_FIRST, const auto &a_SECOND) {
+                             return a_FIRST->name() < a_SECOND->name();
+                         });
+        chunk.erase(std::unique(chunk.begin() + a_OFFSET, chunk.end()),
+                    chunk.end());
+
+        m_size += chunk.size() - a_OFFSET;
+        return RelatedConstraintPtrs<T_Variable, T_Expression>(
+            chunk.data() + a_OFFSET, chunk.size() - a_OFFSET);
+    }
+
+   public:
+    /*************************************************************************/
+    RelatedConstraintPtrsPool(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_chunks.clear();
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline std::size_t size(void) const noexcept {
+        return m_size;
+    }
+
+    /*************************************************************************/
+    template <class T_Iterator>
+    inline RelatedConstraintPtrs<T_Variable, T_Expression> store(
+        T_Iterator a_first, T_Iterator a_last) {
+        auto &chunk = this->chunk(std::distance(a_first, a_last));
+
+        const std::size_t OFFSET = chunk.size();
+        chunk.insert(chunk.end(), a_first, a_last);
+
+        return this->sort_and_unique(&chunk, OFFSET);
+    }
+
+    /*************************************************************************/
+    inline RelatedConstraintPtrs<T_Variable, T_Expression> store_union(
+        const Alterations<T_Variable, T_Expression> &a_ALTERATIONS) {
+        /**
+         * Store the union of the related constraints of the altered
+         * variables.
+         */
+        std::size_t size = 0;
+        for (const auto &alteration : a_ALTERATIONS) {
+            size += alteration.first->related_constraint_ptrs().size();
+        }
+
+        auto &chunk = this->chunk(size);
+
+        const std::size_t OFFSET = chunk.size();
+        for (const auto &alteration : a_ALTERATIONS) {
+            chunk.insert(chunk.end(),
+                         alteration.first->related_constraint_ptrs().begin(),
+                         alteration.first->related_constraint_ptrs().end());
+        }
+
+        return this->sort_and_unique(&chunk, OFFSET);
+    }
+};
+}  // namespace printemps::neighborhood
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -32,6 +32,7 @@ class SoftSelectionMoveGenerator
 
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
 
         for (auto &&constraint_ptr : constraint_ptrs) {
             const auto &sensitivities =
@@ -57,25 +58,17 @@ class SoftSelectionMoveGenerator
                 move_first.is_available                 = true;
                 move_first.overlap_rate                 = 0.0;
 
-                move_first.related_constraint_ptrs.insert(
-                    move_first.related_constraint_ptrs.end(),
-                    variable_ptr->related_constraint_ptrs().begin(),
-                    variable_ptr->related_constraint_ptrs().end());
-
-                move_first.related_constraint_ptrs.insert(
-                    move_first.related_constraint_ptrs.end(),
-                    key_variable_ptr->related_constraint_ptrs().begin(),
-                    key_variable_ptr->related_constraint_ptrs().end());
+                move_first.alterations.emplace_back(variable_ptr, 0);
+                move_first.alterations.emplace_back(key_variable_ptr, 0);
 
-                move_first.sort_and_unique_related_constraint_ptrs();
+                move_first.related_constraint_ptrs =
+                    this->m_related_constraint_ptrs_pool.store_union(
+                        move_first.alterations);
 
                 move_second = move_first;
 
-                move_first.alterations.emplace_back(variable_ptr, 0);
-                move_first.alterations.emplace_back(key_variable_ptr, 0);
-
-                move_second.alterations.emplace_back(variable_ptr, 1);
-                move_second.alterations.emplace_back(key_variable_ptr, 1);
+                move_second.alterations[0].second = 1;
+                move_second.alterations[1].second = 1;
                 moves.push_back(move_first);
                 moves.push_back(move_second);
             }
@@ -42,6 +42,7 @@ class TrinomialExclusiveNorMoveGenerator
 
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
 
         this->m_moves.resize(2 * TRINOMIALS_SIZE);
         this->m_flags.resize(2 * TRINOMIALS_SIZE);
@@ -58,34 +59,9 @@ class TrinomialExclusiveNorMoveGenerator
             move.is_available                 = true;
             move.overlap_rate                 = 0.0;
 
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                trinomial[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .begin(),
-                trinomial[i]
-                    .variable_ptr_first->related_constraint_ptrs()
-                    .end());
-
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                trinomial[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .begin(),
-                trinomial[i]
-                    .variable_ptr_second->related_constraint_ptrs()
-                    .end());
-
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                trinomial[i]
-                    .variable_ptr_third->related_constraint_ptrs()
-                    .begin(),
-                trinomial[i]
-                    .variable_ptr_third->related_constraint_ptrs()
-                    .end());
-
-            move.sort_and_unique_related_constraint_ptrs();
+            move.related_constraint_ptrs =
+                this->m_related_constraint_ptrs_pool.store_union(
+                    move.alterations);
 
             this->m_moves[2 * i + 1] = move;
 
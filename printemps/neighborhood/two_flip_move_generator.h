@@ -32,6 +32,7 @@ class TwoFlipMoveGenerator
 
         this->m_moves.clear();
         this->m_flags.clear();
+        this->m_related_constraint_ptrs_pool.initialize();
 
         this->m_moves.resize(2 * PAIRS_SIZE);
         this->m_flags.resize(2 * PAIRS_SIZE);
@@ -49,25 +50,9 @@ class TwoFlipMoveGenerator
             move.is_available                 = true;
             move.overlap_rate                 = 0.0;
 
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                a_FLIPPABLE_VARIABLE_PTR_PAIRS[i]
-                    .first->related_constraint_ptrs()
-                    .begin(),
-                a_FLIPPABLE_VARIABLE_PTR_PAIRS[i]
-                    .first->related_constraint_ptrs()
-                    .end());
-
-            move.related_constraint_ptrs.insert(
-                move.related_constraint_ptrs.end(),
-                a_FLIPPABLE_VARIABLE_PTR_PAIRS[i]
-                    .second->related_constraint_ptrs()
-                    .begin(),
-                a_FLIPPABLE_VARIABLE_PTR_PAIRS[i]
-                    .second->related_constraint_ptrs()
-                    .end());
-
-            move.sort_and_unique_related_constraint_ptrs();
+            move.related_constraint_ptrs =
+                this->m_related_constraint_ptrs_pool.store_union(
+                    move.alterations);
 
             this->m_moves[2 * i + 1] = move;
 
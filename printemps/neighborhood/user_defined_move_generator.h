@@ -17,6 +17,73 @@ class UserDefinedMoveGenerator
     std::function<void(std::vector<Move<T_Variable, T_Expression>> *)>
         m_move_updater_wrapper;
 
+    std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+                             m_related_constraint_ptrs_buffer;
+    std::vector<std::size_t> m_related_constraint_ptrs_offsets;
+    std::vector<int>         m_constraint_epochs;
+    int                      m_epoch;
+
+    /*************************************************************************/
+    inline void setup_related_constraint_ptrs(
+        std::vector<Move<T_Variable, T_Expression>> *a_moves_ptr,
+        const std::vector<short>                    &a_FLAGS) {
+        /**
+         * This method computes the related constraints of the moves from the
+         * related constraints of the altered variables, so that user-defined
+         * moves are evaluated and applied incrementally like the built-in
+         * moves. The constraints are deduplicated by stamping them with the
+         * epoch, which is incremented for each move. The lists are stored in
+         * a shared buffer which is reused for every update.
+         */
+        auto     &moves      = *a_moves_ptr;
+        const int MOVES_SIZE = moves.size();
+
+        m_related_constraint_ptrs_buffer.clear();
+        m_related_constraint_ptrs_offsets.resize(MOVES_SIZE + 1);
+        m_related_constraint_ptrs_offsets[0] = 0;
+
+        for (auto i = 0; i < MOVES_SIZE; i++) {
+            if (a_FLAGS[i]) {
+                if (m_epoch == std::numeric_limits<int>::max()) {
+                    std::fill(m_constraint_epochs.begin(),
+                              m_constraint_epochs.end(), 0);
+                    m_epoch = 0;
+                }
+                m_epoch++;
+                for (const auto &alteration : moves[i].alterations) {
+                    for (auto &&constraint_ptr :
+                         alteration.first->related_constraint_ptrs()) {
+                        const std::size_t ID = constraint_ptr->id();
+                        if (ID >= m_constraint_epochs.size()) {
+                            m_constraint_epochs.resize(ID + 1, 0);
+                        }
+                        if (m_constraint_epochs[ID] == m_epoch) {
+                            continue;
+                        }
+                        m_constraint_epochs[ID] = m_epoch;
+                        m_related_constraint_ptrs_buffer.push_back(
+                            constraint_ptr);
+                    }
+                }
+            }
+            m_related_constraint_ptrs_offsets[i + 1] =
+                m_related_constraint_ptrs_buffer.size();
+        }
+
+        /**
+         * The spans are set after all of the lists are stored because the
+         * buffer may be reallocated while it grows.
+         */
+        for (auto i = 0; i < MOVES_SIZE; i++) {
+            moves[i].related_constraint_ptrs =
+                RelatedConstraintPtrs<T_Variable, T_Expression>(
+                    m_related_constraint_ptrs_buffer.data() +
+                        m_related_constraint_ptrs_offsets[i],
+                    m_related_constraint_ptrs_offsets[i + 1] -
+                        m_related_constraint_ptrs_offsets[i]);
+        }
+    }
+
    public:
     /*************************************************************************/
     UserDefinedMoveGenerator(void) {
@@ -27,6 +94,11 @@ class UserDefinedMoveGenerator
     inline void initialize(void) {
         this->m_move_updater_wrapper =
             [](std::vector<Move<T_Variable, T_Expression>> *) {};
+
+        m_related_constraint_ptrs_buffer.clear();
+        m_related_constraint_ptrs_offsets.clear();
+        m_constraint_epochs.clear();
+        m_epoch = 0;
     }
 
     /*************************************************************************/
@@ -91,6 +163,8 @@ class UserDefinedMoveGenerator
                         (*a_flags)[i] = 0;
                     }
                 }
+
+                this->setup_related_constraint_ptrs(a_moves_ptr, *a_flags);
             };
         this->m_move_updater = move_updater;
     }
@@ -0,0 +1,33 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_OPTION_MOVE_SELECTION_MODE_H__
+#define PRINTEMPS_OPTION_MOVE_SELECTION_MODE_H__
+
+namespace printemps::option::move_selection_mode {
+/*****************************************************************************/
+enum MoveSelectionMode : int {
+    Scan,
+    Reduction,
+};
+
+/*****************************************************************************/
+static std::unordered_map<std::string, MoveSelectionMode>
+    MoveSelectionModeMap = {
+        {"Scan", MoveSelectionMode::Scan},  //
+        {"Reduction", MoveSelectionMode::Reduction}};
+
+/*****************************************************************************/
+static std::unordered_map<MoveSelectionMode, std::string>
+    MoveSelectionModeInverseMap = {
+        {MoveSelectionMode::Scan, "Scan"},  //
+        {MoveSelectionMode::Reduction, "Reduction"}};
+
+}  // namespace printemps::option::move_selection_mode
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
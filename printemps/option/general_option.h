@@ -36,6 +36,11 @@ struct GeneralOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    GeneralOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->iteration_max = GeneralOptionConstant::DEFAULT_ITERATION_MAX;
@@ -82,7 +87,8 @@ struct GeneralOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                 //
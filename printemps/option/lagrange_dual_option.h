@@ -42,6 +42,11 @@ struct LagrangeDualOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    LagrangeDualOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled    = LagrangeDualOptionConstant::DEFAULT_IS_ENABLED;
@@ -106,7 +111,8 @@ struct LagrangeDualOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(              //
@@ -36,6 +36,11 @@ struct LocalSearchOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    LocalSearchOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled    = LocalSearchOptionConstant::DEFAULT_IS_ENABLED;
@@ -80,7 +85,8 @@ struct LocalSearchOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(              //
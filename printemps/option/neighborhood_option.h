@@ -84,6 +84,11 @@ struct NeighborhoodOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    NeighborhoodOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled_binary_move =
@@ -257,7 +262,8 @@ struct NeighborhoodOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                          //
@@ -83,72 +83,64 @@ struct Option {
    public:
     /**************************************************************************/
     inline void setup(const std::string &a_FILE_NAME) {
-        auto   option_object = utility::json::read_json_object(a_FILE_NAME);
-        Option option;
+        utility::json::JsonDocument document;
+        Option                      option;
 
-        if (option_object.find("general")) {
-            option.general =
-                GeneralOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("general")));
+        const auto &OPTION_OBJECT = document.read(a_FILE_NAME);
+
+        if (!OPTION_OBJECT.is_object()) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Specified JSON file is not valid: " + a_FILE_NAME));
+        }
+
+        if (OPTION_OBJECT.find("general")) {
+            option.general = GeneralOption(OPTION_OBJECT.at("general"));
         }
 
-        if (option_object.find("penalty")) {
-            option.penalty =
-                PenaltyOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("penalty")));
+        if (OPTION_OBJECT.find("penalty")) {
+            option.penalty = PenaltyOption(OPTION_OBJECT.at("penalty"));
         }
 
-        if (option_object.find("parallel")) {
-            option.parallel =
-                ParallelOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("parallel")));
+        if (OPTION_OBJECT.find("parallel")) {
+            option.parallel = ParallelOption(OPTION_OBJECT.at("parallel"));
         }
 
-        if (option_object.find("preprocess")) {
+        if (OPTION_OBJECT.find("preprocess")) {
             option.preprocess =
-                PreprocessOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("preprocess")));
+                PreprocessOption(OPTION_OBJECT.at("preprocess"));
         }
 
-        if (option_object.find("restart")) {
-            option.restart =
-                RestartOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("restart")));
+        if (OPTION_OBJECT.find("restart")) {
+            option.restart = RestartOption(OPTION_OBJECT.at("restart"));
         }
 
-        if (option_object.find("neighborhood")) {
+        if (OPTION_OBJECT.find("neighborhood")) {
             option.neighborhood =
-                NeighborhoodOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("neighborhood")));
+                NeighborhoodOption(OPTION_OBJECT.at("neighborhood"));
         }
 
-        if (option_object.find("output")) {
-            option.output =
-                OutputOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("output")));
+        if (OPTION_OBJECT.find("output")) {
+            option.output = OutputOption(OPTION_OBJECT.at("output"));
         }
 
-        if (option_object.find("pdlp")) {
-            option.pdlp = PDLPOption(std::any_cast<utility::json::JsonObject>(
-                option_object.at("pdlp")));
+        if (OPTION_OBJECT.find("pdlp")) {
+            option.pdlp = PDLPOption(OPTION_OBJECT.at("pdlp"));
         }
 
-        if (option_object.find("lagrange_dual")) {
+        if (OPTION_OBJECT.find("lagrange_dual")) {
             option.lagrange_dual =
-                LagrangeDualOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("lagrange_dual")));
+                LagrangeDualOption(OPTION_OBJECT.at("lagrange_dual"));
         }
 
-        if (option_object.find("local_search")) {
+        if (OPTION_OBJECT.find("local_search")) {
             option.local_search =
-                LocalSearchOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("local_search")));
+                LocalSearchOption(OPTION_OBJECT.at("local_search"));
         }
 
-        if (option_object.find("tabu_search")) {
+        if (OPTION_OBJECT.find("tabu_search")) {
             option.tabu_search =
-                TabuSearchOption(std::any_cast<utility::json::JsonObject>(
-                    option_object.at("tabu_search")));
+                TabuSearchOption(OPTION_OBJECT.at("tabu_search"));
         }
 
         *this = option;
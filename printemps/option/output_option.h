@@ -61,6 +61,11 @@ struct OutputOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    OutputOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->verbose = OutputOptionConstant::DEFAULT_VERBOSE;
@@ -156,7 +161,8 @@ struct OutputOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(           //
@@ -23,6 +23,9 @@ struct ParallelOptionConstant {
         DEFAULT_IS_ENABLED_THREAD_COUNT_OPTIMIZATION = true;
     static constexpr double  //
         DEFAULT_THREAD_COUNT_OPTIMIZATION_DECAY_FACTOR = 0.5;
+
+    static constexpr int  //
+        DEFAULT_NUMBER_OF_WALKERS = 1;
 };
 
 /*****************************************************************************/
@@ -36,6 +39,14 @@ struct ParallelOption {
     bool   is_enabled_thread_count_optimization;
     double thread_count_optimization_decay_factor;
 
+    /**
+     * The number of tabu search walkers run concurrently, capped at the
+     * maximum number of OpenMP threads. If it is larger than one, the threads
+     * are used for the walkers, and the parallelization of move updates and
+     * evaluations is disabled for all walkers, including the main one.
+     */
+    int number_of_walkers;
+
     /*************************************************************************/
     ParallelOption(void) {
         this->initialize();
@@ -46,6 +57,11 @@ struct ParallelOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    ParallelOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled_move_update_parallelization  //
@@ -69,6 +85,9 @@ struct ParallelOption {
         this->thread_count_optimization_decay_factor  //
             = ParallelOptionConstant::
                 DEFAULT_THREAD_COUNT_OPTIMIZATION_DECAY_FACTOR;
+
+        this->number_of_walkers  //
+            = ParallelOptionConstant::DEFAULT_NUMBER_OF_WALKERS;
     }
 
     /*************************************************************************/
@@ -103,10 +122,16 @@ struct ParallelOption {
             " -- parallel.thread_count_optimization_decay_factor: " +  //
             utility::to_string(                                        //
                 this->thread_count_optimization_decay_factor, "%f"));
+
+        utility::print(                           //
+            " -- parallel.number_of_walkers: " +  //
+            utility::to_string(                   //
+                this->number_of_walkers, "%d"));
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                                          //
@@ -138,6 +163,11 @@ struct ParallelOption {
             &this->thread_count_optimization_decay_factor,  //
             "thread_count_optimization_decay_factor",       //
             a_OBJECT);
+
+        read_json(                     //
+            &this->number_of_walkers,  //
+            "number_of_walkers",       //
+            a_OBJECT);
     }
 
     /**************************************************************************/
@@ -167,6 +197,10 @@ struct ParallelOption {
             "thread_count_optimization_decay_factor",  //
             this->thread_count_optimization_decay_factor);
 
+        obj.emplace_back(         //
+            "number_of_walkers",  //
+            this->number_of_walkers);
+
         return obj;
     }
 };
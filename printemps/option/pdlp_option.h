@@ -24,6 +24,8 @@ struct PDLPOptionConstant {
     static constexpr int    DEFAULT_COUNTS_OF_RUIZ_SCALING            = 10;
     static constexpr bool   DEFAULT_IS_ENABLED_POCK_CHAMBOLLE_SCALING = true;
     static constexpr int    DEFAULT_LOG_INTERVAL                      = 10;
+    static constexpr bool   DEFAULT_IS_ENABLED_MIXED_PRECISION        = false;
+    static constexpr double DEFAULT_MIXED_PRECISION_SWITCH_TOLERANCE  = 1E-3;
 };
 
 /*****************************************************************************/
@@ -43,6 +45,8 @@ struct PDLPOption {
     int    counts_of_ruiz_scaling;
     bool   is_enabled_pock_chambolle_scaling;
     int    log_interval;
+    bool   is_enabled_mixed_precision;
+    double mixed_precision_switch_tolerance;
 
     /*************************************************************************/
     PDLPOption(void) {
@@ -54,6 +58,11 @@ struct PDLPOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    PDLPOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled    = PDLPOptionConstant::DEFAULT_IS_ENABLED;
@@ -80,6 +89,10 @@ struct PDLPOption {
         this->is_enabled_pock_chambolle_scaling =
             PDLPOptionConstant::DEFAULT_IS_ENABLED_POCK_CHAMBOLLE_SCALING;
         this->log_interval = PDLPOptionConstant::DEFAULT_LOG_INTERVAL;
+        this->is_enabled_mixed_precision =
+            PDLPOptionConstant::DEFAULT_IS_ENABLED_MIXED_PRECISION;
+        this->mixed_precision_switch_tolerance =
+            PDLPOptionConstant::DEFAULT_MIXED_PRECISION_SWITCH_TOLERANCE;
     }
 
     /*************************************************************************/
@@ -158,10 +171,21 @@ struct PDLPOption {
             " -- pdlp.log_interval: " +  //
             utility::to_string(          //
                 this->log_interval, "%d"));
+
+        utility::print(                                //
+            " -- pdlp.is_enabled_mixed_precision: " +  //
+            utility::to_true_or_false(                 //
+                this->is_enabled_mixed_precision));
+
+        utility::print(                                      //
+            " -- pdlp.mixed_precision_switch_tolerance: " +  //
+            utility::to_string(                              //
+                this->mixed_precision_switch_tolerance, "%f"));
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(              //
@@ -223,6 +247,14 @@ struct PDLPOption {
         read_json(                //
             &this->log_interval,  //
             "log_interval", a_OBJECT);
+
+        read_json(                              //
+            &this->is_enabled_mixed_precision,  //
+            "is_enabled_mixed_precision", a_OBJECT);
+
+        read_json(                                    //
+            &this->mixed_precision_switch_tolerance,  //
+            "mixed_precision_switch_tolerance", a_OBJECT);
     }
 
     /**************************************************************************/
@@ -288,6 +320,14 @@ struct PDLPOption {
             "log_interval",  //
             this->log_interval);
 
+        obj.emplace_back(                  //
+            "is_enabled_mixed_precision",  //
+            this->is_enabled_mixed_precision);
+
+        obj.emplace_back(                        //
+            "mixed_precision_switch_tolerance",  //
+            this->mixed_precision_switch_tolerance);
+
         return obj;
     }
 };
@@ -60,6 +60,11 @@ struct PenaltyOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    PenaltyOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->penalty_coefficient_relaxing_rate  //
@@ -189,7 +194,8 @@ struct PenaltyOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                                     //
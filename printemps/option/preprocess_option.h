@@ -70,6 +70,11 @@ struct PreprocessOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    PreprocessOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->is_enabled_presolve =
@@ -217,7 +222,8 @@ struct PreprocessOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                       //
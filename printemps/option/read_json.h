@@ -8,13 +8,52 @@
 
 namespace printemps::option {
 /*****************************************************************************/
+inline bool is_json_integer(const utility::json::JsonObject &a_JSON,
+                            const std::string &              a_NAME) {
+    return a_JSON.at(a_NAME).type() == typeid(int);
+}
+
+/*****************************************************************************/
+inline bool is_json_integer(const utility::json::JsonValue &a_JSON,
+                            const std::string &             a_NAME) {
+    return a_JSON.at(a_NAME).is_integer();
+}
+
+/*****************************************************************************/
+inline bool is_json_string(const utility::json::JsonObject &a_JSON,
+                           const std::string &              a_NAME) {
+    return a_JSON.at(a_NAME).type() == typeid(std::string);
+}
+
+/*****************************************************************************/
+inline bool is_json_string(const utility::json::JsonValue &a_JSON,
+                           const std::string &             a_NAME) {
+    return a_JSON.at(a_NAME).is_string();
+}
+
+/*****************************************************************************/
+template <class T>
+inline T get_json(const utility::json::JsonObject &a_JSON,
+                  const std::string &              a_NAME) {
+    return a_JSON.get<T>(a_NAME);
+}
+
+/*****************************************************************************/
+template <class T>
+inline T get_json(const utility::json::JsonValue &a_JSON,
+                  const std::string &             a_NAME) {
+    return a_JSON.get<T>(a_NAME);
+}
+
+/*****************************************************************************/
+template <class T_Json>
 inline bool read_json(double *a_parameter, const std::string &a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+                      const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
-            *a_parameter = a_JSON.get<int>(a_NAME);
+        if (is_json_integer(a_JSON, a_NAME)) {
+            *a_parameter = get_json<int>(a_JSON, a_NAME);
         } else {
-            *a_parameter = a_JSON.get<double>(a_NAME);
+            *a_parameter = get_json<double>(a_JSON, a_NAME);
         }
         return true;
     }
@@ -22,19 +61,19 @@ inline bool read_json(double *a_parameter, const std::string &a_NAME,
 }
 
 /**************************************************************************/
-inline bool read_json(restart_mode::RestartMode *      a_parameter,
-                      const std::string &              a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+template <class T_Json>
+inline bool read_json(restart_mode::RestartMode *a_parameter,
+                      const std::string &a_NAME, const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
-            *a_parameter =
-                static_cast<restart_mode::RestartMode>(a_JSON.get<int>(a_NAME));
+        if (is_json_integer(a_JSON, a_NAME)) {
+            *a_parameter = static_cast<restart_mode::RestartMode>(
+                get_json<int>(a_JSON, a_NAME));
             return true;
         }
 
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
+        if (is_json_string(a_JSON, a_NAME)) {
             *a_parameter = restart_mode::RestartModeMap.at(
-                a_JSON.get<std::string>(a_NAME));
+                get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
 
@@ -44,20 +83,20 @@ inline bool read_json(restart_mode::RestartMode *      a_parameter,
 }
 
 /*****************************************************************************/
+template <class T_Json>
 inline bool read_json(chain_move_reduce_mode::ChainMoveReduceMode *a_parameter,
-                      const std::string &                          a_NAME,
-                      const utility::json::JsonObject &            a_JSON) {
+                      const std::string &a_NAME, const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
             *a_parameter =
                 static_cast<chain_move_reduce_mode::ChainMoveReduceMode>(
-                    a_JSON.get<int>(a_NAME));
+                    get_json<int>(a_JSON, a_NAME));
             return true;
         }
 
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
+        if (is_json_string(a_JSON, a_NAME)) {
             *a_parameter = chain_move_reduce_mode::ChainMoveReduceModeMap.at(
-                a_JSON.get<std::string>(a_NAME));
+                get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
     }
@@ -65,19 +104,19 @@ inline bool read_json(chain_move_reduce_mode::ChainMoveReduceMode *a_parameter,
 }
 
 /**************************************************************************/
-inline bool read_json(selection_mode::SelectionMode *  a_parameter,
-                      const std::string &              a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+template <class T_Json>
+inline bool read_json(selection_mode::SelectionMode *a_parameter,
+                      const std::string &a_NAME, const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
             *a_parameter = static_cast<selection_mode::SelectionMode>(
-                a_JSON.get<int>(a_NAME));
+                get_json<int>(a_JSON, a_NAME));
             return true;
         }
 
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
+        if (is_json_string(a_JSON, a_NAME)) {
             *a_parameter = selection_mode::SelectionModeMap.at(
-                a_JSON.get<std::string>(a_NAME));
+                get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
 
@@ -87,21 +126,22 @@ inline bool read_json(selection_mode::SelectionMode *  a_parameter,
 }
 
 /**************************************************************************/
+template <class T_Json>
 inline bool read_json(
     improvability_screening_mode::ImprovabilityScreeningMode *a_parameter,
-    const std::string &a_NAME, const utility::json::JsonObject &a_JSON) {
+    const std::string &a_NAME, const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
             *a_parameter = static_cast<
                 improvability_screening_mode::ImprovabilityScreeningMode>(
-                a_JSON.get<int>(a_NAME));
+                get_json<int>(a_JSON, a_NAME));
             return true;
         }
 
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
+        if (is_json_string(a_JSON, a_NAME)) {
             *a_parameter =
                 improvability_screening_mode::ImprovabilityScreeningModeMap.at(
-                    a_JSON.get<std::string>(a_NAME));
+                    get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
 
@@ -111,17 +151,18 @@ inline bool read_json(
 }
 
 /**************************************************************************/
+template <class T_Json>
 inline bool read_json(verbose::Verbose *a_parameter, const std::string &a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+                      const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
             *a_parameter =
-                static_cast<verbose::Verbose>(a_JSON.get<int>(a_NAME));
+                static_cast<verbose::Verbose>(get_json<int>(a_JSON, a_NAME));
             return true;
         }
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
+        if (is_json_string(a_JSON, a_NAME)) {
             *a_parameter =
-                verbose::VerboseMap.at(a_JSON.get<std::string>(a_NAME));
+                verbose::VerboseMap.at(get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
 
@@ -131,19 +172,19 @@ inline bool read_json(verbose::Verbose *a_parameter, const std::string &a_NAME,
 }
 
 /**************************************************************************/
-inline bool read_json(tabu_mode::TabuMode *            a_parameter,
-                      const std::string &              a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+template <class T_Json>
+inline bool read_json(tabu_mode::TabuMode *a_parameter,
+                      const std::string &a_NAME, const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        if (a_JSON.at(a_NAME).type() == typeid(int)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
             *a_parameter =
-                static_cast<tabu_mode::TabuMode>(a_JSON.get<int>(a_NAME));
+                static_cast<tabu_mode::TabuMode>(get_json<int>(a_JSON, a_NAME));
             return true;
         }
 
-        if (a_JSON.at(a_NAME).type() == typeid(std::string)) {
-            *a_parameter =
-                tabu_mode::TabuModeMap.at(a_JSON.get<std::string>(a_NAME));
+        if (is_json_string(a_JSON, a_NAME)) {
+            *a_parameter = tabu_mode::TabuModeMap.at(
+                get_json<std::string>(a_JSON, a_NAME));
             return true;
         }
     }
@@ -151,11 +192,31 @@ inline bool read_json(tabu_mode::TabuMode *            a_parameter,
 }
 
 /**************************************************************************/
-template <class T>
+template <class T_Json>
+inline bool read_json(move_selection_mode::MoveSelectionMode *a_parameter,
+                      const std::string &a_NAME, const T_Json &a_JSON) {
+    if (a_JSON.find(a_NAME)) {
+        if (is_json_integer(a_JSON, a_NAME)) {
+            *a_parameter = static_cast<move_selection_mode::MoveSelectionMode>(
+                get_json<int>(a_JSON, a_NAME));
+            return true;
+        }
+
+        if (is_json_string(a_JSON, a_NAME)) {
+            *a_parameter = move_selection_mode::MoveSelectionModeMap.at(
+                get_json<std::string>(a_JSON, a_NAME));
+            return true;
+        }
+    }
+    return false;
+}
+
+/**************************************************************************/
+template <class T, class T_Json>
 inline bool read_json(T *a_parameter, const std::string &a_NAME,
-                      const utility::json::JsonObject &a_JSON) {
+                      const T_Json &a_JSON) {
     if (a_JSON.find(a_NAME)) {
-        *a_parameter = a_JSON.get<T>(a_NAME);
+        *a_parameter = get_json<T>(a_JSON, a_NAME);
         return true;
     }
     return false;
@@ -27,6 +27,11 @@ struct RestartOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    RestartOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->restart_mode  //
@@ -41,7 +46,8 @@ struct RestartOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
         read_json(&this->restart_mode, "restart_mode", a_OBJECT);
     }
@@ -19,6 +19,8 @@ struct TabuSearchOptionConstant {
     static constexpr double DEFAULT_INITIAL_MODIFICATION_RANDOMIZE_RATE = 0.5;
     static constexpr tabu_mode::TabuMode DEFAULT_TABU_MODE = tabu_mode::All;
     static constexpr double              DEFAULT_MOVE_PRESERVE_RATE = 1.0;
+    static constexpr move_selection_mode::MoveSelectionMode
+        DEFAULT_MOVE_SELECTION_MODE = move_selection_mode::Scan;
     static constexpr double DEFAULT_FREQUENCY_PENALTY_COEFFICIENT   = 1E-4;
     static constexpr double DEFAULT_LAGRANGIAN_PENALTY_COEFFICIENT  = 1.0;
     static constexpr double DEFAULT_PRUNING_RATE_THRESHOLD          = 1.0;
@@ -31,6 +33,7 @@ struct TabuSearchOptionConstant {
     static constexpr bool DEFAULT_IS_ENABLED_AUTOMATIC_ITERATION_ADJUSTMENT =
         true;
     static constexpr bool   DEFAULT_IS_ENABLED_INITIAL_MODIFICATION    = true;
+    static constexpr bool   DEFAULT_IS_ENABLED_INCREMENTAL_EVALUATION  = false;
     static constexpr int    DEFAULT_INTENSITY_INCREASE_COUNT_THRESHOLD = 10;
     static constexpr int    DEFAULT_INTENSITY_DECREASE_COUNT_THRESHOLD = 10;
     static constexpr double DEFAULT_ITERATION_INCREASE_RATE            = 1.5;
@@ -52,6 +55,9 @@ struct TabuSearchOption {
     double              initial_modification_randomize_rate;
     tabu_mode::TabuMode tabu_mode;
     double              move_preserve_rate;
+
+    move_selection_mode::MoveSelectionMode move_selection_mode;
+
     double              frequency_penalty_coefficient;
     double              lagrangian_penalty_coefficient;
     double              pruning_rate_threshold;
@@ -61,6 +67,15 @@ struct TabuSearchOption {
     bool                is_enabled_automatic_tabu_tenure_adjustment;
     bool                is_enabled_automatic_iteration_adjustment;
     bool                is_enabled_initial_modification;
+
+    /**
+     * If enabled, the violation and local penalty differences of binary flip
+     * moves are cached and only the moves sharing a constraint with the last
+     * applied move are re-evaluated. The candidate moves are still scanned
+     * and scored every iteration, so that an iteration remains O(number of
+     * moves); only the per-move cost drops from O(degree) to O(1).
+     */
+    bool                is_enabled_incremental_evaluation;
     int                 intensity_increase_count_threshold;
     int                 intensity_decrease_count_threshold;
     double              iteration_increase_rate;
@@ -79,6 +94,11 @@ struct TabuSearchOption {
         this->setup(a_OBJECT);
     }
 
+    /*************************************************************************/
+    TabuSearchOption(const utility::json::JsonValue &a_OBJECT) {
+        this->setup(a_OBJECT);
+    }
+
     /*************************************************************************/
     void initialize(void) {
         this->iteration_max = TabuSearchOptionConstant::DEFAULT_ITERATION_MAX;
@@ -96,6 +116,8 @@ struct TabuSearchOption {
         this->tabu_mode = TabuSearchOptionConstant::DEFAULT_TABU_MODE;
         this->move_preserve_rate =
             TabuSearchOptionConstant::DEFAULT_MOVE_PRESERVE_RATE;
+        this->move_selection_mode =
+            TabuSearchOptionConstant::DEFAULT_MOVE_SELECTION_MODE;
         this->frequency_penalty_coefficient =
             TabuSearchOptionConstant::DEFAULT_FREQUENCY_PENALTY_COEFFICIENT;
         this->lagrangian_penalty_coefficient =
@@ -116,6 +138,8 @@ struct TabuSearchOption {
                 DEFAULT_IS_ENABLED_AUTOMATIC_ITERATION_ADJUSTMENT;
         this->is_enabled_initial_modification =
             TabuSearchOptionConstant::DEFAULT_IS_ENABLED_INITIAL_MODIFICATION;
+        this->is_enabled_incremental_evaluation =
+            TabuSearchOptionConstant::DEFAULT_IS_ENABLED_INCREMENTAL_EVALUATION;
         this->intensity_increase_count_threshold = TabuSearchOptionConstant::
             DEFAULT_INTENSITY_INCREASE_COUNT_THRESHOLD;
         this->intensity_decrease_count_threshold = TabuSearchOptionConstant::
@@ -182,6 +206,11 @@ struct TabuSearchOption {
             utility::to_string(                       //
                 this->move_preserve_rate, "%f"));
 
+        utility::print(                                //
+            " -- tabu_search.move_selection_mode: " +  //
+            move_selection_mode::MoveSelectionModeInverseMap.at(
+                this->move_selection_mode));
+
         utility::print(                                          //
             " -- tabu_search.frequency_penalty_coefficient: " +  //
             utility::to_string(                                  //
@@ -227,6 +256,11 @@ struct TabuSearchOption {
             utility::to_true_or_false(                             //
                 this->is_enabled_initial_modification));
 
+        utility::print(                                              //
+            " -- tabu_search.is_enabled_incremental_evaluation: " +  //
+            utility::to_true_or_false(                               //
+                this->is_enabled_incremental_evaluation));
+
         utility::print(                                               //
             " -- tabu_search.intensity_increase_count_threshold: " +  //
             utility::to_string(                                       //
@@ -264,7 +298,8 @@ struct TabuSearchOption {
     }
 
     /**************************************************************************/
-    inline void setup(const utility::json::JsonObject &a_OBJECT) {
+    template <class T_Json>
+    inline void setup(const T_Json &a_OBJECT) {
         this->initialize();
 
         read_json(                 //
@@ -307,6 +342,10 @@ struct TabuSearchOption {
             &this->move_preserve_rate,  //
             "move_preserve_rate", a_OBJECT);
 
+        read_json(                       //
+            &this->move_selection_mode,  //
+            "move_selection_mode", a_OBJECT);
+
         read_json(                                 //
             &this->frequency_penalty_coefficient,  //
             "frequency_penalty_coefficient", a_OBJECT);
@@ -343,6 +382,10 @@ struct TabuSearchOption {
             &this->is_enabled_initial_modification,  //
             "is_enabled_initial_modification", a_OBJECT);
 
+        read_json(                                     //
+            &this->is_enabled_incremental_evaluation,  //
+            "is_enabled_incremental_evaluation", a_OBJECT);
+
         read_json(                                      //
             &this->intensity_increase_count_threshold,  //
             "intensity_increase_count_threshold", a_OBJECT);
@@ -415,6 +458,11 @@ struct TabuSearchOption {
             "move_preserve_rate",  //
             this->move_preserve_rate);
 
+        obj.emplace_back(           //
+            "move_selection_mode",  //
+            move_selection_mode::MoveSelectionModeInverseMap.at(
+                this->move_selection_mode));
+
         obj.emplace_back(                     //
             "frequency_penalty_coefficient",  //
             this->frequency_penalty_coefficient);
@@ -451,6 +499,10 @@ struct TabuSearchOption {
             "is_enabled_initial_modification",  //
             this->is_enabled_initial_modification);
 
+        obj.emplace_back(                         //
+            "is_enabled_incremental_evaluation",  //
+            this->is_enabled_incremental_evaluation);
+
         obj.emplace_back(                          //
             "intensity_increase_count_threshold",  //
             this->intensity_increase_count_threshold);
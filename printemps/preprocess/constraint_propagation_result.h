@@ -0,0 +1,65 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_PREPROCESS_CONSTRAINT_PROPAGATION_RESULT_H__
+#define PRINTEMPS_PREPROCESS_CONSTRAINT_PROPAGATION_RESULT_H__
+
+namespace printemps::preprocess {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct ConstraintPropagationResult {
+    /**
+     * This structure holds the reductions derived from a constraint by the
+     * bound propagation. The reductions are computed without modifying the
+     * model, and applied to the model afterward.
+     */
+    bool is_constraint_disabled;
+
+    model_component::Variable<T_Variable, T_Expression> *fixed_variable_ptr;
+    T_Variable                                           fixed_value;
+
+    std::vector<
+        std::pair<model_component::Variable<T_Variable, T_Expression> *,
+                  T_Variable>>
+        tightened_lower_bounds;
+    std::vector<
+        std::pair<model_component::Variable<T_Variable, T_Expression> *,
+                  T_Variable>>
+        tightened_upper_bounds;
+
+    std::vector<std::string> messages;
+
+    /*************************************************************************/
+    ConstraintPropagationResult(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->is_constraint_disabled = false;
+        this->fixed_variable_ptr     = nullptr;
+        this->fixed_value            = 0;
+        this->tightened_lower_bounds.clear();
+        this->tightened_upper_bounds.clear();
+        this->messages.clear();
+    }
+
+    /*************************************************************************/
+    inline bool is_variable_bound_updated(void) const noexcept {
+        return !this->tightened_lower_bounds.empty() ||
+               !this->tightened_upper_bounds.empty();
+    }
+
+    /*************************************************************************/
+    inline int number_of_variable_bound_updates(void) const noexcept {
+        return this->tightened_lower_bounds.size() +
+               this->tightened_upper_bounds.size();
+    }
+};
+}  // namespace printemps::preprocess
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
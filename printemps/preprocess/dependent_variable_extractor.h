@@ -277,6 +277,8 @@ class DependentVariableExtractor {
 
                 if (dependent_expression_map.find(variable_ptr) !=
                     dependent_expression_map.end()) {
+                    m_model_ptr->mark_structure_dirty(
+                        variable_ptr->dependent_expression_ptr());
                     *(variable_ptr->dependent_expression_ptr()) = expression;
                 } else {
                     additional_expression_proxy(count) = expression;
@@ -338,6 +340,8 @@ class DependentVariableExtractor {
             for (auto &&variable_ptr : variable_ptrs) {
                 if (objective_sensitivities.find(variable_ptr) !=
                     objective_sensitivities.end()) {
+                    m_model_ptr->mark_structure_dirty(
+                        &m_model_ptr->objective().expression());
                     m_model_ptr->objective().expression().substitute(
                         variable_ptr,  //
                         *(variable_ptr->dependent_expression_ptr()));
@@ -360,6 +364,7 @@ class DependentVariableExtractor {
                     continue;
                 }
 
+                m_model_ptr->mark_structure_dirty(constraint_ptr);
                 constraint_ptr->expression().substitute(
                     variable_ptr,  //
                     *(variable_ptr->dependent_expression_ptr()));
@@ -382,6 +387,7 @@ class DependentVariableExtractor {
                         expression.sensitivities().end()) {
                         continue;
                     }
+                    m_model_ptr->mark_structure_dirty(&expression);
                     expression.substitute(
                         variable_ptr,  //
                         *(variable_ptr->dependent_expression_ptr()));
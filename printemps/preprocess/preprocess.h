@@ -12,6 +12,7 @@ template <class T_Variable, class T_Expression>
 class Model;
 }  // namespace printemps::model
 
+#include "constraint_propagation_result.h"
 #include "problem_size_reducer.h"
 #include "selection_extractor.h"
 #include "dependent_variable_extractor.h"
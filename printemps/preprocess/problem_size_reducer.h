@@ -17,6 +17,49 @@ class ProblemSizeReducer {
     int  m_variable_bound_update_count_in_optimization;
     bool m_is_preprocess;
 
+    std::vector<std::pair<std::string, double>> m_elapsed_times;
+
+    /*************************************************************************/
+    template <class T_Value>
+    inline static void atomic_max(std::atomic<T_Value> *a_value_ptr,
+                                  const T_Value        a_VALUE) {
+        T_Value current = a_value_ptr->load();
+        while (current < a_VALUE &&
+               !a_value_ptr->compare_exchange_weak(current, a_VALUE)) {
+            /// nothing to do
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Value>
+    inline static void atomic_min(std::atomic<T_Value> *a_value_ptr,
+                                  const T_Value        a_VALUE) {
+        T_Value current = a_value_ptr->load();
+        while (current > a_VALUE &&
+               !a_value_ptr->compare_exchange_weak(current, a_VALUE)) {
+            /// nothing to do
+        }
+    }
+
+    /*************************************************************************/
+    inline void add_elapsed_time(const std::string &a_PASS_NAME,
+                                 const double       a_ELAPSED_TIME) {
+        /**
+         * NOTE: Only the elapsed times in the preprocess are recorded, because
+         * some passes are also called during the optimization.
+         */
+        if (!m_is_preprocess) {
+            return;
+        }
+        for (auto &&elapsed_time : m_elapsed_times) {
+            if (elapsed_time.first == a_PASS_NAME) {
+                elapsed_time.second += a_ELAPSED_TIME;
+                return;
+            }
+        }
+        m_elapsed_times.emplace_back(a_PASS_NAME, a_ELAPSED_TIME);
+    }
+
    public:
     /*************************************************************************/
     ProblemSizeReducer(void) {
@@ -40,6 +83,7 @@ class ProblemSizeReducer {
         m_variable_bound_update_count_in_preprocess   = 0;
         m_variable_bound_update_count_in_optimization = 0;
         m_is_preprocess                               = true;
+        m_elapsed_times.clear();
     }
 
     /*************************************************************************/
@@ -160,6 +204,9 @@ class ProblemSizeReducer {
 
     /*************************************************************************/
     inline int remove_independent_variables(const bool a_IS_ENABLED_PRINT) {
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         int number_of_newly_fixed_variables = 0;
         for (auto &&proxy : m_model_ptr->variable_proxies()) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
@@ -177,13 +224,29 @@ class ProblemSizeReducer {
                 }
             }
         }
+
+        this->add_elapsed_time("remove_independent_variables",
+                               time_keeper.clock());
+
         return number_of_newly_fixed_variables;
     }
 
     /*************************************************************************/
     inline int remove_redundant_constraints_with_tightening_variable_bounds(
         const bool a_IS_ENABLED_PRINT) {
-        int number_of_newly_disabled_constraints = 0;
+        /**
+         * This method performs a round of the bound propagation. The enabled
+         * constraints are propagated independently in parallel on the bounds
+         * of variables at the beginning of the round, and the tightened bounds
+         * are merged by atomic updates. The reductions are applied to the
+         * model in the order of constraints afterward, so that the result does
+         * not depend on the number of threads.
+         */
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
+        std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+            constraint_ptrs;
         for (auto &&proxy : m_model_ptr->constraint_proxies()) {
             for (auto &&constraint : proxy.flat_indexed_constraints()) {
                 /**
@@ -193,18 +256,130 @@ class ProblemSizeReducer {
                 if (!constraint.is_enabled()) {
                     continue;
                 }
+                constraint_ptrs.push_back(&constraint);
+            }
+        }
 
-                const auto &[is_constraint_disabled,
-                             is_variable_bound_updated] =
-                    remove_redundant_constraint_with_tightening_variable_bound(
-                        &constraint,  //
-                        a_IS_ENABLED_PRINT);
+        std::vector<model_component::Variable<T_Variable, T_Expression> *>
+            variable_ptrs;
+        std::unordered_map<model_component::Variable<T_Variable, T_Expression> *,
+                           int>
+            variable_indices;
+        for (auto &&proxy : m_model_ptr->variable_proxies()) {
+            for (auto &&variable : proxy.flat_indexed_variables()) {
+                variable_indices[&variable] = variable_ptrs.size();
+                variable_ptrs.push_back(&variable);
+            }
+        }
 
-                if (is_constraint_disabled) {
-                    number_of_newly_disabled_constraints++;
-                }
+        const int CONSTRAINTS_SIZE = constraint_ptrs.size();
+        const int VARIABLES_SIZE   = variable_ptrs.size();
+
+        std::vector<std::atomic<T_Variable>> lower_bounds(VARIABLES_SIZE);
+        std::vector<std::atomic<T_Variable>> upper_bounds(VARIABLES_SIZE);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            lower_bounds[i].store(variable_ptrs[i]->lower_bound());
+            upper_bounds[i].store(variable_ptrs[i]->upper_bound());
+        }
+
+        std::vector<ConstraintPropagationResult<T_Variable, T_Expression>>
+            results(CONSTRAINTS_SIZE);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            results[i] = this->propagate_constraint(constraint_ptrs[i],
+                                                    a_IS_ENABLED_PRINT);
+            for (const auto &tightened_lower_bound :
+                 results[i].tightened_lower_bounds) {
+                atomic_max(&lower_bounds[variable_indices.at(
+                               tightened_lower_bound.first)],
+                           tightened_lower_bound.second);
+            }
+            for (const auto &tightened_upper_bound :
+                 results[i].tightened_upper_bounds) {
+                atomic_min(&upper_bounds[variable_indices.at(
+                               tightened_upper_bound.first)],
+                           tightened_upper_bound.second);
             }
         }
+
+        int *variable_bound_update_count_ptr =
+            m_is_preprocess ? &m_variable_bound_update_count_in_preprocess
+                            : &m_variable_bound_update_count_in_optimization;
+
+        int number_of_newly_disabled_constraints = 0;
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            for (const auto &message : results[i].messages) {
+                utility::print_message(message, a_IS_ENABLED_PRINT);
+            }
+            if (results[i].is_constraint_disabled) {
+                constraint_ptrs[i]->disable();
+                number_of_newly_disabled_constraints++;
+            }
+        }
+
+        /**
+         * The fixings derived from different constraints are merged per
+         * variable. Conflicting fixings, and fixings outside of the merged
+         * bounds, mean that the problem is infeasible.
+         */
+        std::vector<std::optional<T_Variable>> fixed_values(VARIABLES_SIZE);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            if (results[i].fixed_variable_ptr == nullptr) {
+                continue;
+            }
+            auto &fixed_value =
+                fixed_values[variable_indices.at(results[i].fixed_variable_ptr)];
+            if (fixed_value && *fixed_value != results[i].fixed_value) {
+                throw model_component::InfeasibleError(
+                    utility::format_error_location(
+                        __FILE__, __LINE__, __func__,
+                        "The variable " +
+                            results[i].fixed_variable_ptr->name() +
+                            " is fixed by conflicting values " +
+                            std::to_string(*fixed_value) + " and " +
+                            std::to_string(results[i].fixed_value) + "."));
+            }
+            fixed_value = results[i].fixed_value;
+        }
+
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto LOWER_BOUND = lower_bounds[i].load();
+            const auto UPPER_BOUND = upper_bounds[i].load();
+            if (fixed_values[i] && (*fixed_values[i] < LOWER_BOUND ||
+                                    *fixed_values[i] > UPPER_BOUND)) {
+                throw model_component::InfeasibleError(
+                    utility::format_error_location(
+                        __FILE__, __LINE__, __func__,
+                        "The fixed value " + std::to_string(*fixed_values[i]) +
+                            " of the variable " + variable_ptrs[i]->name() +
+                            " is out of the bounds [" +
+                            std::to_string(LOWER_BOUND) + ", " +
+                            std::to_string(UPPER_BOUND) + "]."));
+            }
+
+            /**
+             * Only the bounds actually changed are counted, since several
+             * constraints may tighten the same bound in a round.
+             */
+            const int NUMBER_OF_UPDATES =
+                (LOWER_BOUND != variable_ptrs[i]->lower_bound()) +
+                (UPPER_BOUND != variable_ptrs[i]->upper_bound());
+            if (NUMBER_OF_UPDATES > 0) {
+                variable_ptrs[i]->set_bound(LOWER_BOUND, UPPER_BOUND);
+                (*variable_bound_update_count_ptr) += NUMBER_OF_UPDATES;
+            }
+            if (fixed_values[i]) {
+                variable_ptrs[i]->fix_by(*fixed_values[i]);
+            }
+        }
+
+        this->add_elapsed_time(
+            "remove_redundant_constraints_with_tightening_variable_bounds",
+            time_keeper.clock());
+
         return number_of_newly_disabled_constraints;
     }
 
@@ -214,17 +389,64 @@ class ProblemSizeReducer {
         model_component::Constraint<T_Variable, T_Expression>
                   *a_constraint_ptr,  //
         const bool a_IS_ENABLED_PRINT) {
+        int *variable_bound_update_count_ptr =
+            m_is_preprocess ? &m_variable_bound_update_count_in_preprocess
+                            : &m_variable_bound_update_count_in_optimization;
+
+        const auto RESULT =
+            this->propagate_constraint(a_constraint_ptr, a_IS_ENABLED_PRINT);
+
+        for (const auto &message : RESULT.messages) {
+            utility::print_message(message, a_IS_ENABLED_PRINT);
+        }
+
+        for (const auto &[variable_ptr, bound] :
+             RESULT.tightened_lower_bounds) {
+            variable_ptr->set_bound(
+                std::max(variable_ptr->lower_bound(), bound),
+                variable_ptr->upper_bound());
+        }
+        for (const auto &[variable_ptr, bound] :
+             RESULT.tightened_upper_bounds) {
+            variable_ptr->set_bound(
+                variable_ptr->lower_bound(),
+                std::min(variable_ptr->upper_bound(), bound));
+        }
+        (*variable_bound_update_count_ptr) +=
+            RESULT.number_of_variable_bound_updates();
+
+        if (RESULT.fixed_variable_ptr != nullptr) {
+            RESULT.fixed_variable_ptr->fix_by(RESULT.fixed_value);
+        }
+
+        if (RESULT.is_constraint_disabled) {
+            a_constraint_ptr->disable();
+        }
+
+        return std::make_pair(RESULT.is_constraint_disabled,
+                              RESULT.is_variable_bound_updated());
+    }
+
+    /*************************************************************************/
+    inline ConstraintPropagationResult<T_Variable, T_Expression>
+    propagate_constraint(model_component::Constraint<T_Variable, T_Expression>
+                                   *a_constraint_ptr,  //
+                         const bool a_IS_ENABLED_PRINT) const {
         const int BOUND_LIMIT = 100000;
         /**
-         * NOTE: This function should be called from
-         * remove_redundant_constraints_with_tightening_variable_bounds().
+         * NOTE: This function does not modify the model except for the
+         * mutable variable sensitivities of the constraint, so that it can be
+         * called for different constraints in parallel. The messages are
+         * stored in the result only if a_IS_ENABLED_PRINT is true.
          */
-        bool is_constraint_disabled    = false;
-        bool is_variable_bound_updated = false;
+        ConstraintPropagationResult<T_Variable, T_Expression> result;
 
-        int *variable_bound_update_count_ptr =
-            m_is_preprocess ? &m_variable_bound_update_count_in_preprocess
-                            : &m_variable_bound_update_count_in_optimization;
+        auto add_message = [&result,
+                            a_IS_ENABLED_PRINT](const std::string &a_MESSAGE) {
+            if (a_IS_ENABLED_PRINT) {
+                result.messages.push_back(a_MESSAGE);
+            }
+        };
 
         a_constraint_ptr->expression().setup_mutable_variable_sensitivities();
 
@@ -263,16 +485,12 @@ class ProblemSizeReducer {
             (a_constraint_ptr->sense() ==
                  model_component::ConstraintSense::Greater &&
              constraint_lower_bound >= 0)) {
-            utility::print_message("The redundant constraint " +
-                                       a_constraint_ptr->name() +
-                                       " was removed.",
-                                   a_IS_ENABLED_PRINT);
+            add_message("The redundant constraint " + a_constraint_ptr->name() +
+                        " was removed.");
 
             if (a_constraint_ptr->is_enabled()) {
-                a_constraint_ptr->disable();
-                is_constraint_disabled = true;
-                return std::make_pair(is_constraint_disabled,
-                                      is_variable_bound_updated);
+                result.is_constraint_disabled = true;
+                return result;
             }
         }
 
@@ -298,21 +516,15 @@ class ProblemSizeReducer {
                  * If the singleton constraint is defined by an equality as
                  * ax+b=0, the value of the variable x will be fixed at -b/a.
                  */
-                utility::print_message(  //
+                add_message(  //
                     "The constraint " + a_constraint_ptr->name() +
-                        " was removed instead of fixing the value of the "
-                        "variable " +
-                        variable_ptr->name() + " by " +
-                        std::to_string(bound_temp) + ".",
-                    a_IS_ENABLED_PRINT);
+                    " was removed instead of fixing the value of the "
+                    "variable " +
+                    variable_ptr->name() + " by " + std::to_string(bound_temp) +
+                    ".");
 
-                variable_ptr->fix_by(bound_temp);
-                if (a_constraint_ptr->is_enabled()) {
-                    a_constraint_ptr->disable();
-                    is_constraint_disabled = true;
-                    return std::make_pair(is_constraint_disabled,
-                                          is_variable_bound_updated);
-                }
+                result.fixed_variable_ptr = variable_ptr;
+                result.fixed_value        = bound_temp;
             } else if ((a_constraint_ptr->sense() ==
                             model_component::ConstraintSense::Less &&
                         coefficient > 0) ||
@@ -330,36 +542,24 @@ class ProblemSizeReducer {
                 if (bound_floor < variable_upper_bound &&
                     abs(bound_floor) < BOUND_LIMIT) {
                     if (a_constraint_ptr->name() == "") {
-                        utility::print_message(
-                            "The upper bound of the variable " +
-                                variable_ptr->name() + " was tightened by " +
-                                std::to_string(bound_floor) + ".",
-                            a_IS_ENABLED_PRINT);
+                        add_message("The upper bound of the variable " +
+                                    variable_ptr->name() +
+                                    " was tightened by " +
+                                    std::to_string(bound_floor) + ".");
                     } else {
-                        utility::print_message(
+                        add_message(
                             "The constraint " + a_constraint_ptr->name() +
-                                " was removed instead of tightening the upper "
-                                "bound of the variable " +
-                                variable_ptr->name() + " by " +
-                                std::to_string(bound_floor) + ".",
-                            a_IS_ENABLED_PRINT);
+                            " was removed instead of tightening the upper "
+                            "bound of the variable " +
+                            variable_ptr->name() + " by " +
+                            std::to_string(bound_floor) + ".");
                     }
-                    variable_ptr->set_bound(variable_lower_bound, bound_floor);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    result.tightened_upper_bounds.emplace_back(variable_ptr,
+                                                               bound_floor);
                 } else {
-                    utility::print_message(  //
-                        "The redundant constraint " + a_constraint_ptr->name() +
-                            " was removed.",
-                        a_IS_ENABLED_PRINT);
+                    add_message("The redundant constraint " +
+                                a_constraint_ptr->name() + " was removed.");
                 }
-                if (a_constraint_ptr->is_enabled()) {
-                    a_constraint_ptr->disable();
-                    is_constraint_disabled = true;
-                    return std::make_pair(is_constraint_disabled,
-                                          is_variable_bound_updated);
-                }
-
             } else if ((a_constraint_ptr->sense() ==
                             model_component::ConstraintSense::Greater &&
                         coefficient > 0) ||
@@ -377,38 +577,29 @@ class ProblemSizeReducer {
                 if (bound_ceil > variable_lower_bound &&
                     abs(bound_ceil) < BOUND_LIMIT) {
                     if (a_constraint_ptr->name() == "") {
-                        utility::print_message(  //
-                            "The lower bound of the variable " +
-                                variable_ptr->name() + " was tightened by " +
-                                std::to_string(bound_ceil) + ".",
-                            a_IS_ENABLED_PRINT);
+                        add_message("The lower bound of the variable " +
+                                    variable_ptr->name() +
+                                    " was tightened by " +
+                                    std::to_string(bound_ceil) + ".");
                     } else {
-                        utility::print_message(
+                        add_message(
                             "The constraint " + a_constraint_ptr->name() +
-                                " was removed instead of tightening the lower "
-                                "bound of the variable " +
-                                variable_ptr->name() + " by " +
-                                std::to_string(bound_ceil) + ".",
-                            a_IS_ENABLED_PRINT);
+                            " was removed instead of tightening the lower "
+                            "bound of the variable " +
+                            variable_ptr->name() + " by " +
+                            std::to_string(bound_ceil) + ".");
                     }
-                    variable_ptr->set_bound(bound_ceil, variable_upper_bound);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    result.tightened_lower_bounds.emplace_back(variable_ptr,
+                                                               bound_ceil);
                 } else {
-                    utility::print_message(  //
-                        "The redundant constraint " + a_constraint_ptr->name() +
-                            " was removed.",
-                        a_IS_ENABLED_PRINT);
-                }
-                if (a_constraint_ptr->is_enabled()) {
-                    a_constraint_ptr->disable();
-                    is_constraint_disabled = true;
-                    return std::make_pair(is_constraint_disabled,
-                                          is_variable_bound_updated);
+                    add_message("The redundant constraint " +
+                                a_constraint_ptr->name() + " was removed.");
                 }
             }
-            return std::make_pair(is_constraint_disabled,
-                                  is_variable_bound_updated);
+            if (a_constraint_ptr->is_enabled()) {
+                result.is_constraint_disabled = true;
+            }
+            return result;
         }
 
         /**
@@ -431,14 +622,11 @@ class ProblemSizeReducer {
                     static_cast<T_Variable>(std::ceil(bound_temp));
                 if (bound_ceil > variable_lower_bound &&
                     abs(bound_ceil) < BOUND_LIMIT) {
-                    utility::print_message(  //
-                        "The lower bound of the variable " +
-                            variable_ptr->name() + " was tightened by " +
-                            std::to_string(bound_ceil) + ".",
-                        a_IS_ENABLED_PRINT);
-                    variable_ptr->set_bound(bound_ceil, variable_upper_bound);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    add_message("The lower bound of the variable " +
+                                variable_ptr->name() + " was tightened by " +
+                                std::to_string(bound_ceil) + ".");
+                    result.tightened_lower_bounds.emplace_back(variable_ptr,
+                                                               bound_ceil);
                 }
             }
             if (a_constraint_ptr->is_less_or_equal()) {
@@ -449,14 +637,11 @@ class ProblemSizeReducer {
                     static_cast<T_Variable>(std::floor(bound_temp));
                 if (bound_floor < variable_upper_bound &&
                     abs(bound_floor) < BOUND_LIMIT) {
-                    utility::print_message(  //
-                        "The upper bound of the variable " +
-                            variable_ptr->name() + " was tightened by " +
-                            std::to_string(bound_floor) + ".",
-                        a_IS_ENABLED_PRINT);
-                    variable_ptr->set_bound(variable_lower_bound, bound_floor);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    add_message("The upper bound of the variable " +
+                                variable_ptr->name() + " was tightened by " +
+                                std::to_string(bound_floor) + ".");
+                    result.tightened_upper_bounds.emplace_back(variable_ptr,
+                                                               bound_floor);
                 }
             }
         }
@@ -477,14 +662,11 @@ class ProblemSizeReducer {
                     static_cast<T_Variable>(std::floor(bound_temp));
                 if (bound_floor < variable_upper_bound &&
                     abs(bound_floor) < BOUND_LIMIT) {
-                    utility::print_message(  //
-                        "The upper bound of the variable " +
-                            variable_ptr->name() + " was tightened by " +
-                            std::to_string(bound_floor) + ".",
-                        a_IS_ENABLED_PRINT);
-                    variable_ptr->set_bound(variable_lower_bound, bound_floor);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    add_message("The upper bound of the variable " +
+                                variable_ptr->name() + " was tightened by " +
+                                std::to_string(bound_floor) + ".");
+                    result.tightened_upper_bounds.emplace_back(variable_ptr,
+                                                               bound_floor);
                 }
             }
             if (a_constraint_ptr->is_less_or_equal()) {
@@ -495,23 +677,22 @@ class ProblemSizeReducer {
                     static_cast<T_Variable>(std::ceil(bound_temp));
                 if (bound_ceil > variable_lower_bound &&
                     abs(bound_ceil) < BOUND_LIMIT) {
-                    utility::print_message(  //
-                        "The lower bound of the variable " +
-                            variable_ptr->name() + " was tightened by " +
-                            std::to_string(bound_ceil) + ".",
-                        a_IS_ENABLED_PRINT);
-                    variable_ptr->set_bound(bound_ceil, variable_upper_bound);
-                    is_variable_bound_updated = true;
-                    (*variable_bound_update_count_ptr)++;
+                    add_message("The lower bound of the variable " +
+                                variable_ptr->name() + " was tightened by " +
+                                std::to_string(bound_ceil) + ".");
+                    result.tightened_lower_bounds.emplace_back(variable_ptr,
+                                                               bound_ceil);
                 }
             }
         }
-        return std::make_pair(is_constraint_disabled,
-                              is_variable_bound_updated);
+        return result;
     }
 
     /*************************************************************************/
     inline int remove_implicit_fixed_variables(const bool a_IS_ENABLED_PRINT) {
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         int number_of_newly_fixed_variables = 0;
         for (auto &&proxy : m_model_ptr->variable_proxies()) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
@@ -529,6 +710,10 @@ class ProblemSizeReducer {
                 }
             }
         }
+
+        this->add_elapsed_time("remove_implicit_fixed_variables",
+                               time_keeper.clock());
+
         return number_of_newly_fixed_variables;
     }
 
@@ -567,6 +752,9 @@ class ProblemSizeReducer {
             "paritioning/covering/packing constraints...",
             a_IS_ENABLED_PRINT);
 
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         const int SET_PARTITIONINGS_SIZE =
             m_model_ptr->constraint_type_reference()
                 .set_partitioning_ptrs.size();
@@ -600,8 +788,11 @@ class ProblemSizeReducer {
         /**
          * Compute a hash for each variable.
          */
-        for (auto &&variable_ptr : variable_ptrs) {
-            variable_ptr->setup_hash();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            variable_ptrs[i]->setup_hash();
         }
 
         /**
@@ -698,6 +889,10 @@ class ProblemSizeReducer {
                 break;
             }
         }
+
+        this->add_elapsed_time("remove_redundant_set_variables",
+                               time_keeper.clock());
+
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
         return number_of_newly_fixed_variables;
     }
@@ -709,6 +904,9 @@ class ProblemSizeReducer {
         utility::print_message("Removing implicit equality constraints...",
                                a_IS_ENABLED_PRINT);
 
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         auto &reference = m_model_ptr->constraint_type_reference();
         int   number_of_newly_disabled_constraints = 0;
         std::vector<model_component::Constraint<T_Variable, T_Expression> *>
@@ -768,12 +966,15 @@ class ProblemSizeReducer {
             return number_of_newly_disabled_constraints;
         }
 
-        for (auto constraint_ptr : constraint_ptrs) {
-            constraint_ptr->expression().setup_hash();
-        }
-
         const int CONSTRAINTS_SIZE = constraint_ptrs.size();
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            constraint_ptrs[i]->expression().setup_hash();
+        }
+
         std::stable_sort(constraint_ptrs.begin(), constraint_ptrs.end(),
                          [](const auto &a_FIRST, const auto &a_SECOND) {
                              return a_FIRST->expression().hash() <
@@ -885,6 +1086,9 @@ class ProblemSizeReducer {
             }
         }
 
+        this->add_elapsed_time("extract_implicit_equality_constraints",
+                               time_keeper.clock());
+
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
         return number_of_newly_disabled_constraints;
     }
@@ -895,6 +1099,9 @@ class ProblemSizeReducer {
         utility::print_message("Removing duplicated constraints...",
                                a_IS_ENABLED_PRINT);
 
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         auto &reference = m_model_ptr->constraint_type_reference();
         int   number_of_newly_disabled_constraints = 0;
 
@@ -1015,6 +1222,9 @@ class ProblemSizeReducer {
             this->remove_duplicated_constraints(  //
                 reference.general_linear_ptrs, a_IS_ENABLED_PRINT);
 
+        this->add_elapsed_time("remove_duplicated_constraints",
+                               time_keeper.clock());
+
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
         return number_of_newly_disabled_constraints;
     }
@@ -1036,12 +1246,15 @@ class ProblemSizeReducer {
             return number_of_newly_disabled_constraints;
         }
 
-        for (auto constraint_ptr : constraint_ptrs) {
-            constraint_ptr->expression().setup_hash();
-        }
-
         const int CONSTRAINTS_SIZE = constraint_ptrs.size();
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            constraint_ptrs[i]->expression().setup_hash();
+        }
+
         std::stable_sort(constraint_ptrs.begin(), constraint_ptrs.end(),
                          [](const auto &a_FIRST, const auto &a_SECOND) {
                              return a_FIRST->expression().hash() <
@@ -1116,6 +1329,9 @@ class ProblemSizeReducer {
             "and included variables... ",
             a_IS_ENABLED_PRINT);
 
+        utility::TimeKeeper time_keeper;
+        time_keeper.set_start_time();
+
         auto &exclusive_or_ptrs =
             m_model_ptr->constraint_type_reference().exclusive_or_ptrs;
         auto &set_partitioning_constraint_ptrs =
@@ -1140,6 +1356,9 @@ class ProblemSizeReducer {
             model_component::Variable<T_Variable, T_Expression> *>>
             variable_ptr_sets(CONSTRAINTS_SIZE);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
         for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
             for (const auto &sensitivity :
                  constraint_ptrs[i]->expression().sensitivities()) {
@@ -1147,6 +1366,16 @@ class ProblemSizeReducer {
             }
         }
 
+        /**
+         * For each constraint i, find the first constraint j (j > i) whose
+         * variables are included in those of the constraint i. The searches
+         * are independent of each other and are performed in parallel.
+         */
+        std::vector<int> including_indices(CONSTRAINTS_SIZE, -1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
         for (auto i = 0; i < CONSTRAINTS_SIZE - 1; i++) {
             for (auto j = i + 1; j < CONSTRAINTS_SIZE; j++) {
                 bool is_included = true;
@@ -1159,32 +1388,43 @@ class ProblemSizeReducer {
                 }
 
                 if (is_included) {
-                    constraint_ptrs[i]->disable();
-                    utility::print_message(  //
-                        "The redundant constraint " +
-                            constraint_ptrs[i]->name() + " was removed.",
-                        a_IS_ENABLED_PRINT);
+                    including_indices[i] = j;
+                    break;
+                }
+            }
+        }
 
-                    for (const auto &variable_ptr : variable_ptr_sets[i]) {
-                        if (variable_ptr_sets[j].find(variable_ptr) ==
-                            variable_ptr_sets[j].end()) {
-                            variable_ptr->fix_by(0);
-                            utility::print_message(  //
-                                "The value of redundant variable " +
-                                    variable_ptr->name() + " in constraint " +
-                                    constraint_ptrs[i]->name() +
-                                    " was fixed at 0.",
-                                a_IS_ENABLED_PRINT);
-                            number_of_newly_fixed_variables++;
-                        }
-                    }
+        for (auto i = 0; i < CONSTRAINTS_SIZE - 1; i++) {
+            const int J = including_indices[i];
+            if (J < 0) {
+                continue;
+            }
 
-                    number_of_newly_disabled_constraints++;
-                    break;
+            constraint_ptrs[i]->disable();
+            utility::print_message(  //
+                "The redundant constraint " + constraint_ptrs[i]->name() +
+                    " was removed.",
+                a_IS_ENABLED_PRINT);
+
+            for (const auto &variable_ptr : variable_ptr_sets[i]) {
+                if (variable_ptr_sets[J].find(variable_ptr) ==
+                    variable_ptr_sets[J].end()) {
+                    variable_ptr->fix_by(0);
+                    utility::print_message(  //
+                        "The value of redundant variable " +
+                            variable_ptr->name() + " in constraint " +
+                            constraint_ptrs[i]->name() + " was fixed at 0.",
+                        a_IS_ENABLED_PRINT);
+                    number_of_newly_fixed_variables++;
                 }
             }
+
+            number_of_newly_disabled_constraints++;
         }
 
+        this->add_elapsed_time("remove_redundant_set_constraints",
+                               time_keeper.clock());
+
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
         return std::make_pair(number_of_newly_disabled_constraints,
                               number_of_newly_fixed_variables);
@@ -1209,6 +1449,25 @@ class ProblemSizeReducer {
     inline bool is_preprocess(void) const {
         return m_is_preprocess;
     }
+
+    /*************************************************************************/
+    inline const std::vector<std::pair<std::string, double>> &elapsed_times(
+        void) const {
+        return m_elapsed_times;
+    }
+
+    /*************************************************************************/
+    inline void print_elapsed_times(const bool a_IS_ENABLED_PRINT) const {
+        utility::print_single_line(a_IS_ENABLED_PRINT);
+        utility::print_message("Elapsed time of each presolve pass:",
+                               a_IS_ENABLED_PRINT);
+        for (const auto &elapsed_time : m_elapsed_times) {
+            utility::print_info(  //
+                " -- " + elapsed_time.first + ": " +
+                    utility::to_string(elapsed_time.second, "%.3fsec"),
+                a_IS_ENABLED_PRINT);
+        }
+    }
 };
 }  // namespace printemps::preprocess
 #endif
@@ -187,11 +187,14 @@ class Verifier {
 
                 selected_variable_ptr->set_value_if_mutable(1);
 
-                for (auto &&sensitivity :
-                     selected_variable_ptr->constraint_sensitivities()) {
-                    related_constraint_ptr_values[sensitivity.first] +=
-                        sensitivity.second;
-                }
+                m_model_ptr->for_each_constraint_sensitivity(
+                    selected_variable_ptr,
+                    [&related_constraint_ptr_values](
+                        auto *a_constraint_ptr,
+                        const T_Expression a_SENSITIVITY) {
+                        related_constraint_ptr_values[a_constraint_ptr] +=
+                            a_SENSITIVITY;
+                    });
             }
             /**
              * Correct initial values or return logic error if there are
@@ -209,31 +212,38 @@ class Verifier {
                 int  best_violation        = std::numeric_limits<int>::max();
                 for (auto &&variable_ptr : selected_variable_ptrs) {
                     int violation = 0;
-                    for (auto &&sensitivity :
-                         variable_ptr->constraint_sensitivities()) {
-                        const auto CONSTRAINT_VALUE =
-                            related_constraint_ptr_values[sensitivity.first] +
-                            sensitivity.second +
-                            sensitivity.first->expression().constant_value();
-                        switch (sensitivity.first->sense()) {
-                            case model_component::ConstraintSense::Less: {
-                                violation +=
-                                    std::max(CONSTRAINT_VALUE,
-                                             static_cast<T_Expression>(0));
-                                break;
-                            }
-                            case model_component::ConstraintSense::Equal: {
-                                violation += std::abs(CONSTRAINT_VALUE);
-                                break;
-                            }
-                            case model_component::ConstraintSense::Greater: {
-                                violation +=
-                                    std::max(-CONSTRAINT_VALUE,
-                                             static_cast<T_Expression>(0));
-                                break;
+                    m_model_ptr->for_each_constraint_sensitivity(
+                        variable_ptr,
+                        [&related_constraint_ptr_values, &violation](
+                            auto *a_constraint_ptr,
+                            const T_Expression a_SENSITIVITY) {
+                            const auto CONSTRAINT_VALUE =
+                                related_constraint_ptr_values
+                                    [a_constraint_ptr] +
+                                a_SENSITIVITY +
+                                a_constraint_ptr->expression()
+                                    .constant_value();
+                            switch (a_constraint_ptr->sense()) {
+                                case model_component::ConstraintSense::Less: {
+                                    violation += std::max(
+                                        CONSTRAINT_VALUE,
+                                        static_cast<T_Expression>(0));
+                                    break;
+                                }
+                                case model_component::ConstraintSense::
+                                    Equal: {
+                                    violation += std::abs(CONSTRAINT_VALUE);
+                                    break;
+                                }
+                                case model_component::ConstraintSense::
+                                    Greater: {
+                                    violation += std::max(
+                                        -CONSTRAINT_VALUE,
+                                        static_cast<T_Expression>(0));
+                                    break;
+                                }
                             }
-                        }
-                    }
+                        });
 
                     if (violation < best_violation) {
                         best_violation        = violation;
@@ -261,11 +271,14 @@ class Verifier {
 
                 selected_variable_ptr->set_value_if_mutable(1);
 
-                for (auto &&sensitivity :
-                     selected_variable_ptr->constraint_sensitivities()) {
-                    related_constraint_ptr_values[sensitivity.first] +=
-                        sensitivity.second;
-                }
+                m_model_ptr->for_each_constraint_sensitivity(
+                    selected_variable_ptr,
+                    [&related_constraint_ptr_values](
+                        auto *a_constraint_ptr,
+                        const T_Expression a_SENSITIVITY) {
+                        related_constraint_ptr_values[a_constraint_ptr] +=
+                            a_SENSITIVITY;
+                    });
             }
             /**
              * Correct initial values or return logic error if there is
@@ -286,31 +299,38 @@ class Verifier {
                         continue;
                     }
                     int violation = 0;
-                    for (auto &&sensitivity :
-                         variable_ptr->constraint_sensitivities()) {
-                        const auto CONSTRAINT_VALUE =
-                            related_constraint_ptr_values[sensitivity.first] +
-                            sensitivity.second +
-                            sensitivity.first->expression().constant_value();
-                        switch (sensitivity.first->sense()) {
-                            case model_component::ConstraintSense::Less: {
-                                violation +=
-                                    std::max(CONSTRAINT_VALUE,
-                                             static_cast<T_Expression>(0));
-                                break;
+                    m_model_ptr->for_each_constraint_sensitivity(
+                        variable_ptr,
+                        [&related_constraint_ptr_values, &violation](
+                            auto *a_constraint_ptr,
+                            const T_Expression a_SENSITIVITY) {
+                            const auto CONSTRAINT_VALUE =
+                                related_constraint_ptr_values
+                                    [a_constraint_ptr] +
+                                a_SENSITIVITY +
+                                a_constraint_ptr->expression()
+                                    .constant_value();
+                            switch (a_constraint_ptr->sense()) {
+                                case model_component::ConstraintSense::Less: {
+                                    violation += std::max(
+                                        CONSTRAINT_VALUE,
+                                        static_cast<T_Expression>(0));
+                                    break;
+                                }
+                                case model_component::ConstraintSense::
+                                    Equal: {
+                                    violation += std::abs(CONSTRAINT_VALUE);
+                                    break;
+                                }
+                                case model_component::ConstraintSense::
+                                    Greater: {
+                                    violation += std::max(
+                                        -CONSTRAINT_VALUE,
+                                        static_cast<T_Expression>(0));
+                                    break;
+                                }
                             }
-                            case model_component::ConstraintSense::Equal: {
-                                violation += std::abs(CONSTRAINT_VALUE);
-                                break;
-                            }
-                            case model_component::ConstraintSense::Greater: {
-                                violation +=
-                                    std::max(-CONSTRAINT_VALUE,
-                                             static_cast<T_Expression>(0));
-                                break;
-                            }
-                        }
-                    }
+                        });
 
                     if (violation < best_violation) {
                         best_violation        = violation;
@@ -329,11 +349,14 @@ class Verifier {
                 this->print_correction(selected_variable_ptr->name(), 0, 1,
                                        a_IS_ENABLED_PRINT);
 
-                for (auto &&sensitivity :
-                     selected_variable_ptr->constraint_sensitivities()) {
-                    related_constraint_ptr_values[sensitivity.first] +=
-                        sensitivity.second;
-                }
+                m_model_ptr->for_each_constraint_sensitivity(
+                    selected_variable_ptr,
+                    [&related_constraint_ptr_values](
+                        auto *a_constraint_ptr,
+                        const T_Expression a_SENSITIVITY) {
+                        related_constraint_ptr_values[a_constraint_ptr] +=
+                            a_SENSITIVITY;
+                    });
             } else {
                 selected_variable_ptrs.front()->select();
             }
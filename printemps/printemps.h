@@ -13,6 +13,8 @@
 #include "multi_array/multi_array.h"
 #include "helper/helper.h"
 #include "mps/mps.h"
+#include "mps/mps_accessor.h"
+#include "mps/mps_snapshot.h"
 #include "opb/opb.h"
 #include "wcnf/wcnf.h"
 #include "option/option.h"
@@ -183,6 +183,49 @@ class IncumbentHolder {
         return status;
     }
 
+    /*************************************************************************/
+    inline int merge(const IncumbentHolder<T_Variable, T_Expression> &a_OTHER) {
+        /**
+         * This method takes in the global augmented and the feasible
+         * incumbents of the other holder, which is used to exchange the
+         * incumbents among parallel walkers. The local augmented incumbent is
+         * not merged since it depends on the local penalty coefficients of
+         * each walker.
+         */
+        int status = IncumbentHolderConstant::STATUS_NOT_UPDATED;
+
+        if (a_OTHER.m_global_augmented_incumbent_objective +
+                constant::EPSILON <
+            m_global_augmented_incumbent_objective) {
+            status += IncumbentHolderConstant::
+                STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE;
+
+            m_global_augmented_incumbent_solution =
+                a_OTHER.m_global_augmented_incumbent_solution;
+            m_global_augmented_incumbent_score =
+                a_OTHER.m_global_augmented_incumbent_score;
+            m_global_augmented_incumbent_objective =
+                a_OTHER.m_global_augmented_incumbent_objective;
+        }
+
+        if (a_OTHER.m_is_found_feasible_solution) {
+            m_is_found_feasible_solution = true;
+
+            if (a_OTHER.m_feasible_incumbent_objective + constant::EPSILON <
+                m_feasible_incumbent_objective) {
+                status +=
+                    IncumbentHolderConstant::STATUS_FEASIBLE_INCUMBENT_UPDATE;
+
+                m_feasible_incumbent_solution =
+                    a_OTHER.m_feasible_incumbent_solution;
+                m_feasible_incumbent_score = a_OTHER.m_feasible_incumbent_score;
+                m_feasible_incumbent_objective =
+                    a_OTHER.m_feasible_incumbent_objective;
+            }
+        }
+        return status;
+    }
+
     /*************************************************************************/
     inline void reset_local_augmented_incumbent(void) {
         m_local_augmented_incumbent_objective =
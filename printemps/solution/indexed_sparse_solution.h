@@ -0,0 +1,147 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLUTION_INDEXED_SPARSE_SOLUTION_H__
+#define PRINTEMPS_SOLUTION_INDEXED_SPARSE_SOLUTION_H__
+
+namespace printemps::solution {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct IndexedSparseSolution {
+    /**
+     * This structure holds the nonzero variables of a solution as the
+     * variable ids sorted in ascending order and the corresponding values.
+     * It is used to store a large number of solutions during the search, and
+     * is converted to SparseSolution, which is keyed by the variable names,
+     * only for output.
+     */
+    T_Expression objective;
+    T_Expression total_violation;
+    double       global_augmented_objective;
+    bool         is_feasible;
+
+    std::vector<std::int32_t> variable_ids;
+    std::vector<T_Variable>   variable_values;
+
+    /*************************************************************************/
+    IndexedSparseSolution(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->objective                  = 0;
+        this->total_violation            = 0;
+        this->global_augmented_objective = 0.0;
+        this->is_feasible                = false;
+        this->variable_ids.clear();
+        this->variable_values.clear();
+    }
+
+    /*************************************************************************/
+    inline int number_of_nonzeros(void) const noexcept {
+        return this->variable_ids.size();
+    }
+
+    /*************************************************************************/
+    inline bool has_same_variables(
+        const IndexedSparseSolution<T_Variable, T_Expression> &a_SOLUTION)
+        const {
+        return this->variable_ids == a_SOLUTION.variable_ids &&
+               this->variable_values == a_SOLUTION.variable_values;
+    }
+
+    /*************************************************************************/
+    inline std::uint64_t compute_hash(void) const {
+        /**
+         * The hash is computed in the same manner as
+         * SparseSolution::compute_hash(), with the variable ids in place of
+         * the names.
+         */
+        std::uint64_t hash          = 0;
+        const int     NONZEROS_SIZE = this->variable_ids.size();
+        for (auto i = 0; i < NONZEROS_SIZE; i++) {
+            std::uint64_t key =
+                std::hash<std::int32_t>()(this->variable_ids[i]) ^
+                (std::hash<T_Variable>()(this->variable_values[i]) *
+                 0x9E3779B97F4A7C15ULL);
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            key *= 0xC4CEB9FE1A85EC53ULL;
+            key ^= key >> 33;
+            hash ^= key;
+        }
+        return hash;
+    }
+
+    /*************************************************************************/
+    inline int distance(
+        const IndexedSparseSolution<T_Variable, T_Expression> &a_SOLUTION)
+        const {
+        /**
+         * This method returns the number of variables whose values differ,
+         * which coincides with the Hamming distance for binary variables. The
+         * sorted ids are merged in a single pass.
+         */
+        const auto &IDS_FIRST     = this->variable_ids;
+        const auto &IDS_SECOND    = a_SOLUTION.variable_ids;
+        const auto &VALUES_FIRST  = this->variable_values;
+        const auto &VALUES_SECOND = a_SOLUTION.variable_values;
+        const int   SIZE_FIRST    = IDS_FIRST.size();
+        const int   SIZE_SECOND   = IDS_SECOND.size();
+
+        int distance = 0;
+        int i        = 0;
+        int j        = 0;
+        while (i < SIZE_FIRST && j < SIZE_SECOND) {
+            if (IDS_FIRST[i] < IDS_SECOND[j]) {
+                distance++;
+                i++;
+            } else if (IDS_FIRST[i] > IDS_SECOND[j]) {
+                distance++;
+                j++;
+            } else {
+                distance += VALUES_FIRST[i] != VALUES_SECOND[j];
+                i++;
+                j++;
+            }
+        }
+        return distance + (SIZE_FIRST - i) + (SIZE_SECOND - j);
+    }
+
+    /*************************************************************************/
+    inline int support_distance(
+        const IndexedSparseSolution<T_Variable, T_Expression> &a_SOLUTION)
+        const {
+        /**
+         * This method returns the number of variables which are nonzero in
+         * only one of the solutions, i.e., the Hamming distance between the
+         * supports. The values are not compared.
+         */
+        const auto &IDS_FIRST   = this->variable_ids;
+        const auto &IDS_SECOND  = a_SOLUTION.variable_ids;
+        const int   SIZE_FIRST  = IDS_FIRST.size();
+        const int   SIZE_SECOND = IDS_SECOND.size();
+
+        int number_of_common_ids = 0;
+        int i                    = 0;
+        int j                    = 0;
+        while (i < SIZE_FIRST && j < SIZE_SECOND) {
+            const bool IS_LESS    = IDS_FIRST[i] < IDS_SECOND[j];
+            const bool IS_GREATER = IDS_FIRST[i] > IDS_SECOND[j];
+            number_of_common_ids += !IS_LESS && !IS_GREATER;
+            i += !IS_GREATER;
+            j += !IS_LESS;
+        }
+        return SIZE_FIRST + SIZE_SECOND - 2 * number_of_common_ids;
+    }
+};
+using IPIndexedSparseSolution = IndexedSparseSolution<int, double>;
+}  // namespace printemps::solution
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -74,74 +74,74 @@ class NamedSolution {
 
     /*************************************************************************/
     void write_json_by_name(const std::string& a_FILE_NAME) const {
-        utility::json::JsonObject object;
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
 
         // Summary
-        object.emplace_back("version", constant::VERSION);
-        object.emplace_back("name", m_name);
-        object.emplace_back("number_of_variables", m_number_of_variables);
-        object.emplace_back("number_of_constraints", m_number_of_constraints);
-        object.emplace_back("is_found_feasible_solution", m_is_feasible);
-        object.emplace_back("objective", m_objective);
-        object.emplace_back("total_violation", m_total_violation);
+        writer.member("version", constant::VERSION);
+        writer.member("name", m_name);
+        writer.member("number_of_variables", m_number_of_variables);
+        writer.member("number_of_constraints", m_number_of_constraints);
+        writer.member("is_found_feasible_solution", m_is_feasible);
+        writer.member("objective", m_objective);
+        writer.member("total_violation", m_total_violation);
 
         /// Decision variables
-        object.emplace_back(
-            "variables",  //
-            multi_array::create_json_object(m_variable_value_proxies));
+        writer.key("variables");
+        multi_array::write_json_object(&writer, m_variable_value_proxies);
 
         /// Expressions
-        object.emplace_back(
-            "expressions",  //
-            multi_array::create_json_object(m_expression_value_proxies));
+        writer.key("expressions");
+        multi_array::write_json_object(&writer, m_expression_value_proxies);
 
         /// Constraints
-        object.emplace_back(
-            "constraints",  //
-            multi_array::create_json_object(m_constraint_value_proxies));
+        writer.key("constraints");
+        multi_array::write_json_object(&writer, m_constraint_value_proxies);
 
         /// Violations
-        object.emplace_back(
-            "violations",  //
-            multi_array::create_json_object(m_violation_value_proxies));
+        writer.key("violations");
+        multi_array::write_json_object(&writer, m_violation_value_proxies);
 
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_object();
+        writer.flush();
     }
 
     /*************************************************************************/
     void write_json_by_array(const std::string& a_FILE_NAME) const {
-        utility::json::JsonObject object;
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
 
         // Summary
-        object.emplace_back("version", constant::VERSION);
-        object.emplace_back("name", m_name);
-        object.emplace_back("number_of_variables", m_number_of_variables);
-        object.emplace_back("number_of_constraints", m_number_of_constraints);
-        object.emplace_back("is_found_feasible_solution", m_is_feasible);
-        object.emplace_back("objective", m_objective);
-        object.emplace_back("total_violation", m_total_violation);
+        writer.member("version", constant::VERSION);
+        writer.member("name", m_name);
+        writer.member("number_of_variables", m_number_of_variables);
+        writer.member("number_of_constraints", m_number_of_constraints);
+        writer.member("is_found_feasible_solution", m_is_feasible);
+        writer.member("objective", m_objective);
+        writer.member("total_violation", m_total_violation);
 
         /// Decision variables
-        object.emplace_back(
-            "variables",  //
-            multi_array::create_json_array(m_variable_value_proxies));
+        writer.key("variables");
+        multi_array::write_json_array(&writer, m_variable_value_proxies);
 
         /// Expressions
-        object.emplace_back(
-            "expressions",  //
-            multi_array::create_json_array(m_expression_value_proxies));
+        writer.key("expressions");
+        multi_array::write_json_array(&writer, m_expression_value_proxies);
 
         /// Constraints
-        object.emplace_back(
-            "constraints",  //
-            multi_array::create_json_array(m_constraint_value_proxies));
+        writer.key("constraints");
+        multi_array::write_json_array(&writer, m_constraint_value_proxies);
 
         /// Violations
-        object.emplace_back(
-            "violations",  //
-            multi_array::create_json_array(m_violation_value_proxies));
+        writer.key("violations");
+        multi_array::write_json_array(&writer, m_violation_value_proxies);
 
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_object();
+        writer.flush();
     }
 
     /*************************************************************************/
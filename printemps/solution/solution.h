@@ -13,6 +13,7 @@ class Model;
 }  // namespace printemps::model
 
 #include "sparse_solution.h"
+#include "indexed_sparse_solution.h"
 #include "dense_solution.h"
 #include "named_solution.h"
 #include "solution_score.h"
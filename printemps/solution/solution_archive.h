@@ -11,13 +11,44 @@ namespace printemps::solution {
 enum class SortMode { Off, Ascending, Descending };
 
 /*****************************************************************************/
-template <class T_Variable, class T_Expression>
+template <class T_Variable, class T_Expression,
+          class T_Solution = SparseSolution<T_Variable, T_Expression>>
 class SolutionArchive {
+    /**
+     * This class keeps the solutions sorted by the objective and free from
+     * duplicates. The solutions are held in a multimap keyed by the sort key,
+     * i.e., the objective for the sorted modes and the insertion order for
+     * SortMode::Off, and each hash is mapped to the nodes of the solutions
+     * with the hash, so that a push costs O(log n) and the variables are
+     * compared only if the hashes coincide. The push() methods may be called
+     * from multiple threads concurrently, while the other methods must not be
+     * called during the pushes. The solution type is SparseSolution by
+     * default; the solver keeps IndexedSparseSolution during the search and
+     * converts the archive to names for output.
+     */
    private:
+    struct ArchivedSolution {
+        std::uint64_t hash;
+        T_Solution    solution;
+    };
+    using SolutionMap = std::multimap<double, ArchivedSolution>;
+
     int      m_max_size;
     SortMode m_sort_mode;
-    std::vector<SparseSolution<T_Variable, T_Expression>>  //
-        m_solutions;
+    double   m_sequence;
+
+    SolutionMap m_solution_map;
+    std::unordered_multimap<std::uint64_t, typename SolutionMap::iterator>
+        m_hash_index;
+
+    /**
+     * The solutions are copied into m_solutions on demand by solutions().
+     * While new solutions are only appended to the end of the map, the copied
+     * ones are kept and only the new ones are copied.
+     */
+    mutable std::vector<T_Solution>              m_solutions;
+    mutable typename SolutionMap::const_iterator m_last_copied_it;
+    mutable bool                                 m_is_valid_solutions;
 
     std::string m_name;
     int         m_number_of_variables;
@@ -25,6 +56,85 @@ class SolutionArchive {
 
     bool m_has_feasible_solution;
 
+    /*************************************************************************/
+    inline bool contains(const T_Solution&  a_SOLUTION,
+                         const std::uint64_t a_HASH) const {
+        const auto RANGE = m_hash_index.equal_range(a_HASH);
+        for (auto it = RANGE.first; it != RANGE.second; it++) {
+            if (it->second->second.solution.has_same_variables(a_SOLUTION)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*************************************************************************/
+    inline double sort_key(const T_Solution& a_SOLUTION) {
+        switch (m_sort_mode) {
+            case SortMode::Ascending: {
+                return a_SOLUTION.objective;
+            }
+            case SortMode::Descending: {
+                return -a_SOLUTION.objective;
+            }
+            default: {
+                return m_sequence++;
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline void erase(const typename SolutionMap::iterator a_IT) {
+        const auto RANGE = m_hash_index.equal_range(a_IT->second.hash);
+        for (auto it = RANGE.first; it != RANGE.second; it++) {
+            if (it->second == a_IT) {
+                m_hash_index.erase(it);
+                break;
+            }
+        }
+        m_solution_map.erase(a_IT);
+        m_is_valid_solutions = false;
+    }
+
+    /*************************************************************************/
+    inline void insert(const T_Solution&  a_SOLUTION,
+                       const std::uint64_t a_HASH) {
+        if (this->contains(a_SOLUTION, a_HASH)) {
+            return;
+        }
+
+        const bool IS_SORTED = m_sort_mode == SortMode::Ascending ||
+                               m_sort_mode == SortMode::Descending;
+        const bool IS_FULL =
+            m_max_size > 0 &&
+            static_cast<int>(m_solution_map.size()) >= m_max_size;
+
+        /**
+         * If the archive is full, a sorted archive discards the solution
+         * which would be placed at the end, and an unsorted archive discards
+         * the oldest one. A new solution is placed after the solutions with
+         * the same objective, as the stable sort would do.
+         */
+        const double KEY = this->sort_key(a_SOLUTION);
+        if (IS_SORTED && IS_FULL &&
+            !(KEY < std::prev(m_solution_map.end())->first)) {
+            return;
+        }
+
+        const auto IT =
+            m_solution_map.emplace(KEY, ArchivedSolution{a_HASH, a_SOLUTION});
+        m_hash_index.emplace(a_HASH, IT);
+        if (std::next(IT) != m_solution_map.end()) {
+            m_is_valid_solutions = false;
+        }
+
+        if (IS_FULL) {
+            const auto ERASE_IT = IS_SORTED ? std::prev(m_solution_map.end())
+                                            : m_solution_map.begin();
+            this->erase(ERASE_IT);
+        }
+    }
+
    public:
     /*************************************************************************/
     SolutionArchive(void) {
@@ -37,6 +147,7 @@ class SolutionArchive {
                     const std::string& a_NAME,                 //
                     const int          a_NUMBER_OF_VARIABLES,  //
                     const int          a_NUMBER_OF_CONSTRAINTS) {
+        this->initialize();
         this->setup(a_MAX_SIZE,             //
                     a_SORT_MODE,            //
                     a_NAME,                 //
@@ -44,11 +155,53 @@ class SolutionArchive {
                     a_NUMBER_OF_CONSTRAINTS);
     }
 
+    /*************************************************************************/
+    SolutionArchive(const SolutionArchive& a_ARCHIVE) {
+        *this = a_ARCHIVE;
+    }
+
+    /*************************************************************************/
+    SolutionArchive(SolutionArchive&&) = default;
+
+    /*************************************************************************/
+    SolutionArchive& operator=(SolutionArchive&&) = default;
+
+    /*************************************************************************/
+    SolutionArchive& operator=(const SolutionArchive& a_ARCHIVE) {
+        /**
+         * The hash index refers to the nodes of the map, so that it is
+         * rebuilt for the copied map.
+         */
+        if (this == &a_ARCHIVE) {
+            return *this;
+        }
+        m_max_size     = a_ARCHIVE.m_max_size;
+        m_sort_mode    = a_ARCHIVE.m_sort_mode;
+        m_sequence     = a_ARCHIVE.m_sequence;
+        m_solution_map = a_ARCHIVE.m_solution_map;
+        m_hash_index.clear();
+        for (auto it = m_solution_map.begin(); it != m_solution_map.end();
+             it++) {
+            m_hash_index.emplace(it->second.hash, it);
+        }
+        m_solutions.clear();
+        m_is_valid_solutions    = true;
+        m_name                  = a_ARCHIVE.m_name;
+        m_number_of_variables   = a_ARCHIVE.m_number_of_variables;
+        m_number_of_constraints = a_ARCHIVE.m_number_of_constraints;
+        m_has_feasible_solution = a_ARCHIVE.m_has_feasible_solution;
+        return *this;
+    }
+
     /*************************************************************************/
     void initialize(void) {
         m_max_size  = 0;
         m_sort_mode = SortMode::Off;
+        m_sequence  = 0.0;
+        m_solution_map.clear();
+        m_hash_index.clear();
         m_solutions.clear();
+        m_is_valid_solutions    = true;
         m_name                  = "";
         m_number_of_variables   = 0;
         m_number_of_constraints = 0;
@@ -63,80 +216,82 @@ class SolutionArchive {
                const int          a_NUMBER_OF_CONSTRAINTS) {
         m_max_size  = a_MAX_SIZE;
         m_sort_mode = a_SORT_MODE;
+        m_sequence  = 0.0;
+        m_solution_map.clear();
+        m_hash_index.clear();
         m_solutions.clear();
+        m_is_valid_solutions    = true;
         m_name                  = a_NAME;
         m_number_of_variables   = a_NUMBER_OF_VARIABLES;
         m_number_of_constraints = a_NUMBER_OF_CONSTRAINTS;
     }
 
     /*************************************************************************/
-    inline void push(
-        const SparseSolution<T_Variable, T_Expression>& a_SOLUTION) {
-        std::vector<SparseSolution<T_Variable, T_Expression>> solutions = {
-            a_SOLUTION};
-        this->push(solutions);
+    inline void push(const T_Solution& a_SOLUTION) {
+        /**
+         * The hash is computed outside the critical section.
+         */
+        const std::uint64_t HASH = a_SOLUTION.compute_hash();
+
+#ifdef _OPENMP
+#pragma omp critical(printemps_solution_archive)
+#endif
+        { this->insert(a_SOLUTION, HASH); }
     }
 
     /*************************************************************************/
-    inline void push(
-        const std::vector<SparseSolution<T_Variable, T_Expression>>&
-            a_SOLUTIONS) {
-        auto& solutions = m_solutions;
-        solutions.insert(solutions.end(), a_SOLUTIONS.begin(),
-                         a_SOLUTIONS.end());
+    inline void push(const std::vector<T_Solution>& a_SOLUTIONS) {
+        /**
+         * The hashes are computed outside the critical section.
+         */
+        const int                  SOLUTIONS_SIZE = a_SOLUTIONS.size();
+        std::vector<std::uint64_t> hashes(SOLUTIONS_SIZE);
+        for (auto i = 0; i < SOLUTIONS_SIZE; i++) {
+            hashes[i] = a_SOLUTIONS[i].compute_hash();
+        }
 
-        switch (m_sort_mode) {
-            case SortMode::Ascending: {
-                std::stable_sort(solutions.begin(), solutions.end(),
-                                 [](const auto& a_LHS, const auto& a_RHS) {
-                                     return a_LHS.objective < a_RHS.objective;
-                                 });
-                break;
-            }
-            case SortMode::Descending: {
-                std::stable_sort(solutions.begin(), solutions.end(),
-                                 [](const auto& a_LHS, const auto& a_RHS) {
-                                     return a_LHS.objective > a_RHS.objective;
-                                 });
-                break;
-            }
-            default: {
-                /** nothing to do */
+#ifdef _OPENMP
+#pragma omp critical(printemps_solution_archive)
+#endif
+        {
+            for (auto i = 0; i < SOLUTIONS_SIZE; i++) {
+                this->insert(a_SOLUTIONS[i], hashes[i]);
             }
         }
+    }
 
-        solutions.erase(std::unique(solutions.begin(), solutions.end(),
-                                    [](const auto& a_LHS, const auto& a_RHS) {
-                                        return a_LHS.variables ==
-                                               a_RHS.variables;
-                                    }),
-                        solutions.end());
-
-        const int SOLUTIONS_SIZE = static_cast<int>(solutions.size());
-        if (m_max_size > 0 && SOLUTIONS_SIZE > m_max_size) {
-            if (m_sort_mode == SortMode::Ascending ||
-                m_sort_mode == SortMode::Descending) {
-                solutions.resize(m_max_size);
-            } else {
-                solutions.erase(
-                    solutions.begin(),
-                    solutions.begin() + SOLUTIONS_SIZE - m_max_size);
+    /*************************************************************************/
+    inline void push(const SolutionArchive& a_ARCHIVE) {
+        /**
+         * The solutions of a_ARCHIVE are pushed in its order with the stored
+         * hashes, without copying them into a vector.
+         */
+#ifdef _OPENMP
+#pragma omp critical(printemps_solution_archive)
+#endif
+        {
+            for (const auto& element : a_ARCHIVE.m_solution_map) {
+                this->insert(element.second.solution, element.second.hash);
             }
         }
     }
 
     /*************************************************************************/
     inline void remove_infeasible_solutions(void) {
-        m_solutions.erase(std::remove_if(m_solutions.begin(), m_solutions.end(),
-                                         [](const auto& a_SOLUTION) {
-                                             return !a_SOLUTION.is_feasible;
-                                         }),
-                          m_solutions.end());
+        for (auto it = m_hash_index.begin(); it != m_hash_index.end();) {
+            if (!it->second->second.solution.is_feasible) {
+                m_solution_map.erase(it->second);
+                it = m_hash_index.erase(it);
+            } else {
+                it++;
+            }
+        }
+        m_is_valid_solutions = false;
     }
 
     /*************************************************************************/
     inline int size(void) const {
-        return m_solutions.size();
+        return m_solution_map.size();
     }
 
     /*************************************************************************/
@@ -165,15 +320,27 @@ class SolutionArchive {
     }
 
     /*************************************************************************/
-    inline const std::vector<SparseSolution<T_Variable, T_Expression>>&
-    solutions(void) const {
+    inline const std::vector<T_Solution>& solutions(void) const {
+        auto it = m_solution_map.begin();
+        if (!m_is_valid_solutions) {
+            m_solutions.clear();
+            m_is_valid_solutions = true;
+        } else if (!m_solutions.empty()) {
+            it = std::next(m_last_copied_it);
+        }
+
+        m_solutions.reserve(m_solution_map.size());
+        for (; it != m_solution_map.end(); it++) {
+            m_solutions.push_back(it->second.solution);
+            m_last_copied_it = it;
+        }
         return m_solutions;
     }
 
     /*************************************************************************/
     inline bool update_has_feasible_solution(void) {
-        for (const auto& solution : m_solutions) {
-            if (solution.is_feasible) {
+        for (const auto& element : m_solution_map) {
+            if (element.second.solution.is_feasible) {
                 m_has_feasible_solution = true;
                 return true;
             }
@@ -183,8 +350,7 @@ class SolutionArchive {
 
     /*************************************************************************/
     inline bool update_has_feasible_solution(
-        const std::vector<SparseSolution<T_Variable, T_Expression>>&
-            a_SOLUTIONS) {
+        const std::vector<T_Solution>& a_SOLUTIONS) {
         for (const auto& solution : a_SOLUTIONS) {
             if (solution.is_feasible) {
                 m_has_feasible_solution = true;
@@ -201,36 +367,47 @@ class SolutionArchive {
 
     /*************************************************************************/
     void write_solutions_json(const std::string& a_FILE_NAME) const {
-        utility::json::JsonObject object;
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
 
         // Summary
-        object.emplace_back("version", constant::VERSION);
-        object.emplace_back("name", m_name);
-        object.emplace_back("number_of_variables", m_number_of_variables);
-        object.emplace_back("number_of_constraints", m_number_of_constraints);
+        writer.member("version", constant::VERSION);
+        writer.member("name", m_name);
+        writer.member("number_of_variables", m_number_of_variables);
+        writer.member("number_of_constraints", m_number_of_constraints);
 
         /// Solutions
-        utility::json::JsonArray solution_array;
-
-        for (const auto& solution : m_solutions) {
-            utility::json::JsonObject solution_object;
-            solution_object.emplace_back("is_feasible", solution.is_feasible);
-            solution_object.emplace_back("objective", solution.objective);
-            solution_object.emplace_back("total_violation",
-                                         solution.total_violation);
-
-            utility::json::JsonObject variable_object;
+        writer.key("solutions");
+        writer.begin_array();
+        for (const auto& element : m_solution_map) {
+            const auto& solution = element.second.solution;
+            writer.begin_object();
+            writer.member("is_feasible", solution.is_feasible);
+            writer.member("objective", solution.objective);
+            writer.member("total_violation", solution.total_violation);
 
+            writer.key("variables");
+            writer.begin_object();
             for (const auto& variable : solution.variables) {
-                variable_object.emplace_back(variable.first, variable.second);
+                writer.member(variable.first, variable.second);
             }
-            solution_object.emplace_back("variables", variable_object);
-            solution_array.emplace_back(solution_object);
+            writer.end_object();
+            writer.end_object();
         }
-        object.emplace_back("solutions", solution_array);
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_array();
+
+        writer.end_object();
+        writer.flush();
     }
 };
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+using IndexedSolutionArchive =
+    SolutionArchive<T_Variable, T_Expression,
+                    IndexedSparseSolution<T_Variable, T_Expression>>;
 }  // namespace printemps::solution
 
 #endif
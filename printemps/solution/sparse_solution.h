@@ -33,6 +33,35 @@ struct SparseSolution {
         this->variables.clear();
     }
 
+    /*************************************************************************/
+    inline bool has_same_variables(
+        const SparseSolution<T_Variable, T_Expression> &a_SOLUTION) const {
+        return this->variables == a_SOLUTION.variables;
+    }
+
+    /*************************************************************************/
+    inline std::uint64_t compute_hash(void) const {
+        /**
+         * The hash is computed in the manner of Zobrist hashing: the
+         * exclusive-or of the mixed hashes of the (name, value) pairs, so that
+         * it does not depend on the iteration order of the variables.
+         */
+        std::uint64_t hash = 0;
+        for (const auto &variable : this->variables) {
+            std::uint64_t key =
+                std::hash<std::string>()(variable.first) ^
+                (std::hash<T_Variable>()(variable.second) *
+                 0x9E3779B97F4A7C15ULL);
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            key *= 0xC4CEB9FE1A85EC53ULL;
+            key ^= key >> 33;
+            hash ^= key;
+        }
+        return hash;
+    }
+
     /*************************************************************************/
     inline int distance(
         const SparseSolution<T_Variable, T_Expression> &a_SOLUTION) const {
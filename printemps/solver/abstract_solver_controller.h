@@ -128,7 +128,8 @@ class AbstractSolverController {
 
     /*************************************************************************/
     inline void update_feasible_solution_archive(
-        const std::vector<solution::SparseSolution<T_Variable, T_Expression>>&
+        const std::vector<
+            solution::IndexedSparseSolution<T_Variable, T_Expression>>&
             a_SOLUTIONS) {
         if (a_SOLUTIONS.size() == 0) {
             return;
@@ -138,7 +139,8 @@ class AbstractSolverController {
 
     /*************************************************************************/
     inline void update_incumbent_solution_archive_and_search_tree(
-        const std::vector<solution::SparseSolution<T_Variable, T_Expression>>&
+        const std::vector<
+            solution::IndexedSparseSolution<T_Variable, T_Expression>>&
             a_SOLUTIONS) {
         if (a_SOLUTIONS.size() == 0) {
             return;
@@ -160,7 +162,8 @@ class AbstractSolverController {
 
         search_tree.update(
             incumbent_solution_archive,
-            incumbent_holder.global_augmented_incumbent_solution().to_sparse());
+            m_model_ptr->export_indexed_sparse_solution(
+                incumbent_holder.global_augmented_incumbent_solution()));
     }
 
     /*************************************************************************/
@@ -23,9 +23,9 @@ struct GlobalState {
     solution::IncumbentHolder<T_Variable, T_Expression> incumbent_holder;
     Memory<T_Variable, T_Expression>                    memory;
 
-    solution::SolutionArchive<T_Variable, T_Expression>
+    solution::IndexedSolutionArchive<T_Variable, T_Expression>
         feasible_solution_archive;
-    solution::SolutionArchive<T_Variable, T_Expression>
+    solution::IndexedSolutionArchive<T_Variable, T_Expression>
         incumbent_solution_archive;
 
     SearchTree<T_Variable, T_Expression> search_tree;
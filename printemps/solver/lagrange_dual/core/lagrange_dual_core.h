@@ -9,6 +9,7 @@
 #include "lagrange_dual_core_termination_status.h"
 #include "lagrange_dual_core_state.h"
 #include "lagrange_dual_core_state_manager.h"
+#include "lagrange_dual_core_lagrangian_engine.h"
 #include "lagrange_dual_core_result.h"
 
 namespace printemps::solver::lagrange_dual::core {
@@ -22,14 +23,15 @@ class LagrangeDualCore {
     std::optional<std::function<bool()>>              m_check_interrupt;
     option::Option                                    m_option;
 
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_feasible_solutions;
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_incumbent_solutions;
 
-    LagrangeDualCoreStateManager<T_Variable, T_Expression> m_state_manager;
-    LagrangeDualCoreResult<T_Variable, T_Expression>       m_result;
-    std::mt19937                                           m_get_rand_mt;
+    LagrangeDualCoreStateManager<T_Variable, T_Expression>     m_state_manager;
+    LagrangeDualCoreLagrangianEngine<T_Variable, T_Expression> m_engine;
+    LagrangeDualCoreResult<T_Variable, T_Expression>           m_result;
+    std::mt19937                                               m_get_rand_mt;
 
     /*************************************************************************/
     inline void preprocess(void) {
@@ -60,6 +62,7 @@ class LagrangeDualCore {
         m_model_ptr->update();
 
         m_state_manager.setup(m_model_ptr, m_global_state_ptr, m_option);
+        m_engine.setup(m_model_ptr, m_option);
     }
 
     /*************************************************************************/
@@ -351,6 +354,7 @@ class LagrangeDualCore {
         m_incumbent_solutions.clear();
 
         m_state_manager.initialize();
+        m_engine.initialize();
         m_result.initialize();
         m_get_rand_mt.seed(0);
     }
@@ -402,9 +406,6 @@ class LagrangeDualCore {
         print_table_header(m_option.output.verbose >= option::verbose::Inner);
         print_table_initial(m_option.output.verbose >= option::verbose::Inner);
 
-        auto& variable_ptrs = m_model_ptr->variable_reference().variable_ptrs;
-        const int VARIABLES_SIZE = variable_ptrs.size();
-
         /**
          * Iterations start.
          */
@@ -449,42 +450,10 @@ class LagrangeDualCore {
 
             /**
              * Update the primal optimal solution so that it minimizes
-             * lagrangian for the updated dual solution.
-             */
-            const double SIGN = m_model_ptr->sign();
-#ifdef _OPENMP
-#pragma omp parallel for if (m_option.parallel                                \
-                                 .is_enabled_move_evaluation_parallelization) \
-    schedule(static)
-#endif
-            for (auto i = 0; i < VARIABLES_SIZE; i++) {
-                if (variable_ptrs[i]->is_fixed()) {
-                    continue;
-                }
-                double coefficient = variable_ptrs[i]->objective_sensitivity();
-
-                for (auto&& item :
-                     variable_ptrs[i]->constraint_sensitivities()) {
-                    const auto&  constraint_ptr = item.first;
-                    const double SENSITIVITY    = item.second;
-
-                    const int PROXY_INDEX = constraint_ptr->proxy_index();
-                    const int FLAT_INDEX  = constraint_ptr->flat_index();
-
-                    coefficient += STATE.dual[PROXY_INDEX].flat_indexed_values(
-                                       FLAT_INDEX) *
-                                   SENSITIVITY * SIGN;
-                }
-
-                variable_ptrs[i]->set_lagrangian_coefficient(coefficient);
-                variable_ptrs[i]->set_lower_or_upper_bound(
-                    (coefficient > 0) == (m_model_ptr->is_minimization()));
-            }
-
-            /**
-             * Update the model.
+             * lagrangian for the updated dual solution. Only the variables
+             * whose bound choices flipped are applied to the model.
              */
-            m_model_ptr->update();
+            m_engine.update(STATE.dual);
 
             /**
              * Update the state.
@@ -500,7 +469,7 @@ class LagrangeDualCore {
                 m_model_ptr
                     ->update_dependent_variables_and_disabled_constraints();
                 m_feasible_solutions.push_back(
-                    m_model_ptr->export_sparse_solution());
+                    m_model_ptr->export_indexed_sparse_solution());
             }
 
             /**
@@ -536,9 +505,9 @@ class LagrangeDualCore {
             solution::IncumbentHolderConstant::
                 STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE) {
             m_incumbent_solutions.push_back(
-                m_global_state_ptr->incumbent_holder
-                    .global_augmented_incumbent_solution()
-                    .to_sparse());
+                m_model_ptr->export_indexed_sparse_solution(
+                    m_global_state_ptr->incumbent_holder
+                        .global_augmented_incumbent_solution()));
         }
 
         /**
@@ -550,14 +519,14 @@ class LagrangeDualCore {
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     feasible_solutions(void) const {
         return m_feasible_solutions;
     }
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     incumbent_solutions(void) const {
         return m_incumbent_solutions;
     }
@@ -0,0 +1,238 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_LAGRANGE_DUAL_CORE_LAGRANGE_DUAL_CORE_LAGRANGIAN_ENGINE_H__
+#define PRINTEMPS_SOLVER_LAGRANGE_DUAL_CORE_LAGRANGE_DUAL_CORE_LAGRANGIAN_ENGINE_H__
+
+namespace printemps::solver::lagrange_dual::core {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class LagrangeDualCoreLagrangianEngine {
+    /**
+     * This class minimizes the Lagrangian for given Lagrange multipliers. The
+     * Lagrangian coefficients of variables are computed as a product of the
+     * transposed constraint matrix and the multipliers by scanning the CSC
+     * columns of the incidence matrix of the model in parallel. Then only the
+     * variables whose bound choices flipped are applied to the model, and
+     * the constraint values are updated incrementally through the columns of
+     * the flipped variables.
+     *
+     * Only the enabled constraints are relaxed. The disabled constraints are
+     * implied by the enabled ones or define dependent variables, which have
+     * been substituted out of the enabled constraints and the objective.
+     */
+   private:
+    model::Model<T_Variable, T_Expression> *m_model_ptr;
+    bool                                    m_is_enabled_parallelization;
+
+    std::vector<model_component::Variable<T_Variable, T_Expression> *>
+        m_variable_ptrs;
+
+    std::vector<std::uint8_t> m_is_enabled_constraints;
+    std::vector<double>       m_dual_values;
+    std::vector<T_Variable>   m_target_values;
+    std::vector<T_Expression> m_constraint_values;
+    std::vector<int>          m_constraint_epochs;
+    int                       m_epoch;
+
+    std::vector<model_component::Constraint<T_Variable, T_Expression> *>
+        m_related_constraint_ptrs;
+
+    neighborhood::Move<T_Variable, T_Expression> m_move;
+
+    /*************************************************************************/
+    inline void import_dual(
+        const std::vector<multi_array::ValueProxy<double>> &a_DUAL) {
+        const auto &constraint_ptrs =
+            m_model_ptr->constraint_reference().enabled_constraint_ptrs;
+        const int CONSTRAINTS_SIZE = constraint_ptrs.size();
+
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto CONSTRAINT_PTR = constraint_ptrs[i];
+            m_dual_values[CONSTRAINT_PTR->id()] =
+                a_DUAL[CONSTRAINT_PTR->proxy_index()].flat_indexed_values(
+                    CONSTRAINT_PTR->flat_index());
+        }
+    }
+
+    /*************************************************************************/
+    inline void compute_target_values(void) {
+        const auto & INCIDENCE       = m_model_ptr->incidence_matrix();
+        const int *  COLUMN_PTRS     = INCIDENCE.column_ptrs.data();
+        const int *  CONSTRAINT_IDS  = INCIDENCE.column_constraint_ids.data();
+        const auto * COEFFICIENTS    = INCIDENCE.column_coefficients.data();
+        const auto * DUAL_VALUES     = m_dual_values.data();
+        const double SIGN            = m_model_ptr->sign();
+        const bool   IS_MINIMIZATION = m_model_ptr->is_minimization();
+        const int    VARIABLES_SIZE  = m_variable_ptrs.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for if (m_is_enabled_parallelization) schedule(static)
+#endif
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto VARIABLE_PTR = m_variable_ptrs[i];
+            const int  VARIABLE_ID  = VARIABLE_PTR->id();
+
+            double product = 0.0;
+            for (auto j = COLUMN_PTRS[VARIABLE_ID];
+                 j < COLUMN_PTRS[VARIABLE_ID + 1]; j++) {
+                product += DUAL_VALUES[CONSTRAINT_IDS[j]] * COEFFICIENTS[j];
+            }
+
+            const double COEFFICIENT =
+                VARIABLE_PTR->objective_sensitivity() + product * SIGN;
+
+            VARIABLE_PTR->set_lagrangian_coefficient(COEFFICIENT);
+            m_target_values[i] = ((COEFFICIENT > 0) == IS_MINIMIZATION)
+                                     ? VARIABLE_PTR->lower_bound()
+                                     : VARIABLE_PTR->upper_bound();
+        }
+    }
+
+    /*************************************************************************/
+    inline void collect_flipped_variables(void) {
+        const int VARIABLES_SIZE = m_variable_ptrs.size();
+
+        m_move.alterations.clear();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            if (m_target_values[i] != m_variable_ptrs[i]->value()) {
+                m_move.alterations.emplace_back(m_variable_ptrs[i],
+                                                m_target_values[i]);
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline void compute_constraint_values(void) {
+        /**
+         * The constraints touched by the flipped variables are deduplicated
+         * by stamping them with the epoch, so that the buffers need not be
+         * cleared for each iteration.
+         */
+        const auto &INCIDENCE = m_model_ptr->incidence_matrix();
+        const auto &constraint_ptrs =
+            m_model_ptr->constraint_reference().constraint_ptrs;
+
+        m_epoch++;
+        m_related_constraint_ptrs.clear();
+
+        for (const auto &alteration : m_move.alterations) {
+            const int  VARIABLE_ID = alteration.first->id();
+            const auto VALUE_DIFF =
+                alteration.second - alteration.first->value();
+
+            for (auto j = INCIDENCE.column_ptrs[VARIABLE_ID];
+                 j < INCIDENCE.column_ptrs[VARIABLE_ID + 1]; j++) {
+                const int CONSTRAINT_ID = INCIDENCE.column_constraint_ids[j];
+                if (!m_is_enabled_constraints[CONSTRAINT_ID]) {
+                    continue;
+                }
+                if (m_constraint_epochs[CONSTRAINT_ID] != m_epoch) {
+                    m_constraint_epochs[CONSTRAINT_ID] = m_epoch;
+                    m_constraint_values[CONSTRAINT_ID] =
+                        constraint_ptrs[CONSTRAINT_ID]->constraint_value();
+                    m_related_constraint_ptrs.push_back(
+                        constraint_ptrs[CONSTRAINT_ID]);
+                }
+                m_constraint_values[CONSTRAINT_ID] +=
+                    INCIDENCE.column_coefficients[j] * VALUE_DIFF;
+            }
+        }
+        m_move.related_constraint_ptrs = m_related_constraint_ptrs;
+    }
+
+   public:
+    /*************************************************************************/
+    LagrangeDualCoreLagrangianEngine(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    LagrangeDualCoreLagrangianEngine(
+        model::Model<T_Variable, T_Expression> *a_model_ptr,
+        const option::Option &                 a_OPTION) {
+        this->setup(a_model_ptr, a_OPTION);
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_model_ptr                  = nullptr;
+        m_is_enabled_parallelization = false;
+
+        m_variable_ptrs.clear();
+        m_is_enabled_constraints.clear();
+        m_dual_values.clear();
+        m_target_values.clear();
+        m_constraint_values.clear();
+        m_constraint_epochs.clear();
+        m_epoch = 0;
+
+        m_related_constraint_ptrs.clear();
+        m_move.initialize();
+    }
+
+    /*************************************************************************/
+    inline void setup(model::Model<T_Variable, T_Expression> *a_model_ptr,
+                      const option::Option &                 a_OPTION) {
+        this->initialize();
+        m_model_ptr = a_model_ptr;
+        m_is_enabled_parallelization =
+            a_OPTION.parallel.is_enabled_move_evaluation_parallelization;
+
+        /**
+         * Dependent variables are excluded because their values are
+         * determined by the other variables.
+         */
+        for (auto &&variable_ptr :
+             m_model_ptr->variable_reference().mutable_variable_ptrs) {
+            if (variable_ptr->sense() ==
+                    model_component::VariableSense::DependentBinary ||
+                variable_ptr->sense() ==
+                    model_component::VariableSense::DependentInteger) {
+                continue;
+            }
+            m_variable_ptrs.push_back(variable_ptr);
+        }
+
+        const auto &constraint_ptrs =
+            m_model_ptr->constraint_reference().constraint_ptrs;
+        const int CONSTRAINTS_SIZE = constraint_ptrs.size();
+
+        m_is_enabled_constraints.resize(CONSTRAINTS_SIZE, 0);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            m_is_enabled_constraints[i] = constraint_ptrs[i]->is_enabled();
+        }
+
+        m_dual_values.resize(CONSTRAINTS_SIZE, 0.0);
+        m_target_values.resize(m_variable_ptrs.size(), 0);
+        m_constraint_values.resize(CONSTRAINTS_SIZE, 0);
+        m_constraint_epochs.resize(CONSTRAINTS_SIZE, 0);
+    }
+
+    /*************************************************************************/
+    inline void update(
+        const std::vector<multi_array::ValueProxy<double>> &a_DUAL) {
+        /**
+         * Update the primal solution so that it minimizes the Lagrangian for
+         * the given dual solution, and update the model accordingly.
+         */
+        this->import_dual(a_DUAL);
+        this->compute_target_values();
+        this->collect_flipped_variables();
+        this->compute_constraint_values();
+
+        m_model_ptr->update(m_move, m_constraint_values);
+    }
+
+    /*************************************************************************/
+    inline int number_of_flipped_variables(void) const noexcept {
+        return m_move.alterations.size();
+    }
+};
+}  // namespace printemps::solver::lagrange_dual::core
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
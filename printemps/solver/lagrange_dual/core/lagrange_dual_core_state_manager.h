@@ -186,8 +186,13 @@ class LagrangeDualCoreStateManager {
 
     /*************************************************************************/
     inline void update_dual(void) {
+        /**
+         * NOTE: Only the enabled constraints are relaxed, and the lagrange
+         * multipliers of the disabled constraints remain zero. The values of
+         * disabled constraints are not maintained during the iterations.
+         */
         auto& constraint_ptrs =
-            m_model_ptr->constraint_reference().constraint_ptrs;
+            m_model_ptr->constraint_reference().enabled_constraint_ptrs;
         const int CONSTRAINTS_SIZE = constraint_ptrs.size();
 
 #ifdef _OPENMP
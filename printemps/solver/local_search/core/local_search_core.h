@@ -23,9 +23,9 @@ class LocalSearchCore {
     std::optional<std::function<bool()>>              m_check_interrupt;
     option::Option                                    m_option;
 
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_feasible_solutions;
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_incumbent_solutions;
 
     LocalSearchCoreStateManager<T_Variable, T_Expression> m_state_manager;
@@ -151,15 +151,12 @@ class LocalSearchCore {
              * improvable solution, the solution should be an optimum. It can
              * happen for decomp2 instance in MIPLIB 2017.
              */
-            m_state_manager.set_termination_status(
-                LocalSearchCoreTerminationStatus::OPTIMAL);
-            for (const auto& variable_ptr :
-                 m_model_ptr->variable_reference().variable_ptrs) {
-                if (variable_ptr->is_objective_improvable()) {
-                    m_state_manager.set_termination_status(
-                        LocalSearchCoreTerminationStatus::NO_MOVE);
-                    break;
-                }
+            if (m_model_ptr->has_objective_improvable_variable()) {
+                m_state_manager.set_termination_status(
+                    LocalSearchCoreTerminationStatus::NO_MOVE);
+            } else {
+                m_state_manager.set_termination_status(
+                    LocalSearchCoreTerminationStatus::OPTIMAL);
             }
             return true;
         } else {
@@ -487,7 +484,9 @@ class LocalSearchCore {
         std::vector<int>                     move_indices;
         std::unordered_set<
             model_component::Constraint<T_Variable, T_Expression>*>
-                                                     constraint_ptrs;
+            constraint_ptrs;
+        std::vector<model_component::Constraint<T_Variable, T_Expression>*>
+                                                     related_constraint_ptrs;
         neighborhood::Move<T_Variable, T_Expression> move;
         int number_of_performed_moves = 0;
 
@@ -615,6 +614,7 @@ class LocalSearchCore {
 
             move.alterations.reserve(m_model_ptr->number_of_variables());
             constraint_ptrs.clear();
+            related_constraint_ptrs.clear();
             number_of_performed_moves = 0;
             move.initialize();
             for (auto i = 0; i < NUMBER_OF_MOVES; i++) {
@@ -654,8 +654,8 @@ class LocalSearchCore {
                                         move_ptr->alterations.begin(),
                                         move_ptr->alterations.end());
 
-                move.related_constraint_ptrs.insert(
-                    move.related_constraint_ptrs.end(),
+                related_constraint_ptrs.insert(
+                    related_constraint_ptrs.end(),
                     move_ptr->related_constraint_ptrs.begin(),
                     move_ptr->related_constraint_ptrs.end());
 
@@ -673,6 +673,12 @@ class LocalSearchCore {
                 number_of_performed_moves++;
             }
 
+            /**
+             * The merged move refers to the related constraints collected
+             * above, which are kept until the next iteration.
+             */
+            move.related_constraint_ptrs = related_constraint_ptrs;
+
             bool is_found_improving_solution = move.alterations.size() > 0;
 
             /**
@@ -724,7 +730,7 @@ class LocalSearchCore {
                 m_model_ptr
                     ->update_dependent_variables_and_disabled_constraints();
                 m_feasible_solutions.push_back(
-                    m_model_ptr->export_sparse_solution());
+                    m_model_ptr->export_indexed_sparse_solution());
             }
 
             /**
@@ -753,9 +759,9 @@ class LocalSearchCore {
             solution::IncumbentHolderConstant::
                 STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE) {
             m_incumbent_solutions.push_back(
-                m_global_state_ptr->incumbent_holder
-                    .global_augmented_incumbent_solution()
-                    .to_sparse());
+                m_model_ptr->export_indexed_sparse_solution(
+                    m_global_state_ptr->incumbent_holder
+                        .global_augmented_incumbent_solution()));
         }
 
         /**
@@ -767,14 +773,14 @@ class LocalSearchCore {
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     feasible_solutions(void) const {
         return m_feasible_solutions;
     }
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     incumbent_solutions(void) const {
         return m_incumbent_solutions;
     }
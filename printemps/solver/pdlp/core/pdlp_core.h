@@ -28,6 +28,11 @@ class PDLPCore {
 
     /*************************************************************************/
     inline void postprocess(void) {
+        /**
+         * Release the single precision matrix values.
+         */
+        m_state_manager.disable_single_precision();
+
         /**
          * Prepare the result.
          */
@@ -393,6 +398,7 @@ class PDLPCore {
             if (state.total_iteration % CONVERGENCE_CHECK_INTERVAL == 0 ||
                 state.total_iteration % LOG_INTERVAL == 0) {
                 m_state_manager.update_convergence_information();
+                m_state_manager.update_precision();
             }
 
             if (state.total_iteration % LOG_INTERVAL == 0) {
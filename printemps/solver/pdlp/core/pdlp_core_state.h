@@ -40,6 +40,8 @@ struct PDLPCoreState {
     bool        is_enabled_restart;
     RestartMode restart_mode;
 
+    bool is_enabled_single_precision;
+
     PDLPCoreTerminationStatus termination_status;
 
     /*************************************************************************/
@@ -76,6 +78,8 @@ struct PDLPCoreState {
         this->is_enabled_restart = false;
         this->restart_mode       = RestartMode::Current;
 
+        this->is_enabled_single_precision = false;
+
         this->termination_status = PDLPCoreTerminationStatus::ITERATION_OVER;
     }
 };
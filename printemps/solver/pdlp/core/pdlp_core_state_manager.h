@@ -92,6 +92,47 @@ class PDLPCoreStateManager {
 
         this->setup_initial_step_size();
         this->setup_initial_primal_weight();
+
+        if (m_option.pdlp.is_enabled_mixed_precision) {
+            this->enable_single_precision();
+        }
+    }
+
+    /*************************************************************************/
+    inline void enable_single_precision(void) {
+        m_instance_ptr->primal_constraint_coefficients
+            .enable_single_precision();
+        m_instance_ptr->dual_constraint_coefficients.enable_single_precision();
+        m_state.is_enabled_single_precision = true;
+    }
+
+    /*************************************************************************/
+    inline void disable_single_precision(void) {
+        m_instance_ptr->primal_constraint_coefficients
+            .disable_single_precision();
+        m_instance_ptr->dual_constraint_coefficients
+            .disable_single_precision();
+        m_state.is_enabled_single_precision = false;
+    }
+
+    /*************************************************************************/
+    inline void update_precision(void) {
+        /**
+         * The iterations are switched to double precision once all of the
+         * relative errors fall below the switching tolerance, since the
+         * single precision matrix values limit the attainable accuracy.
+         */
+        if (!m_state.is_enabled_single_precision) {
+            return;
+        }
+
+        const double SWITCH_TOLERANCE =
+            m_option.pdlp.mixed_precision_switch_tolerance;
+        if (m_state.primal.relative_violation_norm < SWITCH_TOLERANCE &&
+            m_state.dual.relative_violation_norm < SWITCH_TOLERANCE &&
+            m_state.relative_gap < SWITCH_TOLERANCE) {
+            this->disable_single_precision();
+        }
     }
 
     /*************************************************************************/
@@ -274,59 +315,51 @@ class PDLPCoreStateManager {
             const double PRIMAL_STEP_SIZE =
                 step_size_trial / m_state.primal_weight;
 
-            utility::sparse::linear_combination(                            //
+            utility::sparse::linear_combination_clamp(                      //
                 &m_state.primal.solution_trial,                             //
                 1.0, m_state.primal.solution,                               //
                 -PRIMAL_STEP_SIZE, INSTANCE.primal_objective_coefficients,  //
-                PRIMAL_STEP_SIZE, m_state.primal.lhs                        //
+                PRIMAL_STEP_SIZE, m_state.primal.lhs,                       //
+                INSTANCE.primal_lower_bounds, INSTANCE.primal_upper_bounds  //
             );
 
-            m_state.primal.solution_trial.clamp(INSTANCE.primal_lower_bounds,
-                                                INSTANCE.primal_upper_bounds);
+            /**
+             * The move and the extrapolated point 2 * x_trial - x are
+             * computed in a single pass.
+             */
+            const double PRIMAL_MOVE_SQUARE_SUM = utility::sparse::extrapolate(
+                &m_state.primal.buffer, &m_state.primal.move,
+                m_state.primal.solution_trial, m_state.primal.solution);
 
             /// Dual
             const double DUAL_STEP_SIZE =
                 step_size_trial * m_state.primal_weight;
 
-            utility::sparse::linear_combination(     //
-                &m_state.primal.buffer,              //
-                2.0, m_state.primal.solution_trial,  //
-                -1.0, m_state.primal.solution        //
-            );
-
-            INSTANCE.primal_constraint_coefficients.dot(&m_state.dual.lhs,
-                                                        m_state.primal.buffer);
-
-            utility::sparse::linear_combination(                       //
-                &m_state.dual.solution_trial,                          //
+            utility::sparse::linear_combination_clamp(                 //
+                &m_state.dual.solution_trial, &m_state.dual.lhs,       //
+                -DUAL_STEP_SIZE, INSTANCE.primal_constraint_coefficients,
+                m_state.primal.buffer,                                 //
                 1.0, m_state.dual.solution,                            //
                 DUAL_STEP_SIZE, INSTANCE.dual_objective_coefficients,  //
-                -DUAL_STEP_SIZE, m_state.dual.lhs                      //
+                INSTANCE.dual_lower_bounds, INSTANCE.dual_upper_bounds  //
             );
 
-            m_state.dual.solution_trial.clamp(INSTANCE.dual_lower_bounds,
-                                              INSTANCE.dual_upper_bounds);
+            const double DUAL_MOVE_SQUARE_SUM =
+                utility::sparse::subtract_with_square_sum(  //
+                    &m_state.dual.move, m_state.dual.solution_trial,
+                    m_state.dual.solution);
 
-            utility::sparse::subtract(  //
-                &m_state.primal.move, m_state.primal.solution_trial,
-                m_state.primal.solution);
+            const double MOVE_SQUARE_SUM =
+                m_state.primal_weight * PRIMAL_MOVE_SQUARE_SUM +
+                DUAL_MOVE_SQUARE_SUM / m_state.primal_weight;
 
-            utility::sparse::subtract(  //
-                &m_state.dual.move, m_state.dual.solution_trial,
-                m_state.dual.solution);
-
-            const double MOVE = this->compute_weighted_norm(  //
-                m_state.primal.move, m_state.dual.move);
-
-            INSTANCE.primal_constraint_coefficients.dot(  //
-                &m_state.dual.buffer, m_state.primal.move);
-
-            const double INTERACTION =
-                std::fabs(m_state.dual.move.dot(m_state.dual.buffer));
+            const double INTERACTION = std::fabs(utility::sparse::dot_dot(
+                &m_state.dual.buffer, m_state.dual.move,
+                INSTANCE.primal_constraint_coefficients, m_state.primal.move));
 
             const double STEP_SIZE_LIMIT =
                 INTERACTION > constant::EPSILON
-                    ? 0.5 * MOVE * MOVE / INTERACTION
+                    ? 0.5 * MOVE_SQUARE_SUM / INTERACTION
                     : std::numeric_limits<double>::max();
 
             const double STEP_SIZE_CANDIDATE = std::min(
@@ -338,8 +371,13 @@ class PDLPCoreStateManager {
                     step_size_trial);
 
             if (step_size_trial < STEP_SIZE_LIMIT) {
-                m_state.primal.solution    = m_state.primal.solution_trial;
-                m_state.dual.solution      = m_state.dual.solution_trial;
+                /**
+                 * The trial solutions are no longer needed and are
+                 * overwritten in the next update, so they are swapped
+                 * instead of copied.
+                 */
+                m_state.primal.solution.swap(m_state.primal.solution_trial);
+                m_state.dual.solution.swap(m_state.dual.solution_trial);
                 m_state.step_size_previous = step_size_trial;
                 m_state.step_size_current  = STEP_SIZE_CANDIDATE;
                 return;
@@ -464,9 +502,26 @@ class PDLPCoreStateManager {
 
     /*************************************************************************/
     inline void update_convergence_information(void) {
+        /**
+         * The convergence information is always evaluated with the double
+         * precision matrix values, even in the mixed precision mode.
+         */
+        auto& primal_constraint_coefficients =
+            m_instance_ptr->primal_constraint_coefficients;
+        auto& dual_constraint_coefficients =
+            m_instance_ptr->dual_constraint_coefficients;
+
+        primal_constraint_coefficients.is_enabled_single_precision = false;
+        dual_constraint_coefficients.is_enabled_single_precision   = false;
+
         this->update_objective();
         this->update_violation();
         this->update_gap();
+
+        primal_constraint_coefficients.is_enabled_single_precision =
+            m_state.is_enabled_single_precision;
+        dual_constraint_coefficients.is_enabled_single_precision =
+            m_state.is_enabled_single_precision;
     }
 
     /*************************************************************************/
@@ -12,11 +12,11 @@ template <class T_Variable, class T_Expression>
 class SearchTree {
    private:
     utility::graph::Graph<int> m_tree;
-    std::vector<
-        std::pair<solution::SparseSolution<T_Variable, T_Expression>, int>>
+    std::vector<std::pair<
+        solution::IndexedSparseSolution<T_Variable, T_Expression>, int>>
         m_frontier_solutions;
-    std::vector<
-        std::pair<solution::SparseSolution<T_Variable, T_Expression>, int>>
+    std::vector<std::pair<
+        solution::IndexedSparseSolution<T_Variable, T_Expression>, int>>
         m_locally_optimal_solutions;
 
    public:
@@ -26,10 +26,11 @@ class SearchTree {
     }
 
     /*************************************************************************/
-    SearchTree(const solution::SolutionArchive<T_Variable, T_Expression>&
-                   a_SOLUTION_ARCHIVE,
-               const solution::SparseSolution<T_Variable, T_Expression>&
-                   a_INCUMBENT_SOLUTION) {
+    SearchTree(
+        const solution::IndexedSolutionArchive<T_Variable, T_Expression>&
+            a_SOLUTION_ARCHIVE,
+        const solution::IndexedSparseSolution<T_Variable, T_Expression>&
+            a_INCUMBENT_SOLUTION) {
         this->setup(a_SOLUTION_ARCHIVE, a_INCUMBENT_SOLUTION);
     }
 
@@ -41,18 +42,20 @@ class SearchTree {
     }
 
     /*************************************************************************/
-    inline void update(const solution::SolutionArchive<
-                           T_Variable, T_Expression>& a_SOLUTION_ARCHIVE,
-                       const solution::SparseSolution<T_Variable, T_Expression>&
-                           a_INCUMBENT_SOLUTION) {
+    inline void update(
+        const solution::IndexedSolutionArchive<T_Variable, T_Expression>&
+            a_SOLUTION_ARCHIVE,
+        const solution::IndexedSparseSolution<T_Variable, T_Expression>&
+            a_INCUMBENT_SOLUTION) {
         this->setup(a_SOLUTION_ARCHIVE, a_INCUMBENT_SOLUTION);
     }
 
     /*************************************************************************/
-    inline void setup(const solution::SolutionArchive<T_Variable, T_Expression>&
-                          a_SOLUTION_ARCHIVE,
-                      const solution::SparseSolution<T_Variable, T_Expression>&
-                          a_INCUMBENT_SOLUTION) {
+    inline void setup(
+        const solution::IndexedSolutionArchive<T_Variable, T_Expression>&
+            a_SOLUTION_ARCHIVE,
+        const solution::IndexedSparseSolution<T_Variable, T_Expression>&
+            a_INCUMBENT_SOLUTION) {
         m_frontier_solutions.clear();
         m_locally_optimal_solutions.clear();
 
@@ -120,15 +123,15 @@ class SearchTree {
     }
 
     /*************************************************************************/
-    inline const std::vector<
-        std::pair<solution::SparseSolution<T_Variable, T_Expression>, int>>&
+    inline const std::vector<std::pair<
+        solution::IndexedSparseSolution<T_Variable, T_Expression>, int>>&
     frontier_solutions(void) const {
         return m_frontier_solutions;
     }
 
     /*************************************************************************/
-    inline const std::vector<
-        std::pair<solution::SparseSolution<T_Variable, T_Expression>, int>>&
+    inline const std::vector<std::pair<
+        solution::IndexedSparseSolution<T_Variable, T_Expression>, int>>&
     locally_optimal_solutions(void) const {
         return m_locally_optimal_solutions;
     }
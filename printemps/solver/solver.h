@@ -14,6 +14,7 @@
 #include "lagrange_dual/controller/lagrange_dual_controller.h"
 #include "local_search/controller/local_search_controller.h"
 #include "tabu_search/controller/tabu_search_controller.h"
+#include "tabu_search/portfolio/tabu_search_portfolio.h"
 
 namespace printemps::solver {
 /*****************************************************************************/
@@ -44,6 +45,8 @@ class Solver {
         m_local_search_controller;
     tabu_search::controller::TabuSearchController<T_Variable, T_Expression>
         m_tabu_search_controller;
+    tabu_search::portfolio::TabuSearchPortfolio<T_Variable, T_Expression>
+        m_tabu_search_portfolio;
 
     /*************************************************************************/
     inline void print_program_info(const bool a_IS_ENABLED_PRINT) {
@@ -82,8 +85,9 @@ class Solver {
     }
 
     /*************************************************************************/
-    inline void enable_default_neighborhood(void) {
-        auto& neighborhood = m_model_ptr->neighborhood();
+    inline void enable_default_neighborhood(
+        model::Model<T_Variable, T_Expression>* a_model_ptr) {
+        auto& neighborhood = a_model_ptr->neighborhood();
 
         if (m_option.neighborhood.is_enabled_binary_move &&
             neighborhood.binary().moves().size() > 0) {
@@ -136,13 +140,37 @@ class Solver {
 
         auto named_solution = m_model_ptr->export_named_solution();
 
+        /**
+         * The feasible solutions are stored with the variable ids during the
+         * search, and they are converted to the ones keyed by the variable
+         * names here.
+         */
+        const auto& INDEXED_ARCHIVE = m_global_state.feasible_solution_archive;
+        solution::SolutionArchive<T_Variable, T_Expression>
+            feasible_solution_archive(INDEXED_ARCHIVE.max_size(),             //
+                                      INDEXED_ARCHIVE.sort_mode(),            //
+                                      INDEXED_ARCHIVE.name(),                 //
+                                      INDEXED_ARCHIVE.number_of_variables(),  //
+                                      INDEXED_ARCHIVE.number_of_constraints());
+
+        std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+            feasible_solutions;
+        feasible_solutions.reserve(INDEXED_ARCHIVE.size());
+        for (const auto& solution : INDEXED_ARCHIVE.solutions()) {
+            feasible_solutions.push_back(
+                m_model_ptr->export_sparse_solution(solution));
+        }
+        feasible_solution_archive.push(feasible_solutions);
+        feasible_solution_archive.update_has_feasible_solution();
+
         /**
          * Prepare the result object to return.
          */
         m_time_keeper.clock();
+        m_time_keeper.cpu_clock();
         Status<T_Variable, T_Expression> status(this);
         Result<T_Variable, T_Expression> result(  //
-            named_solution, status, m_global_state.feasible_solution_archive);
+            named_solution, status, feasible_solution_archive);
 
         return result;
     }
@@ -189,8 +217,92 @@ class Solver {
                                  .to_sparse();
     }
 
+    /*************************************************************************/
+    inline void setup_walkers(void) {
+        if (m_option.parallel.number_of_walkers <= 1) {
+            return;
+        }
+
+        if (m_option.neighborhood.is_enabled_user_defined_move) {
+            m_option.parallel.number_of_walkers = 1;
+            utility::print_warning(
+                "The tabu search portfolio was disabled because the model "
+                "with user-defined neighborhood cannot be forked.",
+                m_option.output.verbose >= option::verbose::Warning);
+            return;
+        }
+
+        /**
+         * In the portfolio mode, the threads are used for the walkers instead
+         * of the inner loops over moves.
+         */
+        m_option.parallel.is_enabled_move_update_parallelization     = false;
+        m_option.parallel.is_enabled_move_evaluation_parallelization = false;
+        m_option.parallel.is_enabled_thread_count_optimization       = false;
+
+        utility::print_single_line(  //
+            m_option.output.verbose >= option::verbose::Outer);
+        utility::print_message(  //
+            "Setting up " +
+                std::to_string(m_option.parallel.number_of_walkers - 1) +
+                " additional tabu search walkers...",
+            m_option.output.verbose >= option::verbose::Outer);
+
+        for (auto i = 1; i < m_option.parallel.number_of_walkers; i++) {
+            auto walker_ptr = std::make_unique<
+                tabu_search::portfolio::TabuSearchWalker<T_Variable,
+                                                         T_Expression>>();
+            walker_ptr->option = tabu_search::portfolio::TabuSearchPortfolio<
+                T_Variable, T_Expression>::create_walker_option(m_option, i);
+            walker_ptr->model_ptr = m_model_ptr->fork(walker_ptr->option);
+
+            auto  model_ptr    = walker_ptr->model_ptr.get();
+            auto& global_state = walker_ptr->global_state;
+
+            this->enable_default_neighborhood(model_ptr);
+
+            global_state.memory.setup(model_ptr);
+            global_state.feasible_solution_archive.setup(
+                m_option.output.feasible_solutions_capacity,  //
+                model_ptr->is_minimization()
+                    ? solution::SortMode::Ascending
+                    : solution::SortMode::Descending,  //
+                model_ptr->name(),                     //
+                model_ptr->number_of_variables(),      //
+                model_ptr->number_of_constraints());
+            global_state.incumbent_solution_archive.setup(
+                -1,  //
+                solution::SortMode::Off,
+                model_ptr->name(),                 //
+                model_ptr->number_of_variables(),  //
+                model_ptr->number_of_constraints());
+
+            global_state.model_ptr  = model_ptr;
+            global_state.solver_ptr = this;
+
+            model_ptr->update();
+
+            m_tabu_search_portfolio.add_walker(std::move(walker_ptr));
+        }
+    }
+
     /*************************************************************************/
     inline void run_tabu_search(void) {
+        if (m_tabu_search_portfolio.number_of_walkers() > 1) {
+            m_tabu_search_portfolio.run(&m_tabu_search_controller,  //
+                                        m_model_ptr,                //
+                                        &m_global_state,            //
+                                        m_current_solution,         //
+                                        m_time_keeper,              //
+                                        m_check_interrupt,          //
+                                        m_callback,                 //
+                                        m_option);
+            m_current_solution = m_global_state.incumbent_holder
+                                     .global_augmented_incumbent_solution()
+                                     .to_sparse();
+            return;
+        }
+
         m_tabu_search_controller.setup(m_model_ptr,         //
                                        &m_global_state,     //
                                        m_current_solution,  //
@@ -242,6 +354,7 @@ class Solver {
         m_lagrange_dual_controller.initialize();
         m_local_search_controller.initialize();
         m_tabu_search_controller.initialize();
+        m_tabu_search_portfolio.initialize();
     }
 
     /*************************************************************************/
@@ -376,16 +489,23 @@ class Solver {
                 max_number_of_threads;
         }
 
+        /**
+         * Each walker of the tabu search portfolio occupies a thread.
+         */
+        m_option.parallel.number_of_walkers = std::min(
+            m_option.parallel.number_of_walkers, max_number_of_threads);
+
 #else
         m_option.parallel.number_of_threads_move_update     = 1;
         m_option.parallel.number_of_threads_move_evaluation = 1;
+        m_option.parallel.number_of_walkers                 = 1;
 #endif
 
         /**
          * Enables the default neighborhood moves. Special neighborhood moves
          * will be enabled when optimization stagnates.
          */
-        this->enable_default_neighborhood();
+        this->enable_default_neighborhood(m_model_ptr);
 
         /**
          * Set local and global penalty coefficient for each constraint.
@@ -450,7 +570,12 @@ class Solver {
         m_current_solution = initial_solution.to_sparse();
 
         m_global_state.incumbent_solution_archive.push(
-            m_model_ptr->export_sparse_solution());
+            m_model_ptr->export_indexed_sparse_solution());
+
+        /**
+         * Prepare the additional tabu search walkers (optional).
+         */
+        this->setup_walkers();
     }
 
     /*************************************************************************/
@@ -610,6 +735,13 @@ class Solver {
         return m_local_search_controller;
     }
 
+    /*************************************************************************/
+    inline const tabu_search::portfolio::TabuSearchPortfolio<T_Variable,
+                                                             T_Expression>&
+    tabu_search_portfolio(void) const {
+        return m_tabu_search_portfolio;
+    }
+
     /*************************************************************************/
     inline const tabu_search::controller::TabuSearchController<T_Variable,
                                                                T_Expression>&
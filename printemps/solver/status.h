@@ -29,6 +29,7 @@ struct Status {
     int         number_of_variables;
     int         number_of_constraints;
     double      elapsed_time;
+    double      elapsed_cpu_time;
     int         number_of_lagrange_dual_iterations;
     int         number_of_local_search_iterations;
     long        number_of_tabu_search_iterations;
@@ -75,6 +76,7 @@ struct Status {
         this->number_of_variables                = 0;
         this->number_of_constraints              = 0;
         this->elapsed_time                       = 0.0;
+        this->elapsed_cpu_time                   = 0.0;
         this->number_of_local_search_iterations  = 0;
         this->number_of_lagrange_dual_iterations = 0;
         this->number_of_tabu_search_iterations   = 0;
@@ -120,6 +122,8 @@ struct Status {
         this->number_of_variables   = this->model_ptr->number_of_variables();
         this->number_of_constraints = this->model_ptr->number_of_constraints();
         this->elapsed_time = a_solver_ptr->time_keeper().elapsed_time();
+        this->elapsed_cpu_time =
+            a_solver_ptr->time_keeper().elapsed_cpu_time();
 
         this->number_of_local_search_iterations =
             LOCAL_SEARCH_RESULT.core.number_of_iterations;
@@ -164,92 +168,97 @@ struct Status {
     }
 
     /*************************************************************************/
-    inline void add_summary_json(utility::json::JsonObject *a_object) const {
-        a_object->emplace_back(  //
+    inline void add_summary_json(
+        utility::json::JsonWriter *a_writer_ptr) const {
+        a_writer_ptr->member(  //
             "version", constant::VERSION);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "name", this->name);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "number_of_variables", this->number_of_variables);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "number_of_constraints", this->number_of_constraints);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "objective", this->objective);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "total_violation", this->total_violation);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "is_found_feasible_solution", this->is_found_feasible_solution);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "start_date_time", this->start_date_time);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "finish_date_time", this->finish_date_time);
 
-        a_object->emplace_back(  //
+        a_writer_ptr->member(  //
             "elapsed_time", this->elapsed_time);
 
-        a_object->emplace_back(                    //
+        a_writer_ptr->member(  //
+            "elapsed_cpu_time", this->elapsed_cpu_time);
+
+        a_writer_ptr->member(                      //
             "number_of_lagrange_dual_iterations",  //
             this->number_of_lagrange_dual_iterations);
 
-        a_object->emplace_back(                   //
+        a_writer_ptr->member(                     //
             "number_of_local_search_iterations",  //
             this->number_of_local_search_iterations);
 
-        a_object->emplace_back(                  //
+        a_writer_ptr->member(                    //
             "number_of_tabu_search_iterations",  //
             this->number_of_tabu_search_iterations);
 
-        a_object->emplace_back(             //
+        a_writer_ptr->member(               //
             "number_of_tabu_search_loops",  //
             this->number_of_tabu_search_loops);
 
-        a_object->emplace_back(           //
+        a_writer_ptr->member(             //
             "number_of_evaluated_moves",  //
             this->number_of_evaluated_moves);
 
-        a_object->emplace_back(                //
+        a_writer_ptr->member(                  //
             "averaged_inner_iteration_speed",  //
             this->averaged_inner_iteration_speed);
 
-        a_object->emplace_back(                //
+        a_writer_ptr->member(                  //
             "averaged_move_evaluation_speed",  //
             this->averaged_move_evaluation_speed);
 
-        a_object->emplace_back(                        //
+        a_writer_ptr->member(                          //
             "averaged_number_of_threads_move_update",  //
             this->averaged_number_of_threads_move_update);
 
-        a_object->emplace_back(                            //
+        a_writer_ptr->member(                              //
             "averaged_number_of_threads_move_evaluation",  //
             this->averaged_number_of_threads_move_evaluation);
 
         const auto &PROBLEM_SIZE_REDUCER =
             this->model_ptr->problem_size_reducer();
 
-        a_object->emplace_back(                           //
+        a_writer_ptr->member(                             //
             "variable_bound_update_count_in_preprocess",  //
             PROBLEM_SIZE_REDUCER.variable_bound_update_count_in_preprocess());
 
-        a_object->emplace_back(                             //
+        a_writer_ptr->member(                               //
             "variable_bound_update_count_in_optimization",  //
             PROBLEM_SIZE_REDUCER.variable_bound_update_count_in_optimization());
     }
 
     /*************************************************************************/
-    inline void add_option_json(utility::json::JsonObject *a_object) const {
-        a_object->emplace_back("option", this->option.to_json());
+    inline void add_option_json(utility::json::JsonWriter *a_writer_ptr) const {
+        a_writer_ptr->member("option", this->option.to_json());
     }
 
     /*************************************************************************/
-    inline void add_nonzero_detail(utility::json::JsonObject *a_object) const {
+    inline void add_nonzero_detail(
+        utility::json::JsonWriter *a_writer_ptr) const {
         const std::array<std::string, 2> LABELS = {"original", "presolved"};
         const std::array<
             model_component::VariableReference<T_Variable, T_Expression> *, 2>
@@ -262,7 +271,8 @@ struct Status {
                 &(this->model_ptr->constraint_reference_original()),
                 &(this->model_ptr->constraint_reference())};
 
-        utility::json::JsonObject nonzero_detail;
+        a_writer_ptr->key("nonzero_detail");
+        a_writer_ptr->begin_object();
 
         for (auto i = 0; i < 2; i++) {
             const auto  LABEL = LABELS[i];
@@ -310,36 +320,38 @@ struct Status {
                                           static_cast<double>(CONSTRAINTS_SIZE);
             }
 
-            utility::json::JsonObject obj;
+            a_writer_ptr->key(LABEL);
+            a_writer_ptr->begin_object();
 
-            obj.emplace_back("nonzero", nonzero);
-            obj.emplace_back("density", density);
+            a_writer_ptr->member("nonzero", nonzero);
+            a_writer_ptr->member("density", density);
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "variable_nonzero_mean", variable_nonzero_mean);
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "variable_nonzero_min", variable_nonzero_range.min());
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "variable_nonzero_max", variable_nonzero_range.max());
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "constraint_nonzero_mean", constraint_nonzero_mean);
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "constraint_nonzero_min", constraint_nonzero_range.min());
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "constraint_nonzero_max", constraint_nonzero_range.max());
 
-            nonzero_detail.emplace_back(LABEL, obj);
+            a_writer_ptr->end_object();
         }
-        a_object->emplace_back("nonzero_detail", nonzero_detail);
+        a_writer_ptr->end_object();
     }
 
     /*************************************************************************/
-    inline void add_variable_detail(utility::json::JsonObject *a_object) const {
+    inline void add_variable_detail(
+        utility::json::JsonWriter *a_writer_ptr) const {
         const std::array<std::string, 2> LABELS = {"original", "presolved"};
         const std::array<
             model_component::VariableReference<T_Variable, T_Expression> *, 2>
@@ -347,26 +359,29 @@ struct Status {
                 &(this->model_ptr->variable_reference_original()),
                 &(this->model_ptr->variable_reference())};
 
-        utility::json::JsonObject variable_detail;
+        a_writer_ptr->key("variable_detail");
+        a_writer_ptr->begin_object();
 
         for (auto i = 0; i < 2; i++) {
             const auto  LABEL     = LABELS[i];
             const auto &REFERENCE = (*VARIABLE_REFERENCE_PTRS[i]);
 
-            utility::json::JsonObject obj;
-            obj.emplace_back("all", REFERENCE.variable_ptrs.size());
-            obj.emplace_back("fixed", REFERENCE.fixed_variable_ptrs.size());
-            obj.emplace_back("mutable", REFERENCE.mutable_variable_ptrs.size());
+            a_writer_ptr->key(LABEL);
+            a_writer_ptr->begin_object();
+            a_writer_ptr->member("all", REFERENCE.variable_ptrs.size());
+            a_writer_ptr->member("fixed", REFERENCE.fixed_variable_ptrs.size());
+            a_writer_ptr->member(  //
+                "mutable", REFERENCE.mutable_variable_ptrs.size());
 
-            variable_detail.emplace_back(LABEL, obj);
+            a_writer_ptr->end_object();
         }
 
-        a_object->emplace_back("variable_detail", variable_detail);
+        a_writer_ptr->end_object();
     }
 
     /*************************************************************************/
     inline void add_variable_type_detail(
-        utility::json::JsonObject *a_object) const {
+        utility::json::JsonWriter *a_writer_ptr) const {
         const std::array<std::string, 2> LABELS = {"original", "presolved"};
         const std::array<
             model_component::VariableTypeReference<T_Variable, T_Expression> *,
@@ -392,7 +407,8 @@ struct Status {
                                  });
         };
 
-        utility::json::JsonObject variable_type_detail;
+        a_writer_ptr->key("variable_type_detail");
+        a_writer_ptr->begin_object();
 
         for (auto i = 0; i < 2; i++) {
             const auto  LABEL     = LABELS[i];
@@ -402,38 +418,39 @@ struct Status {
                 (i == 0) ? compute_number_of_all_variables
                          : compute_number_of_mutable_variables;
 
-            utility::json::JsonObject obj;
+            a_writer_ptr->key(LABEL);
+            a_writer_ptr->begin_object();
 
-            obj.emplace_back(  //
-                "binary",      //
+            a_writer_ptr->member(  //
+                "binary",          //
                 compute_number_of_variables(REFERENCE.binary_variable_ptrs));
 
-            obj.emplace_back(  //
-                "integer",     //
+            a_writer_ptr->member(  //
+                "integer",         //
                 compute_number_of_variables(REFERENCE.integer_variable_ptrs));
 
-            obj.emplace_back(  //
-                "selection",   //
+            a_writer_ptr->member(  //
+                "selection",       //
                 compute_number_of_variables(REFERENCE.selection_variable_ptrs));
 
-            obj.emplace_back(        //
+            a_writer_ptr->member(    //
                 "dependent_binary",  //
                 compute_number_of_variables(
                     REFERENCE.dependent_binary_variable_ptrs));
 
-            obj.emplace_back(         //
+            a_writer_ptr->member(     //
                 "dependent_integer",  //
                 compute_number_of_variables(
                     REFERENCE.dependent_integer_variable_ptrs));
 
-            variable_type_detail.emplace_back(LABEL, obj);
+            a_writer_ptr->end_object();
         }
-        a_object->emplace_back("variable_type_detail", variable_type_detail);
+        a_writer_ptr->end_object();
     }
 
     /*************************************************************************/
     inline void add_constraint_detail(
-        utility::json::JsonObject *a_object) const {
+        utility::json::JsonWriter *a_writer_ptr) const {
         const std::array<std::string, 2> LABELS = {"original", "presolved"};
         const std::array<
             model_component::ConstraintReference<T_Variable, T_Expression> *, 2>
@@ -441,32 +458,34 @@ struct Status {
                 &(this->model_ptr->constraint_reference_original()),
                 &(this->model_ptr->constraint_reference())};
 
-        utility::json::JsonObject constraint_detail;
+        a_writer_ptr->key("constraint_detail");
+        a_writer_ptr->begin_object();
 
         for (auto i = 0; i < 2; i++) {
             const auto  LABEL     = LABELS[i];
             const auto &REFERENCE = (*CONSTRAINT_REFERENCE_PTRS[i]);
 
-            utility::json::JsonObject obj;
+            a_writer_ptr->key(LABEL);
+            a_writer_ptr->begin_object();
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "all", REFERENCE.constraint_ptrs.size());
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "enabled", REFERENCE.enabled_constraint_ptrs.size());
 
-            obj.emplace_back(  //
+            a_writer_ptr->member(  //
                 "disabled", REFERENCE.disabled_constraint_ptrs.size());
 
-            constraint_detail.emplace_back(LABEL, obj);
+            a_writer_ptr->end_object();
         }
 
-        a_object->emplace_back("constraint_detail", constraint_detail);
+        a_writer_ptr->end_object();
     }
 
     /*************************************************************************/
     inline void add_constraint_type_detail(
-        utility::json::JsonObject *a_object) const {
+        utility::json::JsonWriter *a_writer_ptr) const {
         const std::array<std::string, 2> LABELS = {"original", "presolved"};
         const std::array<model_component::ConstraintTypeReference<
                              T_Variable, T_Expression> *,
@@ -475,7 +494,8 @@ struct Status {
                 &(this->model_ptr->constraint_type_reference_original()),
                 &(this->model_ptr->constraint_type_reference())};
 
-        utility::json::JsonObject constraint_type_detail;
+        a_writer_ptr->key("constraint_type_detail");
+        a_writer_ptr->begin_object();
 
         std::function<std::size_t(const std::vector<model_component::Constraint<
                                       T_Variable, T_Expression> *> &)>
@@ -503,200 +523,202 @@ struct Status {
                 (i == 0) ? compute_number_of_all_constraints
                          : compute_number_of_enabled_constraints;
 
-            utility::json::JsonObject obj;
+            a_writer_ptr->key(LABEL);
+            a_writer_ptr->begin_object();
 
-            obj.emplace_back(  //
-                "singleton",   //
+            a_writer_ptr->member(  //
+                "singleton",       //
                 compute_number_of_constraints(REFERENCE.singleton_ptrs));
 
-            obj.emplace_back(    //
-                "exclusive_or",  //
+            a_writer_ptr->member(  //
+                "exclusive_or",    //
                 compute_number_of_constraints(REFERENCE.exclusive_or_ptrs));
 
-            obj.emplace_back(     //
-                "exclusive_nor",  //
+            a_writer_ptr->member(  //
+                "exclusive_nor",   //
                 compute_number_of_constraints(REFERENCE.exclusive_nor_ptrs));
 
-            obj.emplace_back(         //
+            a_writer_ptr->member(     //
                 "inverted_integers",  //
                 compute_number_of_constraints(
                     REFERENCE.inverted_integers_ptrs));
 
-            obj.emplace_back(         //
+            a_writer_ptr->member(     //
                 "balanced_integers",  //
                 compute_number_of_constraints(
                     REFERENCE.balanced_integers_ptrs));
 
-            obj.emplace_back(             //
+            a_writer_ptr->member(         //
                 "constant_sum_integers",  //
                 compute_number_of_constraints(
                     REFERENCE.constant_sum_integers_ptrs));
 
-            obj.emplace_back(                    //
+            a_writer_ptr->member(                //
                 "constant_difference_integers",  //
                 compute_number_of_constraints(
                     REFERENCE.constant_difference_integers_ptrs));
 
-            obj.emplace_back(               //
+            a_writer_ptr->member(           //
                 "constant_ratio_integers",  //
                 compute_number_of_constraints(
                     REFERENCE.constant_ratio_integers_ptrs));
 
-            obj.emplace_back(   //
-                "aggregation",  //
+            a_writer_ptr->member(  //
+                "aggregation",     //
                 compute_number_of_constraints(REFERENCE.aggregation_ptrs));
 
-            obj.emplace_back(  //
-                "precedence",  //
+            a_writer_ptr->member(  //
+                "precedence",      //
                 compute_number_of_constraints(REFERENCE.precedence_ptrs));
 
-            obj.emplace_back(      //
+            a_writer_ptr->member(  //
                 "variable_bound",  //
                 compute_number_of_constraints(REFERENCE.variable_bound_ptrs));
 
-            obj.emplace_back(               //
+            a_writer_ptr->member(           //
                 "trinomial_exclusive_nor",  //
                 compute_number_of_constraints(
                     REFERENCE.trinomial_exclusive_nor_ptrs));
 
-            obj.emplace_back(        //
+            a_writer_ptr->member(    //
                 "set_partitioning",  //
                 compute_number_of_constraints(REFERENCE.set_partitioning_ptrs));
 
-            obj.emplace_back(   //
-                "set_packing",  //
+            a_writer_ptr->member(  //
+                "set_packing",     //
                 compute_number_of_constraints(REFERENCE.set_packing_ptrs));
 
-            obj.emplace_back(    //
-                "set_covering",  //
+            a_writer_ptr->member(  //
+                "set_covering",    //
                 compute_number_of_constraints(REFERENCE.set_covering_ptrs));
 
-            obj.emplace_back(   //
-                "cardinality",  //
+            a_writer_ptr->member(  //
+                "cardinality",     //
                 compute_number_of_constraints(REFERENCE.cardinality_ptrs));
 
-            obj.emplace_back(          //
+            a_writer_ptr->member(      //
                 "invariant_knapsack",  //
                 compute_number_of_constraints(
                     REFERENCE.invariant_knapsack_ptrs));
 
-            obj.emplace_back(         //
+            a_writer_ptr->member(     //
                 "multiple_covering",  //
                 compute_number_of_constraints(
                     REFERENCE.multiple_covering_ptrs));
 
-            obj.emplace_back(   //
-                "binary_flow",  //
+            a_writer_ptr->member(  //
+                "binary_flow",     //
                 compute_number_of_constraints(REFERENCE.binary_flow_ptrs));
 
-            obj.emplace_back(    //
-                "integer_flow",  //
+            a_writer_ptr->member(  //
+                "integer_flow",    //
                 compute_number_of_constraints(REFERENCE.integer_flow_ptrs));
 
-            obj.emplace_back(      //
+            a_writer_ptr->member(  //
                 "soft_selection",  //
                 compute_number_of_constraints(REFERENCE.soft_selection_ptrs));
 
-            obj.emplace_back(  //
-                "min_max",     //
+            a_writer_ptr->member(  //
+                "min_max",         //
                 compute_number_of_constraints(REFERENCE.min_max_ptrs));
 
-            obj.emplace_back(  //
-                "max_min",     //
+            a_writer_ptr->member(  //
+                "max_min",         //
                 compute_number_of_constraints(REFERENCE.max_min_ptrs));
 
-            obj.emplace_back(    //
-                "intermediate",  //
+            a_writer_ptr->member(  //
+                "intermediate",    //
                 compute_number_of_constraints(REFERENCE.intermediate_ptrs));
 
-            obj.emplace_back(         //
+            a_writer_ptr->member(     //
                 "equation_knapsack",  //
                 compute_number_of_constraints(
                     REFERENCE.equation_knapsack_ptrs));
 
-            obj.emplace_back(   //
-                "bin_packing",  //
+            a_writer_ptr->member(  //
+                "bin_packing",     //
                 compute_number_of_constraints(REFERENCE.bin_packing_ptrs));
 
-            obj.emplace_back(  //
-                "knapsack",    //
+            a_writer_ptr->member(  //
+                "knapsack",        //
                 compute_number_of_constraints(REFERENCE.knapsack_ptrs));
 
-            obj.emplace_back(        //
+            a_writer_ptr->member(    //
                 "integer_knapsack",  //
                 compute_number_of_constraints(REFERENCE.integer_knapsack_ptrs));
 
-            obj.emplace_back(  //
-                "gf2",         //
+            a_writer_ptr->member(  //
+                "gf2",             //
                 compute_number_of_constraints(REFERENCE.gf2_ptrs));
 
-            obj.emplace_back(      //
+            a_writer_ptr->member(  //
                 "general_linear",  //
                 compute_number_of_constraints(REFERENCE.general_linear_ptrs));
 
-            constraint_type_detail.emplace_back(LABEL, obj);
+            a_writer_ptr->end_object();
         }
 
-        a_object->emplace_back("constraint_type_detail",
-                               constraint_type_detail);
+        a_writer_ptr->end_object();
     }
 
     /*************************************************************************/
     void write_json_by_name(const std::string &a_FILE_NAME) const {
-        utility::json::JsonObject object;
-        this->add_summary_json(&object);
-        this->add_variable_detail(&object);
-        this->add_variable_type_detail(&object);
-        this->add_constraint_detail(&object);
-        this->add_constraint_type_detail(&object);
-        this->add_nonzero_detail(&object);
-        this->add_option_json(&object);
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
+        this->add_summary_json(&writer);
+        this->add_variable_detail(&writer);
+        this->add_variable_type_detail(&writer);
+        this->add_constraint_detail(&writer);
+        this->add_constraint_type_detail(&writer);
+        this->add_nonzero_detail(&writer);
+        this->add_option_json(&writer);
 
         /// Penalty coefficients
-        object.emplace_back(         //
-            "penalty_coefficients",  //
-            multi_array::create_json_object(penalty_coefficients));
+        writer.key("penalty_coefficients");
+        multi_array::write_json_object(&writer, penalty_coefficients);
 
         /// Update counts
-        object.emplace_back(  //
-            "update_counts",  //
-            multi_array::create_json_object(update_counts));
+        writer.key("update_counts");
+        multi_array::write_json_object(&writer, update_counts);
 
         /// Violation counts
-        object.emplace_back(     //
-            "violation_counts",  //
-            multi_array::create_json_object(violation_counts));
+        writer.key("violation_counts");
+        multi_array::write_json_object(&writer, violation_counts);
 
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_object();
+        writer.flush();
     }
 
     /*************************************************************************/
     void write_json_by_array(const std::string &a_FILE_NAME) const {
-        utility::json::JsonObject object;
-        this->add_summary_json(&object);
-        this->add_variable_detail(&object);
-        this->add_variable_type_detail(&object);
-        this->add_constraint_detail(&object);
-        this->add_constraint_type_detail(&object);
-        this->add_nonzero_detail(&object);
-        this->add_option_json(&object);
+        std::ofstream             ofs(a_FILE_NAME);
+        utility::json::JsonWriter writer(&ofs);
+
+        writer.begin_object();
+        this->add_summary_json(&writer);
+        this->add_variable_detail(&writer);
+        this->add_variable_type_detail(&writer);
+        this->add_constraint_detail(&writer);
+        this->add_constraint_type_detail(&writer);
+        this->add_nonzero_detail(&writer);
+        this->add_option_json(&writer);
 
         /// Penalty coefficients
-        object.emplace_back(         //
-            "penalty_coefficients",  //
-            multi_array::create_json_array(penalty_coefficients));
+        writer.key("penalty_coefficients");
+        multi_array::write_json_array(&writer, penalty_coefficients);
 
         /// Update counts
-        object.emplace_back(  //
-            "update_counts",  //
-            multi_array::create_json_array(update_counts));
+        writer.key("update_counts");
+        multi_array::write_json_array(&writer, update_counts);
 
         /// Violation counts
-        object.emplace_back(     //
-            "violation_counts",  //
-            multi_array::create_json_array(violation_counts));
+        writer.key("violation_counts");
+        multi_array::write_json_array(&writer, violation_counts);
 
-        utility::json::write_json_object(object, a_FILE_NAME);
+        writer.end_object();
+        writer.flush();
     }
 };
 }  // namespace printemps::solver
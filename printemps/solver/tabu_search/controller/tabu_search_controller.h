@@ -391,7 +391,6 @@ class TabuSearchController
                 " -- Number of feasible solutions found: " +
                     std::to_string(
                         this->m_global_state_ptr->feasible_solution_archive
-                            .solutions()
                             .size()),
                 a_IS_ENABLED_PRINT);
         }
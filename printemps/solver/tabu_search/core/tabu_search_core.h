@@ -10,6 +10,8 @@
 #include "../../memory.h"
 #include "tabu_search_core_move_score.h"
 #include "tabu_search_core_move_evaluator.h"
+#include "tabu_search_core_move_selection_candidate.h"
+#include "tabu_search_core_violation_diff_cache.h"
 #include "tabu_search_core_termination_status.h"
 #include "tabu_search_core_state.h"
 #include "tabu_search_core_state_manager.h"
@@ -26,9 +28,9 @@ class TabuSearchCore {
     std::optional<std::function<bool()>>              m_check_interrupt;
     option::Option                                    m_option;
 
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_feasible_solutions;
-    std::vector<solution::SparseSolution<T_Variable, T_Expression>>
+    std::vector<solution::IndexedSparseSolution<T_Variable, T_Expression>>
         m_incumbent_solutions;
 
     TabuSearchCoreStateManager<T_Variable, T_Expression> m_state_manager;
@@ -179,15 +181,12 @@ class TabuSearchCore {
              * improvable solution, the solution should be an optimum. It can
              * happen for decomp2 instance in MIPLIB 2017.
              */
-            m_state_manager.set_termination_status(
-                TabuSearchCoreTerminationStatus::OPTIMAL);
-            for (const auto& variable_ptr :
-                 m_model_ptr->variable_reference().variable_ptrs) {
-                if (variable_ptr->is_objective_improvable()) {
-                    m_state_manager.set_termination_status(
-                        TabuSearchCoreTerminationStatus::NO_MOVE);
-                    break;
-                }
+            if (m_model_ptr->has_objective_improvable_variable()) {
+                m_state_manager.set_termination_status(
+                    TabuSearchCoreTerminationStatus::NO_MOVE);
+            } else {
+                m_state_manager.set_termination_status(
+                    TabuSearchCoreTerminationStatus::OPTIMAL);
             }
             return true;
         } else {
@@ -526,6 +525,33 @@ class TabuSearchCore {
         return std::make_pair(selected_index, is_aspirated);
     }
 
+    /*************************************************************************/
+    inline std::pair<int, bool> select_move(
+        const TabuSearchCoreMoveSelectionCandidate& a_CANDIDATE,
+        const std::vector<TabuSearchCoreMoveScore>& a_TRIAL_MOVE_SCORES) {
+        /**
+         * This method selects a move in the same manner as the method above,
+         * using the candidate obtained by the reduction along with the move
+         * evaluation instead of scanning the scores.
+         */
+        int  selected_index = a_CANDIDATE.total_score_argmin;
+        bool is_aspirated   = false;
+
+        if (!m_option.tabu_search.ignore_tabu_if_global_incumbent) {
+            return std::make_pair(selected_index, is_aspirated);
+        }
+
+        if (a_CANDIDATE.global_augmented_objective_min + constant::EPSILON <
+            m_global_state_ptr->incumbent_holder
+                .global_augmented_incumbent_objective()) {
+            selected_index = a_CANDIDATE.global_augmented_objective_argmin;
+            if (!a_TRIAL_MOVE_SCORES[selected_index].is_permissible) {
+                is_aspirated = true;
+            }
+        }
+        return std::make_pair(selected_index, is_aspirated);
+    }
+
     /*************************************************************************/
     inline void update_memory(
         const neighborhood::Move<T_Variable, T_Expression>* a_move_ptr) {
@@ -563,13 +589,18 @@ class TabuSearchCore {
             if (chain_move.overlap_rate >
                     m_option.neighborhood.chain_move_overlap_rate_threshold &&
                 !chain_move.has_duplicate_variable()) {
-                auto back_chain_move = chain_move;
+                auto& chain = m_model_ptr->neighborhood().chain();
+                chain.register_move(chain_move);
+
+                /**
+                 * The backward move shares the related constraints stored
+                 * for the forward move.
+                 */
+                auto back_chain_move = chain.moves().back();
                 for (auto&& alteration : back_chain_move.alterations) {
                     alteration.second = 1 - alteration.second;
                 }
-                m_model_ptr->neighborhood().chain().register_move(chain_move);
-                m_model_ptr->neighborhood().chain().register_move(
-                    back_chain_move);
+                chain.register_move(back_chain_move);
             }
         }
     }
@@ -860,10 +891,31 @@ class TabuSearchCore {
         IntegerStepSizeAdjuster integer_step_size_adjuster(m_model_ptr,
                                                            m_option);
 
+        /**
+         * Prepare a cache of the violation differences for the incremental
+         * evaluation (optional).
+         */
+        const bool IS_ENABLED_INCREMENTAL_EVALUATION =
+            m_option.tabu_search.is_enabled_incremental_evaluation;
+
+        TabuSearchCoreViolationDiffCache<T_Variable, T_Expression>
+            violation_diff_cache;
+        if (IS_ENABLED_INCREMENTAL_EVALUATION) {
+            violation_diff_cache.setup(m_model_ptr);
+        }
+
         std::vector<solution::SolutionScore> trial_solution_scores;
         std::vector<TabuSearchCoreMoveScore> trial_move_scores;
         std::vector<double>                  total_scores;
 
+        /**
+         * If the move selection mode is Reduction, the move to be selected is
+         * determined along with the move evaluation.
+         */
+        const bool IS_ENABLED_MOVE_SELECTION_REDUCTION =
+            m_option.tabu_search.move_selection_mode ==
+            option::move_selection_mode::Reduction;
+
         /**
          * Print the header of optimization progress table and print the initial
          * solution status.
@@ -965,11 +1017,14 @@ class TabuSearchCore {
             const auto TABU_TENURE            = STATE.tabu_tenure;
             const auto DURATION               = ITERATION - TABU_TENURE;
 
+            TabuSearchCoreMoveSelectionCandidate selection_candidate;
+
 #ifdef _OPENMP
 #pragma omp parallel for if (m_option.parallel                                \
                                  .is_enabled_move_evaluation_parallelization) \
     schedule(static)                                                          \
-    num_threads(m_option.parallel.number_of_threads_move_evaluation)
+    num_threads(m_option.parallel.number_of_threads_move_evaluation)          \
+    reduction(merge_move_selection_candidate : selection_candidate)
 #endif
             for (auto i = 0; i < NUMBER_OF_MOVES; i++) {
                 /**
@@ -979,7 +1034,14 @@ class TabuSearchCore {
 #ifdef _PRINTEMPS_DISABLE_FAST_EVALUATION
                 if (m_option.general.is_enabled_fast_evaluation) {
 #endif
-                    if (TRIAL_MOVE_PTRS[i]->is_univariable_move) {
+                    if (IS_ENABLED_INCREMENTAL_EVALUATION &&
+                        violation_diff_cache.is_cacheable(
+                            *TRIAL_MOVE_PTRS[i])) {
+                        violation_diff_cache.evaluate(
+                            &trial_solution_scores[i],  //
+                            *TRIAL_MOVE_PTRS[i],        //
+                            CURRENT_SOLUTION_SCORE);
+                    } else if (TRIAL_MOVE_PTRS[i]->is_univariable_move) {
                         m_model_ptr->evaluate_single(
                             &trial_solution_scores[i],  //
                             *TRIAL_MOVE_PTRS[i],        //
@@ -1029,6 +1091,12 @@ class TabuSearchCore {
                       trial_solution_scores[i].is_feasibility_improvable)) {
                     total_scores[i] += constant::LARGE_VALUE_100;
                 }
+
+                if (IS_ENABLED_MOVE_SELECTION_REDUCTION) {
+                    selection_candidate.update(
+                        i, total_scores[i],
+                        trial_solution_scores[i].global_augmented_objective);
+                }
             }
             const double END_TIME = time_keeper.clock();
 
@@ -1038,11 +1106,18 @@ class TabuSearchCore {
             /**
              * Select moves for the next solution.
              */
-            const auto SELECT_RESULT = this->select_move(
-                total_scores, trial_move_scores, trial_solution_scores);
+            const auto SELECT_RESULT =
+                IS_ENABLED_MOVE_SELECTION_REDUCTION
+                    ? this->select_move(selection_candidate,
+                                        trial_move_scores)
+                    : this->select_move(total_scores, trial_move_scores,
+                                        trial_solution_scores);
             const auto SELECTED_INDEX = SELECT_RESULT.first;
             const auto IS_ASPIRATED   = SELECT_RESULT.second;
 
+            m_state_manager.update_move_selection_statistics(
+                time_keeper.clock() - END_TIME);
+
             /**
              * Update the model by the selected move.
              */
@@ -1069,6 +1144,14 @@ class TabuSearchCore {
 
             m_model_ptr->update(*move_ptr);
 
+            /**
+             * Invalidate the cached violation differences of the moves which
+             * share a constraint with the selected move.
+             */
+            if (IS_ENABLED_INCREMENTAL_EVALUATION) {
+                violation_diff_cache.invalidate(*move_ptr);
+            }
+
             /**
              * Update the memory.
              */
@@ -1107,7 +1190,7 @@ class TabuSearchCore {
                 m_model_ptr
                     ->update_dependent_variables_and_disabled_constraints();
                 m_feasible_solutions.push_back(
-                    m_model_ptr->export_sparse_solution());
+                    m_model_ptr->export_indexed_sparse_solution());
             }
 
             /**
@@ -1147,9 +1230,9 @@ class TabuSearchCore {
             solution::IncumbentHolderConstant::
                 STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE) {
             m_incumbent_solutions.push_back(
-                m_global_state_ptr->incumbent_holder
-                    .global_augmented_incumbent_solution()
-                    .to_sparse());
+                m_model_ptr->export_indexed_sparse_solution(
+                    m_global_state_ptr->incumbent_holder
+                        .global_augmented_incumbent_solution()));
         }
         /**
          * Postprocess.
@@ -1160,14 +1243,14 @@ class TabuSearchCore {
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     feasible_solutions(void) const {
         return m_feasible_solutions;
     }
 
     /*************************************************************************/
     inline const std::vector<
-        solution::SparseSolution<T_Variable, T_Expression>>&
+        solution::IndexedSparseSolution<T_Variable, T_Expression>>&
     incumbent_solutions(void) const {
         return m_incumbent_solutions;
     }
@@ -0,0 +1,95 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_CORE_TABU_SEARCH_CORE_MOVE_SELECTION_CANDIDATE_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_CORE_TABU_SEARCH_CORE_MOVE_SELECTION_CANDIDATE_H__
+
+namespace printemps::solver::tabu_search::core {
+/*****************************************************************************/
+struct TabuSearchCoreMoveSelectionCandidate {
+    /**
+     * This structure keeps the indices of the moves which minimize the total
+     * score and the global augmented objective, respectively. It is updated
+     * along with the move evaluation and merged over threads, so that the
+     * selection does not require additional scans of the scores. Ties are
+     * broken by the smaller index so that the result is identical to that of
+     * the sequential scan regardless of the order of merging.
+     */
+    int    total_score_argmin;
+    double total_score_min;
+    int    global_augmented_objective_argmin;
+    double global_augmented_objective_min;
+
+    /*************************************************************************/
+    TabuSearchCoreMoveSelectionCandidate(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->total_score_argmin                = -1;
+        this->total_score_min                   = HUGE_VAL;
+        this->global_augmented_objective_argmin = -1;
+        this->global_augmented_objective_min    = HUGE_VAL;
+    }
+
+    /*************************************************************************/
+    inline void update(const int    a_INDEX,        //
+                       const double a_TOTAL_SCORE,  //
+                       const double a_GLOBAL_AUGMENTED_OBJECTIVE) noexcept {
+        if (this->total_score_argmin < 0 ||
+            a_TOTAL_SCORE < this->total_score_min) {
+            this->total_score_argmin = a_INDEX;
+            this->total_score_min    = a_TOTAL_SCORE;
+        }
+
+        if (this->global_augmented_objective_argmin < 0 ||
+            a_GLOBAL_AUGMENTED_OBJECTIVE <
+                this->global_augmented_objective_min) {
+            this->global_augmented_objective_argmin = a_INDEX;
+            this->global_augmented_objective_min =
+                a_GLOBAL_AUGMENTED_OBJECTIVE;
+        }
+    }
+
+    /*************************************************************************/
+    inline void merge(
+        const TabuSearchCoreMoveSelectionCandidate &a_OTHER) noexcept {
+        if (a_OTHER.total_score_argmin >= 0 &&
+            (this->total_score_argmin < 0 ||
+             a_OTHER.total_score_min < this->total_score_min ||
+             (a_OTHER.total_score_min == this->total_score_min &&
+              a_OTHER.total_score_argmin < this->total_score_argmin))) {
+            this->total_score_argmin = a_OTHER.total_score_argmin;
+            this->total_score_min    = a_OTHER.total_score_min;
+        }
+
+        if (a_OTHER.global_augmented_objective_argmin >= 0 &&
+            (this->global_augmented_objective_argmin < 0 ||
+             a_OTHER.global_augmented_objective_min <
+                 this->global_augmented_objective_min ||
+             (a_OTHER.global_augmented_objective_min ==
+                  this->global_augmented_objective_min &&
+              a_OTHER.global_augmented_objective_argmin <
+                  this->global_augmented_objective_argmin))) {
+            this->global_augmented_objective_argmin =
+                a_OTHER.global_augmented_objective_argmin;
+            this->global_augmented_objective_min =
+                a_OTHER.global_augmented_objective_min;
+        }
+    }
+};
+
+#ifdef _OPENMP
+#pragma omp declare reduction(merge_move_selection_candidate           \
+                              : TabuSearchCoreMoveSelectionCandidate \
+                              : omp_out.merge(omp_in))               \
+    initializer(omp_priv = TabuSearchCoreMoveSelectionCandidate())
+#endif
+}  // namespace printemps::solver::tabu_search::core
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -18,6 +18,7 @@ struct TabuSearchCoreResult {
     long number_of_evaluated_moves;
 
     double elapsed_time_for_move_evaluation;
+    double elapsed_time_for_move_selection;
     double elapsed_time_for_move_update;
 
     TabuSearchCoreTerminationStatus termination_status;
@@ -58,6 +59,7 @@ struct TabuSearchCoreResult {
         this->number_of_evaluated_moves = 0;
 
         this->elapsed_time_for_move_evaluation = 0.0;
+        this->elapsed_time_for_move_selection  = 0.0;
         this->elapsed_time_for_move_update     = 0.0;
 
         this->termination_status =
@@ -93,6 +95,8 @@ struct TabuSearchCoreResult {
             a_STATE.elapsed_time_for_move_update;
         this->elapsed_time_for_move_evaluation =
             a_STATE.elapsed_time_for_move_evaluation;
+        this->elapsed_time_for_move_selection =
+            a_STATE.elapsed_time_for_move_selection;
 
         this->termination_status = a_STATE.termination_status;
         this->tabu_tenure        = a_STATE.tabu_tenure;
@@ -39,6 +39,7 @@ struct TabuSearchCoreState {
     long number_of_updated_moves;
 
     double elapsed_time_for_move_evaluation;
+    double elapsed_time_for_move_selection;
     double elapsed_time_for_move_update;
 
     bool is_few_permissible_neighborhood;
@@ -111,6 +112,7 @@ struct TabuSearchCoreState {
         this->number_of_updated_moves   = 0;
 
         this->elapsed_time_for_move_evaluation = 0.0;
+        this->elapsed_time_for_move_selection  = 0.0;
         this->elapsed_time_for_move_update     = 0.0;
 
         this->is_few_permissible_neighborhood = false;
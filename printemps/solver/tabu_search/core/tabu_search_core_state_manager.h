@@ -502,6 +502,11 @@ class TabuSearchCoreStateManager {
         m_state.elapsed_time_for_move_evaluation += a_ELAPSED_TIME;
     }
 
+    /*************************************************************************/
+    inline void update_move_selection_statistics(const double a_ELAPSED_TIME) {
+        m_state.elapsed_time_for_move_selection += a_ELAPSED_TIME;
+    }
+
     /*************************************************************************/
     inline TabuSearchCoreState<T_Variable, T_Expression>& state(void) {
         return m_state;
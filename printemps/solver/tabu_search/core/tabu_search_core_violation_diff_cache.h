@@ -0,0 +1,133 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_CORE_TABU_SEARCH_CORE_VIOLATION_DIFF_CACHE_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_CORE_TABU_SEARCH_CORE_VIOLATION_DIFF_CACHE_H__
+
+namespace printemps::solver::tabu_search::core {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class TabuSearchCoreViolationDiffCache {
+    /**
+     * This class caches the differences of the violation and the local
+     * penalty for binary flip moves, in the manner of the "score" tables of
+     * local search SAT solvers. The cached differences of a variable remain
+     * valid as long as none of the constraints related to the variable is
+     * updated, so that only the moves which share a constraint with the
+     * last applied move need to be re-evaluated. Note that the total scores of
+     * moves are not cached, and the tabu search core still visits every
+     * candidate move in each iteration.
+     */
+   private:
+    model::Model<T_Variable, T_Expression> *m_model_ptr;
+
+    std::vector<T_Variable>   m_target_values;
+    std::vector<double>       m_total_violation_diffs;
+    std::vector<double>       m_local_penalty_diffs;
+    std::vector<std::uint8_t> m_is_valid;
+
+   public:
+    /*************************************************************************/
+    TabuSearchCoreViolationDiffCache(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    TabuSearchCoreViolationDiffCache(
+        model::Model<T_Variable, T_Expression> *a_model_ptr) {
+        this->setup(a_model_ptr);
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_model_ptr = nullptr;
+
+        m_target_values.clear();
+        m_total_violation_diffs.clear();
+        m_local_penalty_diffs.clear();
+        m_is_valid.clear();
+    }
+
+    /*************************************************************************/
+    inline void setup(model::Model<T_Variable, T_Expression> *a_model_ptr) {
+        this->initialize();
+        m_model_ptr = a_model_ptr;
+
+        const int NUMBER_OF_VARIABLES =
+            m_model_ptr->incidence_matrix().number_of_variables;
+
+        m_target_values.resize(NUMBER_OF_VARIABLES, 0);
+        m_total_violation_diffs.resize(NUMBER_OF_VARIABLES, 0.0);
+        m_local_penalty_diffs.resize(NUMBER_OF_VARIABLES, 0.0);
+        m_is_valid.resize(NUMBER_OF_VARIABLES, 0);
+    }
+
+    /*************************************************************************/
+    inline void invalidate(void) noexcept {
+        std::fill(m_is_valid.begin(), m_is_valid.end(), 0);
+    }
+
+    /*************************************************************************/
+    inline void invalidate(
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE) noexcept {
+        for (const auto &constraint_ptr : a_MOVE.related_constraint_ptrs) {
+            for (const auto &sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                m_is_valid[sensitivity.first->id()] = 0;
+            }
+        }
+
+        for (const auto &alteration : a_MOVE.alterations) {
+            m_is_valid[alteration.first->id()] = 0;
+        }
+    }
+
+    /*************************************************************************/
+    inline bool is_cacheable(
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE)
+        const noexcept {
+        /**
+         * Only binary moves are cached, since each binary variable has exactly
+         * one flip move and the cache entries are never written concurrently
+         * in the parallelized move evaluation.
+         */
+        return a_MOVE.sense == neighborhood::MoveSense::Binary;
+    }
+
+    /*************************************************************************/
+    inline bool is_valid(const int a_VARIABLE_ID) const noexcept {
+        return m_is_valid[a_VARIABLE_ID];
+    }
+
+    /*************************************************************************/
+    inline void evaluate(
+        solution::SolutionScore                            *a_score_ptr,  //
+        const neighborhood::Move<T_Variable, T_Expression> &a_MOVE,
+        const solution::SolutionScore &a_CURRENT_SCORE) noexcept {
+        const auto &ALTERATION   = a_MOVE.alterations.front();
+        const int   VARIABLE_ID  = ALTERATION.first->id();
+        const auto  TARGET_VALUE = ALTERATION.second;
+
+        if (!m_is_valid[VARIABLE_ID] ||
+            m_target_values[VARIABLE_ID] != TARGET_VALUE) {
+            m_model_ptr->compute_violation_diff_single(
+                &m_total_violation_diffs[VARIABLE_ID],
+                &m_local_penalty_diffs[VARIABLE_ID], a_MOVE);
+            m_target_values[VARIABLE_ID] = TARGET_VALUE;
+            m_is_valid[VARIABLE_ID]      = 1;
+        }
+
+        m_model_ptr->evaluate_single(a_score_ptr,      //
+                                     a_MOVE,           //
+                                     a_CURRENT_SCORE,  //
+                                     m_total_violation_diffs[VARIABLE_ID],
+                                     m_local_penalty_diffs[VARIABLE_ID]);
+    }
+};
+}  // namespace printemps::solver::tabu_search::core
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
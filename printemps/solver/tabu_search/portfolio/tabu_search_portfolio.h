@@ -0,0 +1,240 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_PORTFOLIO_TABU_SEARCH_PORTFOLIO_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_PORTFOLIO_TABU_SEARCH_PORTFOLIO_H__
+
+#include "tabu_search_walker.h"
+
+namespace printemps::solver::tabu_search::portfolio {
+/*****************************************************************************/
+struct TabuSearchPortfolioConstant {
+    static constexpr double DIVERSIFICATION_BASE = 1.25;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class TabuSearchPortfolio {
+    /**
+     * This class runs the tabu search controller of the solver (the main
+     * walker) and additional walkers concurrently. Each walker has its own
+     * model, global state, and option, and the walkers exchange their
+     * incumbents through the shared incumbent holder at the end of each outer
+     * loop iteration.
+     */
+   private:
+    std::vector<std::unique_ptr<TabuSearchWalker<T_Variable, T_Expression>>>
+        m_walker_ptrs;
+
+    /**
+     * The shared incumbent holder must be accessed only in the critical
+     * section in synchronize().
+     */
+    solution::IncumbentHolder<T_Variable, T_Expression>
+        m_shared_incumbent_holder;
+
+   public:
+    /*************************************************************************/
+    TabuSearchPortfolio(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_walker_ptrs.clear();
+        m_shared_incumbent_holder.initialize();
+    }
+
+    /*************************************************************************/
+    inline static option::Option create_walker_option(
+        const option::Option& a_OPTION, const int a_WALKER_INDEX) {
+        /**
+         * The walkers are diversified by the random seed, the initial tabu
+         * tenure, and the penalty coefficient relaxing rate. The parameters
+         * are perturbed alternately upward and downward with increasing
+         * magnitude, so that no two walkers share the same setting.
+         */
+        option::Option option = a_OPTION;
+
+        const int STEP = ((a_WALKER_INDEX + 1) / 2) *
+                         ((a_WALKER_INDEX % 2 == 1) ? 1 : -1);
+        const double RATE =
+            std::pow(TabuSearchPortfolioConstant::DIVERSIFICATION_BASE, STEP);
+
+        option.general.seed += a_WALKER_INDEX;
+        option.tabu_search.seed += a_WALKER_INDEX;
+
+        option.tabu_search.initial_tabu_tenure = std::max(
+            1, static_cast<int>(
+                   std::round(a_OPTION.tabu_search.initial_tabu_tenure * RATE)));
+
+        option.penalty.penalty_coefficient_relaxing_rate = std::clamp(
+            std::pow(a_OPTION.penalty.penalty_coefficient_relaxing_rate, RATE),
+            a_OPTION.penalty.penalty_coefficient_relaxing_rate_min,
+            a_OPTION.penalty.penalty_coefficient_relaxing_rate_max);
+
+        /**
+         * Only the main walker prints the progress and writes the trend.
+         */
+        option.output.verbose                = option::verbose::Off;
+        option.output.is_enabled_write_trend = false;
+
+        return option;
+    }
+
+    /*************************************************************************/
+    inline void add_walker(
+        std::unique_ptr<TabuSearchWalker<T_Variable, T_Expression>>&&
+            a_walker_ptr) {
+        m_walker_ptrs.push_back(std::move(a_walker_ptr));
+    }
+
+    /*************************************************************************/
+    inline void synchronize(
+        GlobalState<T_Variable, T_Expression>* a_global_state_ptr) {
+        /**
+         * Push the incumbents of the walker to the shared holder, and then
+         * pull the better incumbents found by the other walkers.
+         */
+#ifdef _OPENMP
+#pragma omp critical(printemps_tabu_search_portfolio)
+#endif
+        {
+            m_shared_incumbent_holder.merge(
+                a_global_state_ptr->incumbent_holder);
+            a_global_state_ptr->incumbent_holder.merge(
+                m_shared_incumbent_holder);
+        }
+    }
+
+    /*************************************************************************/
+    inline void run(
+        controller::TabuSearchController<T_Variable, T_Expression>*
+                                                a_main_controller_ptr,   //
+        model::Model<T_Variable, T_Expression>* a_main_model_ptr,        //
+        GlobalState<T_Variable, T_Expression>*  a_main_global_state_ptr,  //
+        const solution::SparseSolution<T_Variable, T_Expression>&
+                                                    a_INITIAL_SOLUTION,  //
+        const utility::TimeKeeper&                  a_TIME_KEEPER,       //
+        const std::optional<std::function<bool()>>& a_CHECK_INTERRUPT,   //
+        const std::function<void(
+            solver::GlobalState<T_Variable, T_Expression>*)>& a_CALLBACK,  //
+        const option::Option&                                 a_OPTION) {
+        m_shared_incumbent_holder = a_main_global_state_ptr->incumbent_holder;
+
+        /**
+         * The walkers start with the incumbents and the dual bound obtained
+         * so far by the main walker.
+         */
+        for (auto&& walker_ptr : m_walker_ptrs) {
+            walker_ptr->global_state.incumbent_holder =
+                a_main_global_state_ptr->incumbent_holder;
+        }
+
+        const auto MAIN_CALLBACK =
+            [this, &a_CALLBACK](
+                solver::GlobalState<T_Variable, T_Expression>* a_ptr) {
+                this->synchronize(a_ptr);
+                a_CALLBACK(a_ptr);
+            };
+
+        const auto WALKER_CALLBACK =
+            [this](solver::GlobalState<T_Variable, T_Expression>* a_ptr) {
+                this->synchronize(a_ptr);
+            };
+
+        /**
+         * The user-defined interrupt checker may not be thread-safe. Only the
+         * main walker calls it, and the result is broadcast to the other
+         * walkers through an atomic flag.
+         */
+        std::atomic<bool> is_interrupted(false);
+
+        std::optional<std::function<bool()>> main_check_interrupt;
+        std::optional<std::function<bool()>> walker_check_interrupt;
+        if (a_CHECK_INTERRUPT.has_value()) {
+            main_check_interrupt = [&a_CHECK_INTERRUPT, &is_interrupted]() {
+                if (a_CHECK_INTERRUPT.value()()) {
+                    is_interrupted.store(true);
+                    return true;
+                }
+                return false;
+            };
+            walker_check_interrupt = [&is_interrupted]() {
+                return is_interrupted.load();
+            };
+        }
+
+        const int NUMBER_OF_WALKERS = m_walker_ptrs.size() + 1;
+
+        /**
+         * The main walker is assigned to the master thread so that it can
+         * print the progress. The inner loops over moves of all walkers,
+         * including the main walker, run sequentially in the portfolio mode.
+         */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(NUMBER_OF_WALKERS)
+#endif
+        for (auto i = 0; i < NUMBER_OF_WALKERS; i++) {
+            if (i == 0) {
+                a_main_controller_ptr->setup(a_main_model_ptr,         //
+                                             a_main_global_state_ptr,  //
+                                             a_INITIAL_SOLUTION,       //
+                                             a_TIME_KEEPER,            //
+                                             main_check_interrupt,     //
+                                             MAIN_CALLBACK,            //
+                                             a_OPTION);
+                a_main_controller_ptr->run();
+            } else {
+                auto& walker = *m_walker_ptrs[i - 1];
+                walker.controller.setup(walker.model_ptr.get(),  //
+                                        &walker.global_state,    //
+                                        a_INITIAL_SOLUTION,      //
+                                        a_TIME_KEEPER,           //
+                                        walker_check_interrupt,  //
+                                        WALKER_CALLBACK,         //
+                                        walker.option);
+                walker.controller.run();
+            }
+        }
+
+        /**
+         * Merge the results of the walkers into the main global state.
+         */
+        for (auto&& walker_ptr : m_walker_ptrs) {
+            a_main_global_state_ptr->incumbent_holder.merge(
+                walker_ptr->global_state.incumbent_holder);
+
+            if (a_OPTION.output.is_enabled_store_feasible_solutions) {
+                a_main_global_state_ptr->feasible_solution_archive.push(
+                    walker_ptr->global_state.feasible_solution_archive);
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline int number_of_walkers(void) const {
+        return m_walker_ptrs.size() + 1;
+    }
+
+    /*************************************************************************/
+    inline const std::vector<
+        std::unique_ptr<TabuSearchWalker<T_Variable, T_Expression>>>&
+    walker_ptrs(void) const {
+        return m_walker_ptrs;
+    }
+
+    /*************************************************************************/
+    inline const solution::IncumbentHolder<T_Variable, T_Expression>&
+    shared_incumbent_holder(void) const {
+        return m_shared_incumbent_holder;
+    }
+};
+}  // namespace printemps::solver::tabu_search::portfolio
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,42 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_PORTFOLIO_TABU_SEARCH_WALKER_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_PORTFOLIO_TABU_SEARCH_WALKER_H__
+
+namespace printemps::solver::tabu_search::portfolio {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct TabuSearchWalker {
+    /**
+     * A walker runs its own tabu search trajectory on its own replica of the
+     * model. The model and the global state are not shared with other walkers;
+     * the incumbents are exchanged only through TabuSearchPortfolio.
+     */
+    std::unique_ptr<model::Model<T_Variable, T_Expression>> model_ptr;
+    GlobalState<T_Variable, T_Expression>                   global_state;
+    option::Option                                          option;
+
+    controller::TabuSearchController<T_Variable, T_Expression> controller;
+
+    /*************************************************************************/
+    TabuSearchWalker(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->model_ptr.reset();
+        this->global_state.initialize();
+        this->option.initialize();
+        this->controller.initialize();
+    }
+};
+}  // namespace printemps::solver::tabu_search::portfolio
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
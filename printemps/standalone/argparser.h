@@ -14,6 +14,7 @@ struct ArgparserConstant {
     static constexpr bool DEFAULT_EXTRACT_FLIPPABLE_VARIABLE_PAIRS = false;
     static constexpr bool DEFAULT_INCLUDE_INSTANCE_LOADING_TIME    = false;
     static constexpr bool DEFAULT_EXPORT_JSON_INSTANCE             = false;
+    static constexpr bool DEFAULT_EXPORT_SNAPSHOT                  = false;
     static constexpr bool DEFAULT_IS_MINIMIZATION_EXPLICIT         = false;
     static constexpr bool DEFAULT_IS_MAXIMIZATION_EXPLICIT         = false;
     static constexpr int  DEFAULT_NUMBER_OF_THREADS                = -1;
@@ -34,6 +35,7 @@ struct Argparser {
     bool extract_flippable_variable_pairs;
     bool include_instance_loading_time;
     bool export_json_instance;
+    bool export_snapshot;
     bool is_minimization_explicit;
     bool is_maximization_explicit;
 
@@ -73,6 +75,7 @@ struct Argparser {
             ArgparserConstant::DEFAULT_INCLUDE_INSTANCE_LOADING_TIME;
         this->export_json_instance =
             ArgparserConstant::DEFAULT_EXPORT_JSON_INSTANCE;
+        this->export_snapshot = ArgparserConstant::DEFAULT_EXPORT_SNAPSHOT;
         this->is_minimization_explicit =
             ArgparserConstant::DEFAULT_IS_MINIMIZATION_EXPLICIT;
         this->is_maximization_explicit =
@@ -117,9 +120,10 @@ struct Argparser {
                   << "[--extract-flippable-variable-pairs] "
                   << "[--include-instance-loading-time] "
                   << "[--export-json-instance] "
+                  << "[--export-snapshot] "
                   << "[--minimization] "
                   << "[--maximization] "
-                  << "mps_file" << std::endl;
+                  << "mps_file (or snapshot_file)" << std::endl;
         std::cout << std::endl;
         std::cout  //
             << "  -p OPTION_FILE_NAME: Specify option file name." << std::endl;
@@ -192,6 +196,12 @@ struct Argparser {
             << "  --export-json-instance: Export the target instance as JSON "
                "format."
             << std::endl;
+        std::cout  //
+            << "  --export-snapshot: Export the target MPS instance as a binary "
+               "snapshot, which can be specified as the instance file (with "
+               "extension .snapshot) to skip parsing the MPS file. Note that "
+               "the model setup including the presolve is still performed."
+            << std::endl;
         std::cout  //
             << "  --minimization (or --minimize, --min): Minimize the "
                "objective function value regardless of the settings in the "
@@ -263,6 +273,9 @@ struct Argparser {
             } else if (args[i] == "--export-json-instance") {
                 this->export_json_instance = true;
                 i++;
+            } else if (args[i] == "--export-snapshot") {
+                this->export_snapshot = true;
+                i++;
             } else if (args[i] == "--minimization" || args[i] == "--minimize" ||
                        args[i] == "--min") {
                 this->is_minimization_explicit = true;
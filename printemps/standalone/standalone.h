@@ -101,8 +101,25 @@ class Standalone {
             m_argparser.instance_file_name);
 
         if (EXTENSION == "mps") {
-            m_mps.read_mps(m_argparser.instance_file_name);
+            int number_of_threads = 1;
+#ifdef _OPENMP
+            number_of_threads = m_argparser.is_specified_number_of_threads
+                                    ? m_argparser.number_of_threads
+                                    : omp_get_max_threads();
+#endif
+            m_mps.read_mps(m_argparser.instance_file_name, true,
+                           number_of_threads);
             m_model.import_mps(m_mps, m_argparser.accept_continuous_variables);
+            if (m_argparser.export_snapshot) {
+                mps::MPSSnapshot::write(
+                    m_mps, printemps::utility::base_name(
+                               m_argparser.instance_file_name) +
+                               ".snapshot");
+            }
+        } else if (EXTENSION == "snapshot") {
+            const mps::MPSSnapshot SNAPSHOT(m_argparser.instance_file_name);
+            m_model.import_mps_snapshot(
+                SNAPSHOT, m_argparser.accept_continuous_variables);
         } else if (EXTENSION == "opb" || EXTENSION == "wbo") {
             m_opb.read_opb(m_argparser.instance_file_name);
             m_model.import_opb(m_opb);
@@ -9,6 +9,8 @@
 #include <array>
 #include <algorithm>
 #include <any>
+#include <atomic>
+#include <bitset>
 #include <charconv>
 #include <cctype>
 #include <chrono>
@@ -16,6 +18,7 @@
 #include <csignal>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <deque>
 #include <fstream>
@@ -23,6 +26,7 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -33,6 +37,7 @@
 #include <string_view>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
@@ -42,6 +47,13 @@
 #include <omp.h>
 #endif
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #endif
 /*****************************************************************************/
 // END
@@ -0,0 +1,139 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_BITSET_H__
+#define PRINTEMPS_UTILITY_BITSET_H__
+
+namespace printemps::utility {
+/*****************************************************************************/
+class Bitset {
+    /**
+     * This class provides a dynamically sized bitset packed into 64-bit
+     * words. The bits beyond the size in the last word are kept zero so that
+     * the word-wide operations can be applied without masking. Concurrent
+     * writes to the bits in the same word are not thread-safe.
+     */
+   private:
+    std::vector<std::uint64_t> m_words;
+    int                        m_size;
+
+   public:
+    /*************************************************************************/
+    Bitset(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    Bitset(const int a_SIZE) {
+        this->setup(a_SIZE);
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline void setup(const int a_SIZE) {
+        m_words.assign((a_SIZE + 63) / 64, 0);
+        m_size = a_SIZE;
+    }
+
+    /*************************************************************************/
+    inline int size(void) const noexcept {
+        return m_size;
+    }
+
+    /*************************************************************************/
+    inline int number_of_words(void) const noexcept {
+        return m_words.size();
+    }
+
+    /*************************************************************************/
+    inline const std::vector<std::uint64_t> &words(void) const noexcept {
+        return m_words;
+    }
+
+    /*************************************************************************/
+    inline bool test(const int a_INDEX) const noexcept {
+        return (m_words[a_INDEX >> 6] >> (a_INDEX & 63)) & 1;
+    }
+
+    /*************************************************************************/
+    inline void set(const int a_INDEX) noexcept {
+        m_words[a_INDEX >> 6] |= std::uint64_t(1) << (a_INDEX & 63);
+    }
+
+    /*************************************************************************/
+    inline void set(const int a_INDEX, const bool a_VALUE) noexcept {
+        const std::uint64_t MASK = std::uint64_t(1) << (a_INDEX & 63);
+        auto               &word = m_words[a_INDEX >> 6];
+        word = (word & ~MASK) | (-static_cast<std::uint64_t>(a_VALUE) & MASK);
+    }
+
+    /*************************************************************************/
+    inline void reset(const int a_INDEX) noexcept {
+        m_words[a_INDEX >> 6] &= ~(std::uint64_t(1) << (a_INDEX & 63));
+    }
+
+    /*************************************************************************/
+    inline void reset(void) noexcept {
+        std::fill(m_words.begin(), m_words.end(), 0);
+    }
+
+    /*************************************************************************/
+    inline int count(void) const noexcept {
+        int count = 0;
+        for (const auto &word : m_words) {
+            count += std::bitset<64>(word).count();
+        }
+        return count;
+    }
+
+    /*************************************************************************/
+    inline bool any(void) const noexcept {
+        for (const auto &word : m_words) {
+            if (word) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*************************************************************************/
+    inline bool none(void) const noexcept {
+        return !this->any();
+    }
+
+    /*************************************************************************/
+    inline static int lowest_set_bit_index(
+        const std::uint64_t a_WORD) noexcept {
+        /**
+         * NOTE: The argument must not be zero.
+         */
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(a_WORD);
+#else
+        return std::bitset<64>((a_WORD & (~a_WORD + 1)) - 1).count();
+#endif
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline static void for_each_set_bit(std::uint64_t      a_word,
+                                        const int          a_OFFSET,
+                                        const T_Function &a_FUNCTION) {
+        while (a_word) {
+            a_FUNCTION(a_OFFSET + lowest_set_bit_index(a_word));
+            a_word &= a_word - 1;
+        }
+    }
+};
+}  // namespace printemps::utility
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -670,22 +670,6 @@ inline JsonArray parse_json_array(const std::string& a_ARG) {
     return parse_json_array(TOKENS);
 }
 
-/*****************************************************************************/
-inline void write_json_object(const JsonObject&  a_OBJECT,
-                              const std::string& a_FILE_NAME) {
-    std::ofstream ofs(a_FILE_NAME);
-    ofs << a_OBJECT;
-    ofs.close();
-}
-
-/*****************************************************************************/
-inline void write_json_array(const JsonArray&   a_ARRAY,
-                             const std::string& a_FILE_NAME) {
-    std::ofstream ofs(a_FILE_NAME);
-    ofs << a_ARRAY;
-    ofs.close();
-}
-
 /*****************************************************************************/
 inline JsonObject read_json_object(const std::string& a_FILE_NAME) {
     std::string   str;
@@ -0,0 +1,563 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_JSON_JSON_PARSER_H__
+#define PRINTEMPS_UTILITY_JSON_JSON_PARSER_H__
+
+namespace printemps::utility::json {
+/*****************************************************************************/
+enum class JsonValueType {
+    Null,
+    Boolean,
+    Integer,
+    Double,
+    String,
+    Object,
+    Array
+};
+
+/*****************************************************************************/
+struct JsonValue {
+    /**
+     * A typed JSON node. Strings and keys are views into the text buffer of
+     * the owning JsonDocument, and the elements of objects and arrays are
+     * stored contiguously in its arena. Members of an object keep their
+     * order in the input.
+     */
+    JsonValueType    type;
+    std::string_view key;
+
+    union {
+        bool   boolean;
+        long   integer;
+        double floating_point;
+    };
+
+    std::string_view string;
+    const JsonValue *elements;
+    std::size_t      size;
+
+    /*************************************************************************/
+    JsonValue(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->type     = JsonValueType::Null;
+        this->key      = std::string_view();
+        this->integer  = 0;
+        this->string   = std::string_view();
+        this->elements = nullptr;
+        this->size     = 0;
+    }
+
+    /*************************************************************************/
+    inline bool is_null(void) const {
+        return this->type == JsonValueType::Null;
+    }
+
+    /*************************************************************************/
+    inline bool is_boolean(void) const {
+        return this->type == JsonValueType::Boolean;
+    }
+
+    /*************************************************************************/
+    inline bool is_integer(void) const {
+        return this->type == JsonValueType::Integer;
+    }
+
+    /*************************************************************************/
+    inline bool is_number(void) const {
+        return this->type == JsonValueType::Integer ||
+               this->type == JsonValueType::Double;
+    }
+
+    /*************************************************************************/
+    inline bool is_string(void) const {
+        return this->type == JsonValueType::String;
+    }
+
+    /*************************************************************************/
+    inline bool is_object(void) const {
+        return this->type == JsonValueType::Object;
+    }
+
+    /*************************************************************************/
+    inline bool is_array(void) const {
+        return this->type == JsonValueType::Array;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue *begin(void) const {
+        return this->elements;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue *end(void) const {
+        return this->elements + this->size;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue &operator[](const std::size_t a_INDEX) const {
+        return this->elements[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline const JsonValue *find_member(const std::string_view a_KEY) const {
+        if (this->type != JsonValueType::Object) {
+            return nullptr;
+        }
+        for (std::size_t i = 0; i < this->size; i++) {
+            if (this->elements[i].key == a_KEY) {
+                return &this->elements[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /*************************************************************************/
+    inline bool find(const std::string_view a_KEY) const {
+        return this->find_member(a_KEY) != nullptr;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue &at(const std::string_view a_KEY) const {
+        const auto MEMBER_PTR = this->find_member(a_KEY);
+        if (MEMBER_PTR == nullptr) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The key " + std::string(a_KEY) + " is not found."));
+        }
+        return *MEMBER_PTR;
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline T as(void) const {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (this->type == JsonValueType::Boolean) {
+                return this->boolean;
+            }
+        } else if constexpr (std::is_integral_v<T>) {
+            if (this->type == JsonValueType::Integer) {
+                return static_cast<T>(this->integer);
+            }
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (this->type == JsonValueType::Integer) {
+                return static_cast<T>(this->integer);
+            }
+            if (this->type == JsonValueType::Double) {
+                return static_cast<T>(this->floating_point);
+            }
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (this->type == JsonValueType::String) {
+                return std::string(this->string);
+            }
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            if (this->type == JsonValueType::String) {
+                return this->string;
+            }
+        }
+        throw std::runtime_error(utility::format_error_location(
+            __FILE__, __LINE__, __func__,
+            "The type of " + std::string(this->key) + " is wrong."));
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline T get(const std::string_view a_KEY) const {
+        return this->at(a_KEY).template as<T>();
+    }
+};
+
+/*****************************************************************************/
+class JsonArena {
+    /**
+     * This class is a bump allocator for JsonValue arrays. Memory is taken
+     * from fixed-size blocks and released all at once with the arena, so
+     * parsing does not call the global allocator per node.
+     */
+   private:
+    static constexpr std::size_t BLOCK_SIZE = 4096;
+
+    std::vector<std::unique_ptr<JsonValue[]>> m_blocks;
+    std::size_t                               m_position;
+    std::size_t                               m_capacity;
+
+   public:
+    /*************************************************************************/
+    JsonArena(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    JsonArena(const JsonArena &) = delete;
+    JsonArena &operator=(const JsonArena &) = delete;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_blocks.clear();
+        m_position = 0;
+        m_capacity = 0;
+    }
+
+    /*************************************************************************/
+    inline JsonValue *allocate(const std::size_t a_SIZE) {
+        if (a_SIZE == 0) {
+            return nullptr;
+        }
+        if (m_position + a_SIZE > m_capacity) {
+            const std::size_t CAPACITY = std::max(BLOCK_SIZE, a_SIZE);
+            m_blocks.emplace_back(new JsonValue[CAPACITY]);
+            m_position = 0;
+            m_capacity = CAPACITY;
+        }
+        JsonValue *result = m_blocks.back().get() + m_position;
+        m_position += a_SIZE;
+        return result;
+    }
+};
+
+/*****************************************************************************/
+class JsonDocument {
+    /**
+     * This class parses a JSON text in a single pass. The text is kept in the
+     * document and strings are unescaped in place, so string nodes do not own
+     * any memory. Elements of an open object or array are collected on a
+     * shared stack and moved into the arena when it is closed.
+     */
+   private:
+    std::string            m_text;
+    JsonArena              m_arena;
+    JsonValue              m_root;
+    std::vector<JsonValue> m_stack;
+
+    char *      m_cursor;
+    const char *m_end;
+
+    /*************************************************************************/
+    [[noreturn]] inline void throw_parse_error(const std::string &a_MESSAGE) {
+        const std::size_t POSITION = m_cursor - m_text.data();
+        throw std::runtime_error(utility::format_error_location(
+            __FILE__, __LINE__, __func__,
+            a_MESSAGE + " (at " + std::to_string(POSITION) + ")"));
+    }
+
+    /*************************************************************************/
+    inline void skip_spaces(void) {
+        while (m_cursor < m_end && (*m_cursor == ' ' || *m_cursor == '\n' ||
+                                    *m_cursor == '\r' || *m_cursor == '\t')) {
+            m_cursor++;
+        }
+    }
+
+    /*************************************************************************/
+    inline bool consume(const char a_CHAR) {
+        this->skip_spaces();
+        if (m_cursor < m_end && *m_cursor == a_CHAR) {
+            m_cursor++;
+            return true;
+        }
+        return false;
+    }
+
+    /*************************************************************************/
+    inline void expect(const char a_CHAR) {
+        if (!this->consume(a_CHAR)) {
+            this->throw_parse_error(std::string("'") + a_CHAR +
+                                    "' is expected.");
+        }
+    }
+
+    /*************************************************************************/
+    inline void expect_literal(const char *a_LITERAL) {
+        const std::size_t LENGTH = std::strlen(a_LITERAL);
+        if (static_cast<std::size_t>(m_end - m_cursor) < LENGTH ||
+            std::strncmp(m_cursor, a_LITERAL, LENGTH) != 0) {
+            this->throw_parse_error("Invalid literal.");
+        }
+        m_cursor += LENGTH;
+    }
+
+    /*************************************************************************/
+    inline std::string_view parse_string(void) {
+        /**
+         * The cursor is at the opening quotation. Escape sequences are decoded
+         * by writing back into the same buffer, which never grows the string.
+         */
+        m_cursor++;
+        char *begin  = m_cursor;
+        char *output = m_cursor;
+        while (m_cursor < m_end && *m_cursor != '\"') {
+            if (*m_cursor != '\\') {
+                *output++ = *m_cursor++;
+                continue;
+            }
+            m_cursor++;
+            if (m_cursor >= m_end) {
+                break;
+            }
+            switch (*m_cursor) {
+                case 'n': {
+                    *output++ = '\n';
+                    break;
+                }
+                case 'r': {
+                    *output++ = '\r';
+                    break;
+                }
+                case 't': {
+                    *output++ = '\t';
+                    break;
+                }
+                case 'b': {
+                    *output++ = '\b';
+                    break;
+                }
+                case 'f': {
+                    *output++ = '\f';
+                    break;
+                }
+                case 'u': {
+                    /**
+                     * Only code points in the ASCII range are decoded;
+                     * others are replaced with '?'.
+                     */
+                    if (m_end - m_cursor < 5) {
+                        this->throw_parse_error("Invalid escape sequence.");
+                    }
+                    unsigned int code_point = 0;
+                    std::from_chars(m_cursor + 1, m_cursor + 5, code_point, 16);
+                    *output++ =
+                        code_point < 0x80 ? static_cast<char>(code_point) : '?';
+                    m_cursor += 4;
+                    break;
+                }
+                default: {
+                    *output++ = *m_cursor;
+                }
+            }
+            m_cursor++;
+        }
+        if (m_cursor >= m_end) {
+            this->throw_parse_error("Unterminated string.");
+        }
+        m_cursor++;
+        return std::string_view(begin, output - begin);
+    }
+
+    /*************************************************************************/
+    inline void parse_number(JsonValue *a_value_ptr) {
+        const char *begin      = m_cursor;
+        bool        is_integer = true;
+        if (m_cursor < m_end && (*m_cursor == '-' || *m_cursor == '+')) {
+            m_cursor++;
+        }
+
+        /**
+         * The non-finite values written by JsonWriter, i.e., nan, -nan, inf,
+         * and -inf, are accepted as well, although they are not valid JSON,
+         * so that the output files of the solver can be read back.
+         */
+        if (m_cursor < m_end && (*m_cursor == 'n' || *m_cursor == 'i')) {
+            while (m_cursor < m_end &&
+                   std::isalpha(static_cast<unsigned char>(*m_cursor))) {
+                m_cursor++;
+            }
+            is_integer = false;
+        }
+        while (m_cursor < m_end) {
+            const char c = *m_cursor;
+            if (c >= '0' && c <= '9') {
+                m_cursor++;
+            } else if (c == '.' || c == 'e' || c == 'E' || c == '-' ||
+                       c == '+') {
+                is_integer = false;
+                m_cursor++;
+            } else {
+                break;
+            }
+        }
+
+        /**
+         * std::from_chars() does not accept a leading '+'.
+         */
+        const char *first = (*begin == '+') ? begin + 1 : begin;
+
+        if (is_integer) {
+            long value  = 0;
+            auto result = std::from_chars(first, m_cursor, value);
+            if (result.ec == std::errc() && result.ptr == m_cursor) {
+                a_value_ptr->type    = JsonValueType::Integer;
+                a_value_ptr->integer = value;
+                return;
+            }
+        }
+
+        double value  = 0.0;
+        auto   result = std::from_chars(first, m_cursor, value);
+        if (result.ec != std::errc() || result.ptr != m_cursor) {
+            this->throw_parse_error("Invalid number.");
+        }
+        a_value_ptr->type           = JsonValueType::Double;
+        a_value_ptr->floating_point = value;
+    }
+
+    /*************************************************************************/
+    inline void close_container(JsonValue *       a_value_ptr,
+                                const std::size_t a_STACK_BEGIN) {
+        const std::size_t SIZE     = m_stack.size() - a_STACK_BEGIN;
+        JsonValue *       elements = m_arena.allocate(SIZE);
+        std::copy(m_stack.begin() + a_STACK_BEGIN, m_stack.end(), elements);
+        m_stack.resize(a_STACK_BEGIN);
+        a_value_ptr->elements = elements;
+        a_value_ptr->size     = SIZE;
+    }
+
+    /*************************************************************************/
+    inline void parse_value(JsonValue *a_value_ptr) {
+        this->skip_spaces();
+        if (m_cursor >= m_end) {
+            this->throw_parse_error("Unexpected end of input.");
+        }
+
+        switch (*m_cursor) {
+            case '{': {
+                m_cursor++;
+                a_value_ptr->type             = JsonValueType::Object;
+                const std::size_t STACK_BEGIN = m_stack.size();
+                if (!this->consume('}')) {
+                    do {
+                        this->skip_spaces();
+                        if (m_cursor >= m_end || *m_cursor != '\"') {
+                            this->throw_parse_error("A key is expected.");
+                        }
+                        JsonValue member;
+                        member.key = this->parse_string();
+                        this->expect(':');
+                        this->parse_value(&member);
+                        m_stack.push_back(member);
+                    } while (this->consume(','));
+                    this->expect('}');
+                }
+                this->close_container(a_value_ptr, STACK_BEGIN);
+                break;
+            }
+            case '[': {
+                m_cursor++;
+                a_value_ptr->type             = JsonValueType::Array;
+                const std::size_t STACK_BEGIN = m_stack.size();
+                if (!this->consume(']')) {
+                    do {
+                        JsonValue element;
+                        this->parse_value(&element);
+                        m_stack.push_back(element);
+                    } while (this->consume(','));
+                    this->expect(']');
+                }
+                this->close_container(a_value_ptr, STACK_BEGIN);
+                break;
+            }
+            case '\"': {
+                a_value_ptr->type   = JsonValueType::String;
+                a_value_ptr->string = this->parse_string();
+                break;
+            }
+            case 't': {
+                this->expect_literal("true");
+                a_value_ptr->type    = JsonValueType::Boolean;
+                a_value_ptr->boolean = true;
+                break;
+            }
+            case 'f': {
+                this->expect_literal("false");
+                a_value_ptr->type    = JsonValueType::Boolean;
+                a_value_ptr->boolean = false;
+                break;
+            }
+            case 'n': {
+                if (m_end - m_cursor >= 3 &&
+                    std::strncmp(m_cursor, "nan", 3) == 0) {
+                    this->parse_number(a_value_ptr);
+                    break;
+                }
+                this->expect_literal("null");
+                a_value_ptr->type = JsonValueType::Null;
+                break;
+            }
+            default: {
+                this->parse_number(a_value_ptr);
+            }
+        }
+    }
+
+   public:
+    /*************************************************************************/
+    JsonDocument(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    JsonDocument(const JsonDocument &) = delete;
+    JsonDocument &operator=(const JsonDocument &) = delete;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_text.clear();
+        m_arena.initialize();
+        m_root.initialize();
+        m_stack.clear();
+        m_cursor = nullptr;
+        m_end    = nullptr;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue &parse(std::string a_TEXT) {
+        this->initialize();
+        m_text   = std::move(a_TEXT);
+        m_cursor = m_text.data();
+        m_end    = m_text.data() + m_text.size();
+
+        this->parse_value(&m_root);
+        this->skip_spaces();
+        if (m_cursor != m_end) {
+            this->throw_parse_error("Unexpected trailing characters.");
+        }
+
+        m_stack.clear();
+        m_stack.shrink_to_fit();
+        return m_root;
+    }
+
+    /*************************************************************************/
+    inline const JsonValue &read(const std::string &a_FILE_NAME) {
+        std::ifstream ifs(a_FILE_NAME, std::ios::binary);
+        if (ifs.fail()) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Cannot open the specified file: " + a_FILE_NAME));
+        }
+
+        std::string text;
+        ifs.seekg(0, std::ios::end);
+        text.resize(static_cast<std::size_t>(ifs.tellg()));
+        ifs.seekg(0, std::ios::beg);
+        ifs.read(text.data(), text.size());
+        ifs.close();
+
+        return this->parse(std::move(text));
+    }
+
+    /*************************************************************************/
+    inline const JsonValue &root(void) const {
+        return m_root;
+    }
+};
+}  // namespace printemps::utility::json
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,376 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_JSON_JSON_WRITER_H__
+#define PRINTEMPS_UTILITY_JSON_JSON_WRITER_H__
+
+namespace printemps::utility::json {
+/*****************************************************************************/
+class JsonWriter {
+    /**
+     * This class writes JSON text to a stream event by event, without building
+     * JsonObject/JsonArray trees. Numbers are formatted with std::to_chars
+     * into an internal buffer which is flushed to the stream when it is full,
+     * so the extra memory does not depend on the size of the output. The
+     * layout (indentation, separators, and scientific notation of floating
+     * point numbers) is identical to that of operator<< for JsonObject.
+     */
+   private:
+    static constexpr std::size_t BUFFER_CAPACITY = 1 << 16;
+
+    std::ostream *    m_os_ptr;
+    std::vector<char> m_buffer;
+    std::size_t       m_buffer_size;
+
+    /// The number of elements written in each open object/array.
+    std::vector<long> m_element_counts;
+    bool              m_is_after_key;
+
+    /*************************************************************************/
+    inline void put(const char a_CHAR) {
+        if (m_buffer_size == BUFFER_CAPACITY) {
+            this->flush();
+        }
+        m_buffer[m_buffer_size++] = a_CHAR;
+    }
+
+    /*************************************************************************/
+    inline void put(const char *a_DATA, const std::size_t a_SIZE) {
+        if (m_buffer_size + a_SIZE > BUFFER_CAPACITY) {
+            this->flush();
+            if (a_SIZE > BUFFER_CAPACITY) {
+                m_os_ptr->write(a_DATA, a_SIZE);
+                return;
+            }
+        }
+        std::memcpy(m_buffer.data() + m_buffer_size, a_DATA, a_SIZE);
+        m_buffer_size += a_SIZE;
+    }
+
+    /*************************************************************************/
+    inline void put(const std::string_view a_STRING) {
+        this->put(a_STRING.data(), a_STRING.size());
+    }
+
+    /*************************************************************************/
+    inline void put_indent(const std::size_t a_INDENT_LEVEL) {
+        for (std::size_t i = 0; i < a_INDENT_LEVEL; i++) {
+            this->put("    ", 4);
+        }
+    }
+
+    /*************************************************************************/
+    inline void put_quoted(const std::string_view a_STRING) {
+        this->put('\"');
+        for (const auto c : a_STRING) {
+            switch (c) {
+                case '\"': {
+                    this->put("\\\"", 2);
+                    break;
+                }
+                case '\\': {
+                    this->put("\\\\", 2);
+                    break;
+                }
+                case '\n': {
+                    this->put("\\n", 2);
+                    break;
+                }
+                case '\r': {
+                    this->put("\\r", 2);
+                    break;
+                }
+                case '\t': {
+                    this->put("\\t", 2);
+                    break;
+                }
+                default: {
+                    this->put(c);
+                }
+            }
+        }
+        this->put('\"');
+    }
+
+    /*************************************************************************/
+    inline void begin_element(void) {
+        if (m_element_counts.empty()) {
+            return;
+        }
+        if (m_element_counts.back() == 0) {
+            this->put(" \n", 2);
+        } else {
+            this->put(", \n", 3);
+        }
+        m_element_counts.back()++;
+        this->put_indent(m_element_counts.size());
+    }
+
+    /*************************************************************************/
+    inline void begin_value(void) {
+        if (m_is_after_key) {
+            m_is_after_key = false;
+            return;
+        }
+        this->begin_element();
+    }
+
+    /*************************************************************************/
+    inline void end_container(const char a_CLOSE) {
+        const long COUNT = m_element_counts.back();
+        m_element_counts.pop_back();
+        if (COUNT > 0) {
+            this->put('\n');
+            this->put_indent(m_element_counts.size());
+        }
+        this->put(a_CLOSE);
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline void put_integer(const T a_VALUE) {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), a_VALUE);
+        this->put(buffer, result.ptr - buffer);
+    }
+
+    /*************************************************************************/
+    inline void put_floating_point(const double a_VALUE) {
+        if (std::isnan(a_VALUE)) {
+            this->put(std::signbit(a_VALUE) ? "-nan" : "nan");
+            return;
+        }
+        if (std::isinf(a_VALUE)) {
+            this->put(a_VALUE > 0 ? "inf" : "-inf");
+            return;
+        }
+        char buffer[64];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), a_VALUE,
+                                    std::chars_format::scientific, 6);
+        this->put(buffer, result.ptr - buffer);
+    }
+
+   public:
+    /*************************************************************************/
+    JsonWriter(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    JsonWriter(std::ostream *a_os_ptr) {
+        this->initialize();
+        this->setup(a_os_ptr);
+    }
+
+    /*************************************************************************/
+    ~JsonWriter(void) {
+        this->flush();
+    }
+
+    /*************************************************************************/
+    JsonWriter(const JsonWriter &) = delete;
+    JsonWriter &operator=(const JsonWriter &) = delete;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_os_ptr      = nullptr;
+        m_buffer_size = 0;
+        m_element_counts.clear();
+        m_is_after_key = false;
+    }
+
+    /*************************************************************************/
+    inline void setup(std::ostream *a_os_ptr) {
+        m_os_ptr = a_os_ptr;
+        m_buffer.resize(BUFFER_CAPACITY);
+    }
+
+    /*************************************************************************/
+    inline void flush(void) {
+        if (m_os_ptr != nullptr && m_buffer_size > 0) {
+            m_os_ptr->write(m_buffer.data(), m_buffer_size);
+        }
+        m_buffer_size = 0;
+    }
+
+    /*************************************************************************/
+    inline void begin_object(void) {
+        this->begin_value();
+        this->put('{');
+        m_element_counts.push_back(0);
+    }
+
+    /*************************************************************************/
+    inline void end_object(void) {
+        this->end_container('}');
+    }
+
+    /*************************************************************************/
+    inline void begin_array(void) {
+        this->begin_value();
+        this->put('[');
+        m_element_counts.push_back(0);
+    }
+
+    /*************************************************************************/
+    inline void end_array(void) {
+        this->end_container(']');
+    }
+
+    /*************************************************************************/
+    inline void key(const std::string_view a_KEY) {
+        this->begin_element();
+        this->put_quoted(a_KEY);
+        this->put(": ", 2);
+        m_is_after_key = true;
+    }
+
+    /*************************************************************************/
+    inline void value(std::nullptr_t) {
+        this->begin_value();
+        this->put("null", 4);
+    }
+
+    /*************************************************************************/
+    inline void value(const bool a_VALUE) {
+        this->begin_value();
+        if (a_VALUE) {
+            this->put("true", 4);
+        } else {
+            this->put("false", 5);
+        }
+    }
+
+    /*************************************************************************/
+    inline void value(const std::string_view a_VALUE) {
+        this->begin_value();
+        this->put_quoted(a_VALUE);
+    }
+
+    /*************************************************************************/
+    inline void value(const std::string &a_VALUE) {
+        this->value(std::string_view(a_VALUE));
+    }
+
+    /*************************************************************************/
+    inline void value(const char *a_VALUE) {
+        this->value(std::string_view(a_VALUE));
+    }
+
+    /*************************************************************************/
+    template <class T,
+              std::enable_if_t<std::is_integral_v<T> &&
+                                   !std::is_same_v<T, bool>,
+                               std::nullptr_t> = nullptr>
+    inline void value(const T a_VALUE) {
+        this->begin_value();
+        this->put_integer(a_VALUE);
+    }
+
+    /*************************************************************************/
+    template <class T, std::enable_if_t<std::is_floating_point_v<T>,
+                                        std::nullptr_t> = nullptr>
+    inline void value(const T a_VALUE) {
+        this->begin_value();
+        this->put_floating_point(static_cast<double>(a_VALUE));
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline void member(const std::string_view a_KEY, const T &a_VALUE) {
+        this->key(a_KEY);
+        this->value(a_VALUE);
+    }
+
+    /*************************************************************************/
+    inline void value(const JsonObject &a_OBJECT);
+
+    /*************************************************************************/
+    inline void value(const JsonArray &a_ARRAY);
+
+    /*************************************************************************/
+    inline void value(const std::any &a_VALUE) {
+        if (a_VALUE.type() == typeid(short)) {
+            this->value(std::any_cast<short>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(unsigned short)) {
+            this->value(std::any_cast<unsigned short>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(int)) {
+            this->value(std::any_cast<int>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(unsigned int)) {
+            this->value(std::any_cast<unsigned int>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(long)) {
+            this->value(std::any_cast<long>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(unsigned long)) {
+            this->value(std::any_cast<unsigned long>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(long long)) {
+            this->value(std::any_cast<long long>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(unsigned long long)) {
+            this->value(std::any_cast<unsigned long long>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(float)) {
+            this->value(std::any_cast<float>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(double)) {
+            this->value(std::any_cast<double>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(long double)) {
+            this->value(std::any_cast<long double>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(bool)) {
+            this->value(std::any_cast<bool>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(std::string)) {
+            this->value(std::any_cast<const std::string &>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(const char *)) {
+            this->value(std::any_cast<const char *>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(JsonObject)) {
+            this->value(std::any_cast<const JsonObject &>(a_VALUE));
+        } else if (a_VALUE.type() == typeid(JsonArray)) {
+            this->value(std::any_cast<const JsonArray &>(a_VALUE));
+        } else {
+            /**
+             * Write void, nullptr, and other type elements as "null".
+             */
+            this->value(nullptr);
+        }
+    }
+};
+
+/*****************************************************************************/
+inline void JsonWriter::value(const JsonObject &a_OBJECT) {
+    this->begin_object();
+    for (const auto &element : a_OBJECT.body) {
+        this->key(element.first);
+        this->value(element.second);
+    }
+    this->end_object();
+}
+
+/*****************************************************************************/
+inline void JsonWriter::value(const JsonArray &a_ARRAY) {
+    this->begin_array();
+    for (const auto &element : a_ARRAY.body) {
+        this->value(element);
+    }
+    this->end_array();
+}
+
+/*****************************************************************************/
+inline void write_json_object(const JsonObject & a_OBJECT,
+                              const std::string &a_FILE_NAME) {
+    std::ofstream ofs(a_FILE_NAME);
+    JsonWriter    writer(&ofs);
+    writer.value(a_OBJECT);
+    writer.flush();
+}
+
+/*****************************************************************************/
+inline void write_json_array(const JsonArray &  a_ARRAY,
+                             const std::string &a_FILE_NAME) {
+    std::ofstream ofs(a_FILE_NAME);
+    JsonWriter    writer(&ofs);
+    writer.value(a_ARRAY);
+    writer.flush();
+}
+}  // namespace printemps::utility::json
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
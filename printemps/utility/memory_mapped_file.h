@@ -0,0 +1,128 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_MEMORY_MAPPED_FILE_H__
+#define PRINTEMPS_UTILITY_MEMORY_MAPPED_FILE_H__
+
+namespace printemps::utility {
+/*****************************************************************************/
+class MemoryMappedFile {
+    /**
+     * This class maps a whole file into memory as read-only. On platforms
+     * without mmap, the file is read into a buffer instead. This class is not
+     * copyable since it owns the mapping.
+     */
+   private:
+    const char *m_data;
+    std::size_t m_size;
+    bool        m_is_mapped;
+
+    std::unique_ptr<char[]> m_buffer;
+
+   public:
+    /*************************************************************************/
+    MemoryMappedFile(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    MemoryMappedFile(const std::string &a_FILE_NAME) {
+        this->initialize();
+        this->open(a_FILE_NAME);
+    }
+
+    /*************************************************************************/
+    ~MemoryMappedFile(void) {
+        this->close();
+    }
+
+    /*************************************************************************/
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_data      = nullptr;
+        m_size      = 0;
+        m_is_mapped = false;
+        m_buffer.reset();
+    }
+
+    /*************************************************************************/
+    inline void open(const std::string &a_FILE_NAME) {
+        this->close();
+#ifndef _WIN32
+        const int FILE_DESCRIPTOR = ::open(a_FILE_NAME.c_str(), O_RDONLY);
+        if (FILE_DESCRIPTOR < 0) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Cannot open the specified file: " + a_FILE_NAME));
+        }
+
+        struct stat file_status;
+        if (::fstat(FILE_DESCRIPTOR, &file_status) < 0) {
+            ::close(FILE_DESCRIPTOR);
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Cannot get the size of the specified file: " + a_FILE_NAME));
+        }
+
+        m_size = static_cast<std::size_t>(file_status.st_size);
+        if (m_size > 0) {
+            void *address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE,
+                                   FILE_DESCRIPTOR, 0);
+            if (address == MAP_FAILED) {
+                ::close(FILE_DESCRIPTOR);
+                m_size = 0;
+                throw std::runtime_error(utility::format_error_location(
+                    __FILE__, __LINE__, __func__,
+                    "Cannot map the specified file: " + a_FILE_NAME));
+            }
+            m_data      = static_cast<const char *>(address);
+            m_is_mapped = true;
+        }
+        ::close(FILE_DESCRIPTOR);
+#else
+        std::ifstream ifs(a_FILE_NAME, std::ios::binary | std::ios::in);
+        if (!ifs) {
+            throw std::runtime_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Cannot open the specified file: " + a_FILE_NAME));
+        }
+        ifs.seekg(0, std::ios::end);
+        m_size = static_cast<std::size_t>(ifs.tellg());
+        ifs.seekg(0, std::ios::beg);
+
+        m_buffer = std::make_unique<char[]>(m_size);
+        ifs.read(m_buffer.get(), m_size);
+        m_data = m_buffer.get();
+#endif
+    }
+
+    /*************************************************************************/
+    inline void close(void) {
+#ifndef _WIN32
+        if (m_is_mapped) {
+            ::munmap(const_cast<char *>(m_data), m_size);
+        }
+#endif
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline const char *data(void) const noexcept {
+        return m_data;
+    }
+
+    /*************************************************************************/
+    inline std::size_t size(void) const noexcept {
+        return m_size;
+    }
+};
+}  // namespace printemps::utility
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
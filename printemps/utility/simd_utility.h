@@ -0,0 +1,77 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_SIMD_UTILITY_H__
+#define PRINTEMPS_UTILITY_SIMD_UTILITY_H__
+
+/**
+ * The SIMD kernels are compiled with function-level target attributes and
+ * selected at runtime, so that the library does not require any special
+ * compiler flags. They can be disabled by defining
+ * _PRINTEMPS_DISABLE_SIMD.
+ */
+#if !defined(_PRINTEMPS_DISABLE_SIMD) && defined(__GNUC__) && \
+    defined(__x86_64__)
+#define _PRINTEMPS_ENABLE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace printemps::utility::simd {
+/*****************************************************************************/
+enum class InstructionSet {
+    Scalar,
+    AVX2,
+    AVX512
+};
+
+/*****************************************************************************/
+inline InstructionSet detect_instruction_set(void) {
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+    static const InstructionSet INSTRUCTION_SET = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return InstructionSet::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return InstructionSet::AVX2;
+        }
+        return InstructionSet::Scalar;
+    }();
+    return INSTRUCTION_SET;
+#else
+    return InstructionSet::Scalar;
+#endif
+}
+
+/*****************************************************************************/
+inline bool is_supported(const InstructionSet a_INSTRUCTION_SET) {
+    return static_cast<int>(a_INSTRUCTION_SET) <=
+           static_cast<int>(detect_instruction_set());
+}
+
+/*****************************************************************************/
+inline std::string instruction_set_label(
+    const InstructionSet a_INSTRUCTION_SET) {
+    switch (a_INSTRUCTION_SET) {
+        case InstructionSet::Scalar: {
+            return "Scalar";
+        }
+        case InstructionSet::AVX2: {
+            return "AVX2";
+        }
+        case InstructionSet::AVX512: {
+            return "AVX512";
+        }
+        default: {
+            return "Undefined";
+        }
+    }
+}
+}  // namespace printemps::utility::simd
+
+/*****************************************************************************/
+// END
+/*****************************************************************************/
+#endif
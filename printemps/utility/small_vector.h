@@ -0,0 +1,264 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_SMALL_VECTOR_H__
+#define PRINTEMPS_UTILITY_SMALL_VECTOR_H__
+
+namespace printemps::utility {
+/*****************************************************************************/
+template <class T, std::size_t N>
+class SmallVector {
+    /**
+     * This class provides a subset of the std::vector interface. Up to N
+     * elements are stored in the inline buffer without heap allocation, and
+     * the elements are moved to the heap buffer when the size exceeds N. Once
+     * the heap buffer is used, it is kept until initialize() is called so that
+     * the capacity is reused like std::vector.
+     */
+   private:
+    std::array<T, N> m_inline_buffer;
+    std::vector<T>   m_heap_buffer;
+    std::size_t      m_size;
+    bool             m_is_heap;
+
+    /*************************************************************************/
+    inline void spill(const std::size_t a_CAPACITY) {
+        m_heap_buffer.reserve(std::max(a_CAPACITY, 2 * N));
+        m_heap_buffer.assign(std::make_move_iterator(m_inline_buffer.begin()),
+                             std::make_move_iterator(m_inline_buffer.begin() +
+                                                     m_size));
+        m_is_heap = true;
+    }
+
+   public:
+    using value_type     = T;
+    using iterator       = T *;
+    using const_iterator = const T *;
+
+    /*************************************************************************/
+    SmallVector(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    SmallVector(std::initializer_list<T> a_ELEMENTS) {
+        this->initialize();
+        this->insert(this->end(), a_ELEMENTS.begin(), a_ELEMENTS.end());
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_heap_buffer.clear();
+        m_heap_buffer.shrink_to_fit();
+        m_size    = 0;
+        m_is_heap = false;
+    }
+
+    /*************************************************************************/
+    inline T *data(void) noexcept {
+        return m_is_heap ? m_heap_buffer.data() : m_inline_buffer.data();
+    }
+
+    /*************************************************************************/
+    inline const T *data(void) const noexcept {
+        return m_is_heap ? m_heap_buffer.data() : m_inline_buffer.data();
+    }
+
+    /*************************************************************************/
+    inline iterator begin(void) noexcept {
+        return this->data();
+    }
+
+    /*************************************************************************/
+    inline const_iterator begin(void) const noexcept {
+        return this->data();
+    }
+
+    /*************************************************************************/
+    inline iterator end(void) noexcept {
+        return this->data() + m_size;
+    }
+
+    /*************************************************************************/
+    inline const_iterator end(void) const noexcept {
+        return this->data() + m_size;
+    }
+
+    /*************************************************************************/
+    inline std::size_t size(void) const noexcept {
+        return m_size;
+    }
+
+    /*************************************************************************/
+    inline bool empty(void) const noexcept {
+        return m_size == 0;
+    }
+
+    /*************************************************************************/
+    inline std::size_t capacity(void) const noexcept {
+        return m_is_heap ? m_heap_buffer.capacity() : N;
+    }
+
+    /*************************************************************************/
+    inline bool is_inline(void) const noexcept {
+        return !m_is_heap;
+    }
+
+    /*************************************************************************/
+    inline T &operator[](const std::size_t a_INDEX) noexcept {
+        return this->data()[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline const T &operator[](const std::size_t a_INDEX) const noexcept {
+        return this->data()[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline T &front(void) noexcept {
+        return this->data()[0];
+    }
+
+    /*************************************************************************/
+    inline const T &front(void) const noexcept {
+        return this->data()[0];
+    }
+
+    /*************************************************************************/
+    inline T &back(void) noexcept {
+        return this->data()[m_size - 1];
+    }
+
+    /*************************************************************************/
+    inline const T &back(void) const noexcept {
+        return this->data()[m_size - 1];
+    }
+
+    /*************************************************************************/
+    inline void clear(void) noexcept {
+        m_heap_buffer.clear();
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline void reserve(const std::size_t a_CAPACITY) {
+        if (m_is_heap) {
+            m_heap_buffer.reserve(a_CAPACITY);
+        } else if (a_CAPACITY > N) {
+            this->spill(a_CAPACITY);
+        }
+    }
+
+    /*************************************************************************/
+    inline void resize(const std::size_t a_SIZE) {
+        if (!m_is_heap && a_SIZE <= N) {
+            for (auto i = m_size; i < a_SIZE; i++) {
+                m_inline_buffer[i] = T();
+            }
+            m_size = a_SIZE;
+            return;
+        }
+        if (!m_is_heap) {
+            this->spill(a_SIZE);
+        }
+        m_heap_buffer.resize(a_SIZE);
+        m_size = a_SIZE;
+    }
+
+    /*************************************************************************/
+    template <class... Args>
+    inline T &emplace_back(Args &&...args) {
+        if (!m_is_heap) {
+            if (m_size < N) {
+                m_inline_buffer[m_size] = T(std::forward<Args>(args)...);
+                return m_inline_buffer[m_size++];
+            }
+            this->spill(2 * N);
+        }
+        m_heap_buffer.emplace_back(std::forward<Args>(args)...);
+        m_size++;
+        return m_heap_buffer.back();
+    }
+
+    /*************************************************************************/
+    inline void push_back(const T &a_ELEMENT) {
+        this->emplace_back(a_ELEMENT);
+    }
+
+    /*************************************************************************/
+    inline void pop_back(void) {
+        if (m_is_heap) {
+            m_heap_buffer.pop_back();
+        }
+        m_size--;
+    }
+
+    /*************************************************************************/
+    template <class T_Iterator>
+    inline iterator insert(const_iterator a_POSITION, T_Iterator a_first,
+                           T_Iterator a_last) {
+        /**
+         * The elements are appended and then rotated into the position, since
+         * the buffer may be switched during the appending.
+         */
+        const std::size_t INDEX    = a_POSITION - this->begin();
+        const std::size_t OLD_SIZE = m_size;
+
+        this->reserve(m_size + std::distance(a_first, a_last));
+        for (auto it = a_first; it != a_last; it++) {
+            this->emplace_back(*it);
+        }
+        std::rotate(this->begin() + INDEX, this->begin() + OLD_SIZE,
+                    this->end());
+        return this->begin() + INDEX;
+    }
+
+    /*************************************************************************/
+    inline iterator erase(const_iterator a_first, const_iterator a_last) {
+        const std::size_t FIRST = a_first - this->begin();
+        const std::size_t LAST  = a_last - this->begin();
+
+        if (m_is_heap) {
+            m_heap_buffer.erase(m_heap_buffer.begin() + FIRST,
+                                m_heap_buffer.begin() + LAST);
+        } else {
+            std::move(m_inline_buffer.begin() + LAST,
+                      m_inline_buffer.begin() + m_size,
+                      m_inline_buffer.begin() + FIRST);
+        }
+        m_size -= LAST - FIRST;
+        return this->begin() + FIRST;
+    }
+
+    /*************************************************************************/
+    inline iterator erase(const_iterator a_POSITION) {
+        return this->erase(a_POSITION, a_POSITION + 1);
+    }
+
+    /*************************************************************************/
+    inline std::vector<T> to_vector(void) const {
+        return std::vector<T>(this->begin(), this->end());
+    }
+};
+
+/*****************************************************************************/
+template <class T, std::size_t N>
+inline bool operator==(const SmallVector<T, N> &a_FIRST,
+                       const SmallVector<T, N> &a_SECOND) {
+    return std::equal(a_FIRST.begin(), a_FIRST.end(), a_SECOND.begin(),
+                      a_SECOND.end());
+}
+
+/*****************************************************************************/
+template <class T, std::size_t N>
+inline bool operator!=(const SmallVector<T, N> &a_FIRST,
+                       const SmallVector<T, N> &a_SECOND) {
+    return !(a_FIRST == a_SECOND);
+}
+}  // namespace printemps::utility
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
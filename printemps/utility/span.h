@@ -0,0 +1,103 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_SPAN_H__
+#define PRINTEMPS_UTILITY_SPAN_H__
+
+namespace printemps::utility {
+/*****************************************************************************/
+template <class T>
+class Span {
+    /**
+     * This class provides a read-only view of contiguous elements owned by
+     * another container. The owner must outlive the span.
+     */
+   private:
+    const T    *m_data;
+    std::size_t m_size;
+
+   public:
+    using value_type     = T;
+    using iterator       = const T *;
+    using const_iterator = const T *;
+
+    /*************************************************************************/
+    Span(void) noexcept : m_data(nullptr), m_size(0) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    Span(const T *a_DATA, const std::size_t a_SIZE) noexcept
+        : m_data(a_DATA), m_size(a_SIZE) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    Span(const std::vector<T> &a_VECTOR) noexcept
+        : m_data(a_VECTOR.data()), m_size(a_VECTOR.size()) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) noexcept {
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline void clear(void) noexcept {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline const T *data(void) const noexcept {
+        return m_data;
+    }
+
+    /*************************************************************************/
+    inline const_iterator begin(void) const noexcept {
+        return m_data;
+    }
+
+    /*************************************************************************/
+    inline const_iterator end(void) const noexcept {
+        return m_data + m_size;
+    }
+
+    /*************************************************************************/
+    inline std::size_t size(void) const noexcept {
+        return m_size;
+    }
+
+    /*************************************************************************/
+    inline bool empty(void) const noexcept {
+        return m_size == 0;
+    }
+
+    /*************************************************************************/
+    inline const T &operator[](const std::size_t a_INDEX) const noexcept {
+        return m_data[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline const T &front(void) const noexcept {
+        return m_data[0];
+    }
+
+    /*************************************************************************/
+    inline const T &back(void) const noexcept {
+        return m_data[m_size - 1];
+    }
+
+    /*************************************************************************/
+    inline std::vector<T> to_vector(void) const {
+        return std::vector<T>(this->begin(), this->end());
+    }
+};
+}  // namespace printemps::utility
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -10,57 +10,66 @@ namespace printemps::utility::sparse {
 /*****************************************************************************/
 inline Vector operator+(const double a_VALUE, const Vector &a_VECTOR) {
     auto result = a_VECTOR;
-    return (result += a_VALUE);
+    result += a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator+(const Vector &a_VECTOR, const double a_VALUE) {
     auto result = a_VECTOR;
-    return (result += a_VALUE);
+    result += a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator+(const Vector &a_VECTOR_FIRST,
                         const Vector &a_VECTOR_SECOND) {
     auto result = a_VECTOR_FIRST;
-    return (result += a_VECTOR_SECOND);
+    result += a_VECTOR_SECOND;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator-(const double a_VALUE, const Vector &a_VECTOR) {
     auto result = -a_VECTOR;
-    return (result += a_VALUE);
+    result += a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator-(const Vector &a_VECTOR, const double a_VALUE) {
     auto result = a_VECTOR;
-    return (result -= a_VALUE);
+    result -= a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator-(const Vector &a_VECTOR_FIRST,
                         const Vector &a_VECTOR_SECOND) {
     auto result = a_VECTOR_FIRST;
-    return (result -= a_VECTOR_SECOND);
+    result -= a_VECTOR_SECOND;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator*(const double a_VALUE, const Vector &a_VECTOR) {
     auto result = a_VECTOR;
-    return (result *= a_VALUE);
+    result *= a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator*(const Vector &a_VECTOR, const double a_VALUE) {
     auto result = a_VECTOR;
-    return (result *= a_VALUE);
+    result *= a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
 inline Vector operator/(const Vector &a_VECTOR, const double a_VALUE) {
     auto result = a_VECTOR;
-    return (result /= a_VALUE);
+    result /= a_VALUE;
+    return result;
 }
 
 /*****************************************************************************/
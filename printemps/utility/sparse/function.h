@@ -108,21 +108,12 @@ inline void linear_combination(Vector*             a_result_ptr,
                                const Vector&       a_FIRST_VECTOR,
                                const double        a_SECOND_COEFFICIENT,
                                const Vector&       a_SECOND_VECTOR) {
-    const auto& VALUES         = a_FIRST_MATRIX.values;
-    const auto& ROW_PTRS       = a_FIRST_MATRIX.row_ptrs;
-    const auto& COLUMN_INDICES = a_FIRST_MATRIX.column_indices;
-    const int   SIZE           = a_FIRST_MATRIX.number_of_rows;
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(guided)
-#endif
-    for (int i = 0; i < SIZE; i++) {
-        (*a_result_ptr)[i] = a_SECOND_COEFFICIENT * a_SECOND_VECTOR[i];
-        for (auto j = ROW_PTRS[i]; j < ROW_PTRS[i + 1]; j++) {
-            (*a_result_ptr)[i] += a_FIRST_COEFFICIENT * VALUES[j] *
-                                  a_FIRST_VECTOR[COLUMN_INDICES[j]];
-        }
-    }
+    auto& result = *a_result_ptr;
+    a_FIRST_MATRIX.for_each_row_product(
+        a_FIRST_VECTOR, [&](const int a_ROW, const double a_PRODUCT) {
+            result[a_ROW] = a_SECOND_COEFFICIENT * a_SECOND_VECTOR[a_ROW] +
+                            a_FIRST_COEFFICIENT * a_PRODUCT;
+        });
 }
 
 /*****************************************************************************/
@@ -131,22 +122,13 @@ inline void linear_combination(
     const SparseMatrix& a_FIRST_MATRIX, const Vector& a_FIRST_VECTOR,
     const double a_SECOND_COEFFICIENT, const Vector& a_SECOND_VECTOR,
     const double a_THIRD_COEFFICIENT, const Vector& a_THIRD_VECTOR) {
-    const auto& VALUES         = a_FIRST_MATRIX.values;
-    const auto& ROW_PTRS       = a_FIRST_MATRIX.row_ptrs;
-    const auto& COLUMN_INDICES = a_FIRST_MATRIX.column_indices;
-    const int   SIZE           = a_FIRST_MATRIX.number_of_rows;
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(guided)
-#endif
-    for (int i = 0; i < SIZE; i++) {
-        (*a_result_ptr)[i] = a_SECOND_COEFFICIENT * a_SECOND_VECTOR[i] +
-                             a_THIRD_COEFFICIENT * a_THIRD_VECTOR[i];
-        for (auto j = ROW_PTRS[i]; j < ROW_PTRS[i + 1]; j++) {
-            (*a_result_ptr)[i] += a_FIRST_COEFFICIENT * VALUES[j] *
-                                  a_FIRST_VECTOR[COLUMN_INDICES[j]];
-        }
-    }
+    auto& result = *a_result_ptr;
+    a_FIRST_MATRIX.for_each_row_product(
+        a_FIRST_VECTOR, [&](const int a_ROW, const double a_PRODUCT) {
+            result[a_ROW] = a_SECOND_COEFFICIENT * a_SECOND_VECTOR[a_ROW] +
+                            a_THIRD_COEFFICIENT * a_THIRD_VECTOR[a_ROW] +
+                            a_FIRST_COEFFICIENT * a_PRODUCT;
+        });
 }
 
 /*****************************************************************************/
@@ -156,37 +138,127 @@ inline void linear_combination(Vector*                     a_result_ptr,
                                const Vector&               a_FIRST_VECTOR,
                                const std::vector<double>&  a_REST_COEFFICIENTS,
                                const std::vector<Vector*>& a_REST_VECTOR_PTRS) {
-    const auto& VALUES         = a_FIRST_MATRIX.values;
-    const auto& ROW_PTRS       = a_FIRST_MATRIX.row_ptrs;
-    const auto& COLUMN_INDICES = a_FIRST_MATRIX.column_indices;
-
     const int NUMBER_OF_REST_TERMS = a_REST_VECTOR_PTRS.size();
-    const int SIZE                 = a_REST_VECTOR_PTRS.front()->size();
+
+    auto& result = *a_result_ptr;
+    a_FIRST_MATRIX.for_each_row_product(
+        a_FIRST_VECTOR, [&](const int a_ROW, const double a_PRODUCT) {
+            double value = 0.0;
+            for (auto j = 0; j < NUMBER_OF_REST_TERMS; j++) {
+                value += a_REST_COEFFICIENTS[j] * (*a_REST_VECTOR_PTRS[j])[a_ROW];
+            }
+            result[a_ROW] = value + a_FIRST_COEFFICIENT * a_PRODUCT;
+        });
+}
+
+/*****************************************************************************/
+inline void linear_combination_clamp(Vector*       a_result_ptr,
+                                     const double  a_FIRST_COEFFICIENT,
+                                     const Vector& a_FIRST_VECTOR,
+                                     const double  a_SECOND_COEFFICIENT,
+                                     const Vector& a_SECOND_VECTOR,
+                                     const double  a_THIRD_COEFFICIENT,
+                                     const Vector& a_THIRD_VECTOR,
+                                     const Vector& a_LOWER_BOUNDS,
+                                     const Vector& a_UPPER_BOUNDS) {
+    /**
+     * This function is equivalent to linear_combination() followed by
+     * Vector::clamp(), with a single pass over the vectors.
+     */
+    const int SIZE = a_FIRST_VECTOR.size();
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(guided)
+#pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < SIZE; i++) {
-        (*a_result_ptr)[i] = 0.0;
+    for (auto i = 0; i < SIZE; i++) {
+        (*a_result_ptr)[i] =
+            std::clamp(a_FIRST_COEFFICIENT * a_FIRST_VECTOR[i] +
+                           a_SECOND_COEFFICIENT * a_SECOND_VECTOR[i] +
+                           a_THIRD_COEFFICIENT * a_THIRD_VECTOR[i],
+                       a_LOWER_BOUNDS[i], a_UPPER_BOUNDS[i]);
+    }
+}
 
-        for (auto j = 0; j < NUMBER_OF_REST_TERMS; j++) {
-            (*a_result_ptr)[i] +=
-                a_REST_COEFFICIENTS[j] * (*a_REST_VECTOR_PTRS[j])[i];
-        }
+/*****************************************************************************/
+inline void linear_combination_clamp(
+    Vector* a_result_ptr, Vector* a_product_ptr,
+    const double a_FIRST_COEFFICIENT, const SparseMatrix& a_FIRST_MATRIX,
+    const Vector& a_FIRST_VECTOR, const double a_SECOND_COEFFICIENT,
+    const Vector& a_SECOND_VECTOR, const double a_THIRD_COEFFICIENT,
+    const Vector& a_THIRD_VECTOR, const Vector& a_LOWER_BOUNDS,
+    const Vector& a_UPPER_BOUNDS) {
+    /**
+     * This function is equivalent to SparseMatrix::dot() storing the product
+     * into a_product_ptr, followed by linear_combination() and
+     * Vector::clamp(), with a single pass over the rows.
+     */
+    auto& result  = *a_result_ptr;
+    auto& product = *a_product_ptr;
+    a_FIRST_MATRIX.for_each_row_product(
+        a_FIRST_VECTOR, [&](const int a_ROW, const double a_PRODUCT) {
+            product[a_ROW] = a_PRODUCT;
+            result[a_ROW]  = std::clamp(
+                a_SECOND_COEFFICIENT * a_SECOND_VECTOR[a_ROW] +
+                    a_THIRD_COEFFICIENT * a_THIRD_VECTOR[a_ROW] +
+                    a_FIRST_COEFFICIENT * a_PRODUCT,
+                a_LOWER_BOUNDS[a_ROW], a_UPPER_BOUNDS[a_ROW]);
+        });
+}
 
-        for (auto j = ROW_PTRS[i]; j < ROW_PTRS[i + 1]; j++) {
-            (*a_result_ptr)[i] += a_FIRST_COEFFICIENT * VALUES[j] *
-                                  a_FIRST_VECTOR[COLUMN_INDICES[j]];
-        }
+/*****************************************************************************/
+inline double subtract_with_square_sum(Vector* a_result_ptr, const Vector& a_FIRST,
+                                       const Vector& a_SECOND) {
+    /**
+     * This function is equivalent to subtract() followed by
+     * Vector::square_sum() of the result, with a single pass.
+     */
+    const int SIZE       = a_FIRST.size();
+    double    square_sum = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : square_sum)
+#endif
+    for (auto i = 0; i < SIZE; i++) {
+        const double DIFF  = a_FIRST[i] - a_SECOND[i];
+        (*a_result_ptr)[i] = DIFF;
+        square_sum += DIFF * DIFF;
+    }
+    return square_sum;
+}
+
+/*****************************************************************************/
+inline double extrapolate(Vector* a_extrapolated_ptr, Vector* a_move_ptr,
+                          const Vector& a_TRIAL, const Vector& a_CURRENT) {
+    /**
+     * This function computes the move a_TRIAL - a_CURRENT and the
+     * extrapolated point 2 * a_TRIAL - a_CURRENT with a single pass, and
+     * returns the square sum of the move.
+     */
+    const int SIZE       = a_TRIAL.size();
+    double    square_sum = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : square_sum)
+#endif
+    for (auto i = 0; i < SIZE; i++) {
+        const double MOVE        = a_TRIAL[i] - a_CURRENT[i];
+        (*a_move_ptr)[i]         = MOVE;
+        (*a_extrapolated_ptr)[i] = a_TRIAL[i] + MOVE;
+        square_sum += MOVE * MOVE;
     }
+    return square_sum;
 }
 
 /*****************************************************************************/
 inline double dot_dot(Vector* a_result_ptr, const Vector& a_COLUMN_VECTOR,
                       const SparseMatrix& a_MATRIX,
                       const Vector&       a_ROW_VECTOR) {
-    a_MATRIX.dot(a_result_ptr, a_ROW_VECTOR);
-    return a_COLUMN_VECTOR.dot(*a_result_ptr);
+    auto& result = *a_result_ptr;
+    return a_MATRIX.reduce_row_products(
+        a_ROW_VECTOR, [&](const int a_ROW, const double a_PRODUCT) {
+            result[a_ROW] = a_PRODUCT;
+            return a_COLUMN_VECTOR[a_ROW] * a_PRODUCT;
+        });
 }
 
 }  // namespace printemps::utility::sparse
@@ -14,6 +14,13 @@ struct SparseMatrix {
     std::vector<int>    column_indices;
     std::vector<int>    row_ptrs;
 
+    /**
+     * The single precision copy of values, which is used for the products in
+     * place of values while is_enabled_single_precision is true.
+     */
+    std::vector<float> values_single;
+    bool               is_enabled_single_precision;
+
     Diagonal row_scaler;
     Diagonal column_scaler;
 
@@ -42,6 +49,8 @@ struct SparseMatrix {
         this->values.clear();
         this->row_indices.clear();
         this->column_indices.clear();
+        this->values_single.clear();
+        this->is_enabled_single_precision = false;
         this->row_scaler.initialize();
         this->column_scaler.initialize();
         this->number_of_rows    = 0;
@@ -75,6 +84,9 @@ struct SparseMatrix {
             this->row_ptrs[i + 1] += this->row_ptrs[i];
         }
 
+        this->values_single.clear();
+        this->is_enabled_single_precision = false;
+
         this->setup_norm();
     }
 
@@ -131,6 +143,7 @@ struct SparseMatrix {
         this->row_scaler *= row_scaler;
         this->column_scaler *= column_scaler;
         this->setup_norm();
+        this->update_single_precision_values();
     }
 
     /*************************************************************************/
@@ -175,6 +188,35 @@ struct SparseMatrix {
             this->column_scaler *= column_scaler;
             this->setup_norm();
         }
+        this->update_single_precision_values();
+    }
+
+    /*************************************************************************/
+    inline void enable_single_precision(void) {
+        /**
+         * The single precision copy must be rebuilt whenever values are
+         * modified, e.g., by scaling.
+         */
+        const int NONZERO_SIZE = this->values.size();
+        this->values_single.resize(NONZERO_SIZE);
+        for (auto i = 0; i < NONZERO_SIZE; i++) {
+            this->values_single[i] = static_cast<float>(this->values[i]);
+        }
+        this->is_enabled_single_precision = true;
+    }
+
+    /*************************************************************************/
+    inline void update_single_precision_values(void) {
+        if (this->is_enabled_single_precision) {
+            this->enable_single_precision();
+        }
+    }
+
+    /*************************************************************************/
+    inline void disable_single_precision(void) {
+        this->values_single.clear();
+        this->values_single.shrink_to_fit();
+        this->is_enabled_single_precision = false;
     }
 
     /*************************************************************************/
@@ -208,26 +250,289 @@ struct SparseMatrix {
                             this->number_of_rows);
     }
     /*************************************************************************/
-    inline void dot(Vector* a_result_ptr, const Vector& a_X) const {
+    inline std::pair<int, int> row_range(
+        const int a_PARTITION, const int a_NUMBER_OF_PARTITIONS) const noexcept {
+        /**
+         * This method returns the range of rows assigned to the specified
+         * partition. The rows are split so that each partition has almost the
+         * same sum of the number of nonzeros and the number of rows, which is
+         * a monotone function of the row index and can be bisected.
+         */
+        const auto find_boundary = [this](const long long a_TARGET) {
+            int lower = 0;
+            int upper = this->number_of_rows;
+            while (lower < upper) {
+                const int MIDDLE = (lower + upper) / 2;
+                if (static_cast<long long>(this->row_ptrs[MIDDLE]) + MIDDLE <
+                    a_TARGET) {
+                    lower = MIDDLE + 1;
+                } else {
+                    upper = MIDDLE;
+                }
+            }
+            return lower;
+        };
+
+        const long long TOTAL_WEIGHT =
+            static_cast<long long>(this->row_ptrs[this->number_of_rows]) +
+            this->number_of_rows;
+
+        const int BEGIN =
+            find_boundary(TOTAL_WEIGHT * a_PARTITION / a_NUMBER_OF_PARTITIONS);
+        const int END = find_boundary(TOTAL_WEIGHT * (a_PARTITION + 1) /
+                                      a_NUMBER_OF_PARTITIONS);
+        return {BEGIN, END};
+    }
+
+    /*************************************************************************/
+    inline double row_dot(
+        const int a_ROW, const double* a_X,
+        const utility::simd::InstructionSet a_INSTRUCTION_SET) const noexcept {
+        if (this->is_enabled_single_precision) {
+            return this->row_dot_single(a_ROW, a_X, a_INSTRUCTION_SET);
+        }
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+        switch (a_INSTRUCTION_SET) {
+            case utility::simd::InstructionSet::AVX512: {
+                return this->row_dot_avx512(a_ROW, a_X);
+            }
+            case utility::simd::InstructionSet::AVX2: {
+                return this->row_dot_avx2(a_ROW, a_X);
+            }
+            default: {
+                break;
+            }
+        }
+#endif
+        static_cast<void>(a_INSTRUCTION_SET);
+        return this->row_dot_scalar(a_ROW, a_X);
+    }
+
+    /*************************************************************************/
+    inline double row_dot_single(
+        const int a_ROW, const double* a_X,
+        const utility::simd::InstructionSet a_INSTRUCTION_SET) const noexcept {
+        /**
+         * The single precision values are widened on load so that the
+         * products are accumulated in double precision.
+         */
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+        switch (a_INSTRUCTION_SET) {
+            case utility::simd::InstructionSet::AVX512: {
+                return this->row_dot_single_avx512(a_ROW, a_X);
+            }
+            case utility::simd::InstructionSet::AVX2: {
+                return this->row_dot_single_avx2(a_ROW, a_X);
+            }
+            default: {
+                break;
+            }
+        }
+#endif
+        static_cast<void>(a_INSTRUCTION_SET);
+        return this->row_dot_single_scalar(a_ROW, a_X);
+    }
+
+    /*************************************************************************/
+    inline double row_dot_scalar(const int     a_ROW,
+                                 const double* a_X) const noexcept {
+        double result = 0.0;
+        for (auto j = this->row_ptrs[a_ROW]; j < this->row_ptrs[a_ROW + 1];
+             j++) {
+            result += this->values[j] * a_X[this->column_indices[j]];
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    inline double row_dot_single_scalar(const int     a_ROW,
+                                        const double* a_X) const noexcept {
+        double result = 0.0;
+        for (auto j = this->row_ptrs[a_ROW]; j < this->row_ptrs[a_ROW + 1];
+             j++) {
+            result += static_cast<double>(this->values_single[j]) *
+                      a_X[this->column_indices[j]];
+        }
+        return result;
+    }
+
+#ifdef _PRINTEMPS_ENABLE_X86_SIMD
+/**
+ * NOTE: Some intrinsics of GCC use undefined vectors internally, which result
+ * in false-positive warnings on uninitialized variables.
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    /*************************************************************************/
+    __attribute__((target("avx2,fma"))) inline double row_dot_avx2(
+        const int a_ROW, const double* a_X) const noexcept {
+        const int     BEGIN          = this->row_ptrs[a_ROW];
+        const int     END            = this->row_ptrs[a_ROW + 1];
+        const double* VALUES         = this->values.data();
+        const int*    COLUMN_INDICES = this->column_indices.data();
+
+        __m256d sum = _mm256_setzero_pd();
+
+        int j = BEGIN;
+        for (; j + 4 <= END; j += 4) {
+            const __m128i INDICES = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(COLUMN_INDICES + j));
+            sum = _mm256_fmadd_pd(_mm256_loadu_pd(VALUES + j),
+                                  _mm256_i32gather_pd(a_X, INDICES, 8), sum);
+        }
+
+        const __m128d HALF_SUM = _mm_add_pd(_mm256_castpd256_pd128(sum),
+                                            _mm256_extractf128_pd(sum, 1));
+        double result =
+            _mm_cvtsd_f64(_mm_add_sd(HALF_SUM, _mm_unpackhi_pd(HALF_SUM,
+                                                               HALF_SUM)));
+
+        for (; j < END; j++) {
+            result += VALUES[j] * a_X[COLUMN_INDICES[j]];
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    __attribute__((target("avx512f"))) inline double row_dot_avx512(
+        const int a_ROW, const double* a_X) const noexcept {
+        const int     BEGIN          = this->row_ptrs[a_ROW];
+        const int     END            = this->row_ptrs[a_ROW + 1];
+        const double* VALUES         = this->values.data();
+        const int*    COLUMN_INDICES = this->column_indices.data();
+
+        __m512d sum = _mm512_setzero_pd();
+
+        int j = BEGIN;
+        for (; j + 8 <= END; j += 8) {
+            const __m256i INDICES = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(COLUMN_INDICES + j));
+            sum = _mm512_fmadd_pd(_mm512_loadu_pd(VALUES + j),
+                                  _mm512_i32gather_pd(INDICES, a_X, 8), sum);
+        }
+
+        double result = _mm512_reduce_add_pd(sum);
+        for (; j < END; j++) {
+            result += VALUES[j] * a_X[COLUMN_INDICES[j]];
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    __attribute__((target("avx2,fma"))) inline double row_dot_single_avx2(
+        const int a_ROW, const double* a_X) const noexcept {
+        const int    BEGIN          = this->row_ptrs[a_ROW];
+        const int    END            = this->row_ptrs[a_ROW + 1];
+        const float* VALUES         = this->values_single.data();
+        const int*   COLUMN_INDICES = this->column_indices.data();
+
+        __m256d sum = _mm256_setzero_pd();
+
+        int j = BEGIN;
+        for (; j + 4 <= END; j += 4) {
+            const __m128i INDICES = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(COLUMN_INDICES + j));
+            sum = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(VALUES + j)),
+                                  _mm256_i32gather_pd(a_X, INDICES, 8), sum);
+        }
+
+        const __m128d HALF_SUM = _mm_add_pd(_mm256_castpd256_pd128(sum),
+                                            _mm256_extractf128_pd(sum, 1));
+        double result =
+            _mm_cvtsd_f64(_mm_add_sd(HALF_SUM, _mm_unpackhi_pd(HALF_SUM,
+                                                               HALF_SUM)));
+
+        for (; j < END; j++) {
+            result += static_cast<double>(VALUES[j]) * a_X[COLUMN_INDICES[j]];
+        }
+        return result;
+    }
+
+    /*************************************************************************/
+    __attribute__((target("avx512f"))) inline double row_dot_single_avx512(
+        const int a_ROW, const double* a_X) const noexcept {
+        const int    BEGIN          = this->row_ptrs[a_ROW];
+        const int    END            = this->row_ptrs[a_ROW + 1];
+        const float* VALUES         = this->values_single.data();
+        const int*   COLUMN_INDICES = this->column_indices.data();
+
+        __m512d sum = _mm512_setzero_pd();
+
+        int j = BEGIN;
+        for (; j + 8 <= END; j += 8) {
+            const __m256i INDICES = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(COLUMN_INDICES + j));
+            sum = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(VALUES + j)),
+                                  _mm512_i32gather_pd(INDICES, a_X, 8), sum);
+        }
+
+        double result = _mm512_reduce_add_pd(sum);
+        for (; j < END; j++) {
+            result += static_cast<double>(VALUES[j]) * a_X[COLUMN_INDICES[j]];
+        }
+        return result;
+    }
+#pragma GCC diagnostic pop
+#endif
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline double reduce_row_products(const Vector&     a_X,
+                                      const T_Function& a_FUNCTION) const {
+        /**
+         * This method calls a_FUNCTION(i, p) for each row i, where p is the
+         * inner product of the row and a_X, and returns the sum of the
+         * returned values. The rows are partitioned across threads by
+         * row_range() so that the threads have balanced loads.
+         */
         if (this->number_of_columns != static_cast<int>(a_X.size())) {
             throw std::runtime_error(utility::format_error_location(
                 __FILE__, __LINE__, __func__,
                 "The matrix and vector sizes are inconsistent."));
         }
 
-        const auto& VALUES         = this->values;
-        const auto& ROW_PTRS       = this->row_ptrs;
-        const auto& COLUMN_INDICES = this->column_indices;
+        const auto    INSTRUCTION_SET = utility::simd::detect_instruction_set();
+        const double* X               = a_X.values.data();
+        double        result          = 0.0;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(guided)
+#pragma omp parallel reduction(+ : result)
+#endif
+        {
+            int partition            = 0;
+            int number_of_partitions = 1;
+#ifdef _OPENMP
+            partition            = omp_get_thread_num();
+            number_of_partitions = omp_get_num_threads();
 #endif
-        for (int i = 0; i < this->number_of_rows; i++) {
-            (*a_result_ptr)[i] = 0;
-            for (auto j = ROW_PTRS[i]; j < ROW_PTRS[i + 1]; j++) {
-                (*a_result_ptr)[i] += VALUES[j] * a_X[COLUMN_INDICES[j]];
+            const auto [BEGIN, END] =
+                this->row_range(partition, number_of_partitions);
+            for (auto i = BEGIN; i < END; i++) {
+                result += a_FUNCTION(i, this->row_dot(i, X, INSTRUCTION_SET));
             }
         }
+        return result;
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_row_product(const Vector&     a_X,
+                                     const T_Function& a_FUNCTION) const {
+        this->reduce_row_products(
+            a_X, [&a_FUNCTION](const int a_ROW, const double a_PRODUCT) {
+                a_FUNCTION(a_ROW, a_PRODUCT);
+                return 0.0;
+            });
+    }
+
+    /*************************************************************************/
+    inline void dot(Vector* a_result_ptr, const Vector& a_X) const {
+        auto& result = *a_result_ptr;
+        this->for_each_row_product(
+            a_X, [&result](const int a_ROW, const double a_PRODUCT) {
+                result[a_ROW] = a_PRODUCT;
+            });
     }
 
     /*************************************************************************/
@@ -253,6 +558,7 @@ struct SparseMatrix {
                 a_result_ptr->values[j] *= a_DIAGONAL[i];
             }
         }
+        a_result_ptr->update_single_precision_values();
     }
 
     /*************************************************************************/
@@ -277,6 +583,7 @@ struct SparseMatrix {
             a_result_ptr->values[i] *=
                 a_DIAGONAL[a_result_ptr->column_indices[i]];
         }
+        a_result_ptr->update_single_precision_values();
     }
 
     /*************************************************************************/
@@ -57,14 +57,20 @@ struct Vector {
 
     /*************************************************************************/
     inline double square_sum(void) const noexcept {
-        return std::inner_product(this->values.begin(), this->values.end(),
-                                  this->values.begin(), 0.0);
+        const int SIZE   = this->values.size();
+        double    result = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : result)
+#endif
+        for (auto i = 0; i < SIZE; i++) {
+            result += this->values[i] * this->values[i];
+        }
+        return result;
     }
 
     /*************************************************************************/
     inline double norm(void) const noexcept {
-        return sqrt(std::inner_product(this->values.begin(), this->values.end(),
-                                       this->values.begin(), 0.0));
+        return sqrt(this->square_sum());
     }
 
     /*************************************************************************/
@@ -81,6 +87,11 @@ struct Vector {
         return this->values.size();
     }
 
+    /*************************************************************************/
+    inline void swap(Vector& a_vector) noexcept {
+        this->values.swap(a_vector.values);
+    }
+
     /*************************************************************************/
     inline void reset(void) noexcept {
         for (auto&& v : this->values) {
@@ -103,7 +114,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator+=(const double a_VALUE) noexcept {
+    inline Vector& operator+=(const double a_VALUE) noexcept {
         for (auto&& v : this->values) {
             v += a_VALUE;
         }
@@ -111,7 +122,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator+=(const Vector& a_VECTOR) {
+    inline Vector& operator+=(const Vector& a_VECTOR) {
         if (this->size() != a_VECTOR.size()) {
             throw std::runtime_error(utility::format_error_location(
                 __FILE__, __LINE__, __func__,
@@ -129,7 +140,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator-=(const double a_VALUE) noexcept {
+    inline Vector& operator-=(const double a_VALUE) noexcept {
         for (auto&& v : this->values) {
             v -= a_VALUE;
         }
@@ -137,7 +148,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator-=(const Vector& a_VECTOR) {
+    inline Vector& operator-=(const Vector& a_VECTOR) {
         if (this->size() != a_VECTOR.size()) {
             throw std::runtime_error(utility::format_error_location(
                 __FILE__, __LINE__, __func__,
@@ -155,7 +166,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator*=(const double a_VALUE) noexcept {
+    inline Vector& operator*=(const double a_VALUE) noexcept {
         for (auto&& v : this->values) {
             v *= a_VALUE;
         }
@@ -163,7 +174,7 @@ struct Vector {
     }
 
     /*************************************************************************/
-    inline Vector operator/=(const double a_VALUE) noexcept {
+    inline Vector& operator/=(const double a_VALUE) noexcept {
         for (auto&& v : this->values) {
             v /= a_VALUE;
         }
@@ -219,12 +230,19 @@ struct Vector {
                 "Vector sizes are inconsistent."));
         }
 
-        return std::inner_product(this->values.begin(), this->values.end(),
-                                  a_VECTOR.values.begin(), 0.0);
+        const int SIZE   = this->values.size();
+        double    result = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : result)
+#endif
+        for (auto i = 0; i < SIZE; i++) {
+            result += this->values[i] * a_VECTOR[i];
+        }
+        return result;
     }
 
     /*************************************************************************/
-    inline Vector extend(const Vector& a_VECTOR) {
+    inline Vector& extend(const Vector& a_VECTOR) {
         this->values.insert(this->values.end(), a_VECTOR.values.begin(),
                             a_VECTOR.values.end());
         return *this;
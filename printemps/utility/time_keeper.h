@@ -10,19 +10,29 @@
 namespace printemps::utility {
 /*****************************************************************************/
 class TimeKeeper {
+    /**
+     * This class measures the elapsed wall-clock time by the monotonic
+     * std::chrono::steady_clock, which is used for time limits and speed
+     * statistics. The process CPU time, which is the sum over all threads, is
+     * measured separately by cpu_clock().
+     */
    private:
     double m_start_time;
+    double m_start_cpu_time;
     double m_elapsed_time;
+    double m_elapsed_cpu_time;
     bool   m_is_started;
 
     /*************************************************************************/
-    inline double get_time(void) {
-#ifdef _OPENMP
-        return omp_get_wtime();
-#else
-        clock_t now = std::clock();
-        return static_cast<double>(now) / CLOCKS_PER_SEC;
-#endif
+    inline static double get_time(void) noexcept {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /*************************************************************************/
+    inline static double get_cpu_time(void) noexcept {
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
     }
 
    public:
@@ -33,15 +43,18 @@ class TimeKeeper {
 
     /*************************************************************************/
     inline void set_start_time(void) {
-        m_start_time = get_time();
-        m_is_started = true;
+        m_start_time     = get_time();
+        m_start_cpu_time = get_cpu_time();
+        m_is_started     = true;
     }
 
     /*************************************************************************/
     inline void initialize(void) {
-        m_start_time   = 0.0;
-        m_elapsed_time = 0.0;
-        m_is_started   = false;
+        m_start_time       = 0.0;
+        m_start_cpu_time   = 0.0;
+        m_elapsed_time     = 0.0;
+        m_elapsed_cpu_time = 0.0;
+        m_is_started       = false;
     }
 
     /*************************************************************************/
@@ -51,6 +64,13 @@ class TimeKeeper {
         return m_elapsed_time;
     }
 
+    /*************************************************************************/
+    inline double cpu_clock(void) {
+        double now         = get_cpu_time();
+        m_elapsed_cpu_time = now - m_start_cpu_time;
+        return m_elapsed_cpu_time;
+    }
+
     /*************************************************************************/
     inline double start_time(void) const {
         return m_start_time;
@@ -61,6 +81,11 @@ class TimeKeeper {
         return m_elapsed_time;
     }
 
+    /*************************************************************************/
+    inline double elapsed_cpu_time(void) const {
+        return m_elapsed_cpu_time;
+    }
+
     /*************************************************************************/
     inline bool is_started(void) const {
         return m_is_started;
@@ -13,19 +13,26 @@
 #include "string_utility.h"
 #include "date_time_utility.h"
 #include "integer_utility.h"
+#include "simd_utility.h"
 #include "random.h"
 #include "time_keeper.h"
 #include "fixed_size_hash_map.h"
 #include "fixed_size_queue.h"
+#include "bitset.h"
+#include "small_vector.h"
+#include "span.h"
 #include "bidirectional_map.h"
 #include "range.h"
 #include "union_find.h"
 #include "graph/graph.h"
 #include "json/json.h"
+#include "json/json_writer.h"
+#include "json/json_parser.h"
 #include "binary_matrix.h"
 #include "q_learning/q_learning.h"
 #include "ucb1/ucb1.h"
 #include "sparse/sparse.h"
+#include "memory_mapped_file.h"
 
 #endif
 /*****************************************************************************/
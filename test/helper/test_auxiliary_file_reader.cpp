@@ -29,6 +29,17 @@ TEST_F(TestAuxiliaryFileReader, read_names_and_values) {
     EXPECT_EQ(4.0, names_and_values["d"]);
 }
 
+/*****************************************************************************/
+TEST_F(TestAuxiliaryFileReader, read_names_and_values_json) {
+    auto names_and_values = helper::read_names_and_values(
+        "./test/dat/helper/names_and_values.json");
+    EXPECT_EQ(4, static_cast<int>(names_and_values.size()));
+    EXPECT_EQ(1.0, names_and_values["a"]);
+    EXPECT_EQ(2.0, names_and_values["b"]);
+    EXPECT_EQ(3.0, names_and_values["c"]);
+    EXPECT_EQ(4.0, names_and_values["d"]);
+}
+
 /*****************************************************************************/
 TEST_F(TestAuxiliaryFileReader, read_names) {
     auto names = helper::read_names("./test/dat/helper/names.txt");
@@ -626,6 +626,123 @@ TEST_F(TestModel, setup_structure) {
     /// This method is tested in the following submethods.
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, update_structure) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& y = model.create_variables("y", 1, 0, 10);
+
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x(0) + x(1) == 1;
+    g(1)    = x(1) + x(2) + y(0) <= 5;
+    g(2)    = x(2) + x(3) >= 1;
+
+    auto& e = model.create_expression("e");
+    e(0)    = x(0) + x(1);
+
+    model.setup_unique_names();
+    model.setup_structure();
+    EXPECT_TRUE(g(0).is_exclusive_or());
+    EXPECT_EQ(1, static_cast<int>(y(0).related_constraint_ptrs().size()));
+
+    const int X_3_ID = x(3).id();
+    const int Y_0_ID = y(0).id();
+    const int G_1_ID = g(1).id();
+
+    /// The incidence matrix shared with a forked model must not be modified.
+    const auto INCIDENCE_MATRIX_PTR = model.incidence_matrix_ptr();
+
+    /// Fix a variable, which changes the type of the related constraint.
+    x(0).fix_by(0);
+
+    /// Substitute y in g(1) with 2 * x(3).
+    model.mark_structure_dirty(&g(1));
+    g(1).expression().substitute(&y(0), 2 * x(3));
+
+    /// Substitute x(1) in e with x(2).
+    model.mark_structure_dirty(&e(0));
+    e(0).substitute(&x(1), x(2).to_expression());
+
+    /// Disable a constraint, which is detected without the registration.
+    g(2).disable();
+
+    /// Add a new constraint.
+    auto& h = model.create_constraints("h", 1);
+    h(0)    = x(0) + x(3) <= 1;
+    h(0).set_name("h");
+
+    model.update_structure();
+
+    EXPECT_FALSE(g(0).is_exclusive_or());
+    EXPECT_EQ(4, model.number_of_constraints());
+    EXPECT_EQ(4, model.number_of_mutable_variables());
+
+    EXPECT_TRUE(y(0).related_constraint_ptrs().empty());
+
+    EXPECT_EQ(3, static_cast<int>(x(3).related_constraint_ptrs().size()));
+    EXPECT_EQ(&g(1), x(3).related_constraint_ptrs()[0]);
+    EXPECT_EQ(&g(2), x(3).related_constraint_ptrs()[1]);
+    EXPECT_EQ(&h(0), x(3).related_constraint_ptrs()[2]);
+
+    EXPECT_EQ(2, model.incidence_matrix().coefficient(x(3).id(), g(1).id()));
+
+    EXPECT_EQ(2, static_cast<int>(x(0).related_constraint_ptrs().size()));
+    EXPECT_EQ(&g(0), x(0).related_constraint_ptrs()[0]);
+    EXPECT_EQ(&h(0), x(0).related_constraint_ptrs()[1]);
+
+    EXPECT_EQ(3, h(0).id());
+
+    /// The ids of the existing variables and constraints are kept.
+    EXPECT_EQ(X_3_ID, x(3).id());
+    EXPECT_EQ(Y_0_ID, y(0).id());
+    EXPECT_EQ(G_1_ID, g(1).id());
+    EXPECT_EQ(4, model.constraint_state_table().size());
+
+    EXPECT_NE(INCIDENCE_MATRIX_PTR, model.incidence_matrix_ptr());
+    EXPECT_EQ(0, INCIDENCE_MATRIX_PTR->coefficient(X_3_ID, G_1_ID));
+    EXPECT_EQ(1, INCIDENCE_MATRIX_PTR->coefficient(Y_0_ID, G_1_ID));
+    EXPECT_EQ(0, model.incidence_matrix().coefficient(Y_0_ID, G_1_ID));
+    EXPECT_EQ(1, model.incidence_matrix().coefficient(x(0).id(), h(0).id()));
+    EXPECT_EQ(1, model.incidence_matrix().coefficient(x(3).id(), g(2).id()));
+
+    EXPECT_EQ(3, model.number_of_enabled_constraints());
+    EXPECT_EQ(1, model.number_of_disabled_constraints());
+    EXPECT_EQ(&g(2), model.constraint_reference().disabled_constraint_ptrs[0]);
+    EXPECT_EQ(&g(0), model.constraint_reference().enabled_constraint_ptrs[0]);
+    EXPECT_EQ(&g(1), model.constraint_reference().enabled_constraint_ptrs[1]);
+    EXPECT_EQ(&h(0), model.constraint_reference().enabled_constraint_ptrs[2]);
+
+    EXPECT_EQ(1, model.number_of_fixed_variables());
+    EXPECT_EQ(&x(0), model.variable_reference().fixed_variable_ptrs[0]);
+    EXPECT_EQ(&x(1), model.variable_reference().mutable_variable_ptrs[0]);
+
+    EXPECT_TRUE(x(1).related_expression_ptrs().empty());
+    EXPECT_EQ(1, static_cast<int>(x(2).related_expression_ptrs().size()));
+    EXPECT_EQ(&e(0), x(2).related_expression_ptrs()[0]);
+}
+
+#ifndef NDEBUG
+/*****************************************************************************/
+TEST_F(TestModel, update_structure_without_mark_structure_dirty) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& y = model.create_variable("y", 0, 10);
+
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + x(1) + y <= 5;
+    g(1)    = x(1) + x(2) >= 1;
+
+    model.setup_unique_names();
+    model.setup_structure();
+
+    /// Modify an expression without mark_structure_dirty().
+    g(0).expression().substitute(&y(0), 2 * x(2));
+    ASSERT_THROW(model.update_structure(), std::logic_error);
+}
+#endif
+
 /*****************************************************************************/
 TEST_F(TestModel, setup_unique_names) {
     model::Model<int, double> model;
@@ -771,7 +888,7 @@ TEST_F(TestModel, setup_variable_objective_sensitivities) {
 }
 
 /*****************************************************************************/
-TEST_F(TestModel, setup_variable_constraint_sensitivities) {
+TEST_F(TestModel, for_each_constraint_sensitivity) {
     model::Model<int, double> model;
 
     auto& x = model.create_variables("x", 10, 0, 1);
@@ -790,23 +907,31 @@ TEST_F(TestModel, setup_variable_constraint_sensitivities) {
     g(0) = p(0) <= 10000;
     g(1) = p(1) <= 10000;
 
-    model.setup_variable_constraint_sensitivities();
+    model.setup_structure();
 
     for (auto i = 0; i < 10; i++) {
-        for (auto&& sensitivity : x(i).constraint_sensitivities()) {
-            if (sensitivity.first == &g(0)) {
-                EXPECT_EQ(i + 1, sensitivity.second);
-            }
-        }
+        int count = 0;
+        model.for_each_constraint_sensitivity(
+            &x(i), [&g, &count, i](const auto* a_CONSTRAINT_PTR,
+                                   const double a_SENSITIVITY) {
+                EXPECT_EQ(&g(0), a_CONSTRAINT_PTR);
+                EXPECT_EQ(i + 1, a_SENSITIVITY);
+                count++;
+            });
+        EXPECT_EQ(1, count);
     }
 
     for (auto i = 0; i < 20; i++) {
         for (auto j = 0; j < 30; j++) {
-            for (auto&& sensitivity : y(i, j).constraint_sensitivities()) {
-                if (sensitivity.first == &g(1)) {
-                    EXPECT_EQ(i + j + 1, sensitivity.second);
-                }
-            }
+            int count = 0;
+            model.for_each_constraint_sensitivity(
+                &y(i, j), [&g, &count, i, j](const auto*  a_CONSTRAINT_PTR,
+                                             const double a_SENSITIVITY) {
+                    EXPECT_EQ(&g(1), a_CONSTRAINT_PTR);
+                    EXPECT_EQ(i + j + 1, a_SENSITIVITY);
+                    count++;
+                });
+            EXPECT_EQ(1, count);
         }
     }
 }
@@ -1025,6 +1150,107 @@ TEST_F(TestModel,
     /// This method is tested in test_expression.h
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, fork) {
+    model::Model<int, double> model("model");
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& y = model.create_variables("y", {2, 3}, -10, 10);
+    auto& g = model.create_constraints("g", 3);
+
+    g(0) = x.selection();
+    g(1) = y.sum() <= 20;
+    g(2) = 2 * x[0] + 3 * y(0, 0) >= 1;
+
+    y(1, 2).fix_by(5);
+    x[3] = 1;
+
+    model.minimize(x.sum() + 2 * y.sum());
+
+    option::Option option;
+    option.neighborhood.selection_mode = option::selection_mode::Defined;
+    model.setup(option, false);
+
+    g(1).local_penalty_coefficient_less() = 123.0;
+
+    auto fork_ptr = model.fork(option);
+    auto& fork    = *fork_ptr;
+
+    EXPECT_EQ("model", fork.name());
+    EXPECT_EQ(model.is_minimization(), fork.is_minimization());
+    EXPECT_EQ(model.number_of_variables(), fork.number_of_variables());
+    EXPECT_EQ(model.number_of_fixed_variables(),
+              fork.number_of_fixed_variables());
+    EXPECT_EQ(model.number_of_selection_variables(),
+              fork.number_of_selection_variables());
+    EXPECT_EQ(model.number_of_constraints(), fork.number_of_constraints());
+    EXPECT_EQ(model.number_of_enabled_constraints(),
+              fork.number_of_enabled_constraints());
+    EXPECT_EQ(model.selections().size(), fork.selections().size());
+    EXPECT_EQ(model.variable_names(), fork.variable_names());
+    EXPECT_EQ(model.constraint_names(), fork.constraint_names());
+
+    auto& x_fork = fork.variable_proxies()[0];
+    auto& y_fork = fork.variable_proxies()[1];
+    auto& g_fork = fork.constraint_proxies()[0];
+
+    EXPECT_EQ(x[3].name(), x_fork[3].name());
+    EXPECT_EQ(1, x_fork[3].value());
+    EXPECT_TRUE(y_fork(1, 2).is_fixed());
+    EXPECT_EQ(5, y_fork(1, 2).value());
+    EXPECT_EQ(y(0, 0).lower_bound(), y_fork(0, 0).lower_bound());
+    EXPECT_EQ(y(0, 0).upper_bound(), y_fork(0, 0).upper_bound());
+    EXPECT_EQ(x[0].sense(), x_fork[0].sense());
+    EXPECT_EQ(&fork.selections()[0], x_fork[0].selection_ptr());
+    EXPECT_FLOAT_EQ(123.0, g_fork(1).local_penalty_coefficient_less());
+
+    /**
+     * The components of the fork must refer to the components of the fork.
+     */
+    for (const auto& sensitivity : g_fork(2).expression().sensitivities()) {
+        EXPECT_TRUE(sensitivity.first == &x_fork[0] ||
+                    sensitivity.first == &y_fork(0, 0));
+    }
+    for (const auto& sensitivity :
+         fork.objective().expression().sensitivities()) {
+        const auto VARIABLE_PTR = sensitivity.first;
+        EXPECT_EQ(&fork.variable_proxies()[VARIABLE_PTR->proxy_index()]
+                       .flat_indexed_variables(VARIABLE_PTR->flat_index()),
+                  VARIABLE_PTR);
+    }
+
+    model.update();
+    fork.update();
+    EXPECT_FLOAT_EQ(model.objective().value(), fork.objective().value());
+    EXPECT_FLOAT_EQ(g(1).constraint_value(), g_fork(1).constraint_value());
+
+    /**
+     * Changing the fork does not affect the original model.
+     */
+    const int Y_VALUE = y(0, 0).value();
+    y_fork(0, 0)      = Y_VALUE + 1;
+    fork.update();
+    EXPECT_EQ(Y_VALUE, y(0, 0).value());
+    EXPECT_FLOAT_EQ(model.objective().value() + 2.0, fork.objective().value());
+
+    /**
+     * The incidence matrix is shared, and the ids of the components coincide.
+     */
+    EXPECT_EQ(model.incidence_matrix_ptr(), fork.incidence_matrix_ptr());
+    EXPECT_EQ(y(0, 0).id(), y_fork(0, 0).id());
+    EXPECT_EQ(g(2).id(), g_fork(2).id());
+    EXPECT_TRUE(fork.is_enabled_variable_improvability_table());
+
+    /**
+     * Setting up the incidence matrix of the original model again does not
+     * affect the fork.
+     */
+    const auto INCIDENCE_MATRIX_PTR = fork.incidence_matrix_ptr();
+    model.setup_structure();
+    EXPECT_NE(model.incidence_matrix_ptr(), fork.incidence_matrix_ptr());
+    EXPECT_EQ(INCIDENCE_MATRIX_PTR, fork.incidence_matrix_ptr());
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, export_lp_instance) {
     /// This method is tested in test_expression.h
@@ -1261,6 +1487,88 @@ TEST_F(TestModel, update_arg_move) {
     EXPECT_EQ(&x(9), model.selections().front().selected_variable_ptr);
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, update_arg_move_related_expressions) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& p = model.create_expressions("p", 3);
+    p(0)    = x(0) + x(1);
+    p(1)    = x(1) + 2 * x(2);
+    p(2)    = x(3);
+
+    model.minimize(x.sum());
+    model.setup_structure();
+    model.setup_fixed_sensitivities(false);
+    model.update();
+
+    EXPECT_EQ(1, static_cast<int>(x(0).related_expression_ptrs().size()));
+    EXPECT_EQ(2, static_cast<int>(x(1).related_expression_ptrs().size()));
+    EXPECT_EQ(1, static_cast<int>(x(2).related_expression_ptrs().size()));
+    EXPECT_EQ(1, static_cast<int>(x(3).related_expression_ptrs().size()));
+
+    {
+        neighborhood::Move<int, double> move;
+        move.alterations.emplace_back(&x(1), 1);
+        model.update(move);
+
+        EXPECT_EQ(1, p(0).value());
+        EXPECT_EQ(1, p(1).value());
+        EXPECT_EQ(0, p(2).value());
+    }
+
+    {
+        /// p(1) includes both of the altered variables.
+        neighborhood::Move<int, double> move;
+        move.alterations.emplace_back(&x(1), 0);
+        move.alterations.emplace_back(&x(2), 1);
+        model.update(move);
+
+        EXPECT_EQ(0, p(0).value());
+        EXPECT_EQ(2, p(1).value());
+        EXPECT_EQ(0, p(2).value());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, update_arg_move_constraint_values) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + 2 * x(1) <= 1;
+    g(1)    = x(1) + x(2) >= 1;
+
+    model.minimize(x(0) + x(1) + x(2));
+    model.setup_structure();
+    model.setup_fixed_sensitivities(false);
+    model.update();
+
+    neighborhood::Move<int, double> move;
+    move.alterations.emplace_back(&x(0), 1);
+    move.alterations.emplace_back(&x(1), 1);
+
+    std::vector<model_component::Constraint<int, double>*>
+        related_constraint_ptrs = {&g(0), &g(1)};
+    move.related_constraint_ptrs = related_constraint_ptrs;
+
+    std::vector<double> constraint_values(2, 0.0);
+    constraint_values[g(0).id()] = 2.0;
+    constraint_values[g(1).id()] = 0.0;
+
+    model.update(move, constraint_values);
+
+    EXPECT_EQ(1, x(0).value());
+    EXPECT_EQ(1, x(1).value());
+    EXPECT_EQ(0, x(2).value());
+    EXPECT_EQ(2, model.objective().value());
+    EXPECT_EQ(2, g(0).constraint_value());
+    EXPECT_EQ(0, g(1).constraint_value());
+    EXPECT_FALSE(g(0).is_feasible());
+    EXPECT_TRUE(g(1).is_feasible());
+    EXPECT_FALSE(model.is_feasible());
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, reset_variable_objective_improvabilities_arg_void) {
     model::Model<int, double> model;
@@ -1723,12 +2031,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto&& element : x.flat_indexed_variables()) {
                 move.alterations.emplace_back(&element, 1);
-                for (auto&& constraint_ptr :
-                     element.related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -1765,12 +2070,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto&& element : x.flat_indexed_variables()) {
                 move.alterations.emplace_back(&element, 0);
-                for (auto&& constraint_ptr :
-                     element.related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -1803,11 +2105,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto i = 0; i < 5; i++) {
                 move.alterations.emplace_back(&x(i), 1);
-                for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -1905,12 +2205,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto&& element : x.flat_indexed_variables()) {
                 move.alterations.emplace_back(&element, 1);
-                for (auto&& constraint_ptr :
-                     element.related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -1946,12 +2243,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto&& element : x.flat_indexed_variables()) {
                 move.alterations.emplace_back(&element, 0);
-                for (auto&& constraint_ptr :
-                     element.related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -1984,11 +2278,9 @@ TEST_F(TestModel, evaluate) {
             neighborhood::Move<int, double> move;
             for (auto i = 0; i < 5; i++) {
                 move.alterations.emplace_back(&x(i), 1);
-                for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
-                    move.related_constraint_ptrs.push_back(constraint_ptr);
-                }
             }
-            move.sort_and_unique_related_constraint_ptrs();
+            neighborhood::RelatedConstraintPtrsPool<int, double> pool;
+            move.related_constraint_ptrs = pool.store_union(move.alterations);
 
             auto score_after_0 = model.evaluate(move);
             auto score_after_1 = model.evaluate(move, score_before);
@@ -2052,6 +2344,104 @@ TEST_F(TestModel, evaluate) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, compute_violation_diff_single) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraint("g", x.sum() <= 5);
+    auto& h = model.create_constraint("h", x(0) + x(1) >= 1);
+
+    g(0).local_penalty_coefficient_less() = 100;
+    h(0).local_penalty_coefficient_greater() = 10;
+
+    model.minimize(x.sum());
+    model.set_global_penalty_coefficient(10000);
+    model.setup_structure();
+    model.setup_fixed_sensitivities(false);
+
+    for (auto i = 2; i < 8; i++) {
+        x(i) = 1;
+    }
+    model.update();
+    const auto SCORE_BEFORE = model.evaluate({});
+
+    for (auto i = 0; i < 10; i++) {
+        neighborhood::Move<int, double> move;
+        move.alterations.emplace_back(&x(i), 1 - x(i).value());
+        move.is_univariable_move = true;
+        move.related_constraint_ptrs = x(i).related_constraint_ptrs();
+
+        double total_violation_diff = 0.0;
+        double local_penalty_diff   = 0.0;
+        model.compute_violation_diff_single(&total_violation_diff,
+                                            &local_penalty_diff, move);
+
+        solution::SolutionScore score_single;
+        solution::SolutionScore score_cached;
+        model.evaluate_single(&score_single, move, SCORE_BEFORE);
+        model.evaluate_single(&score_cached, move, SCORE_BEFORE,
+                              total_violation_diff, local_penalty_diff);
+        const auto SCORE_AFTER = model.evaluate(move, SCORE_BEFORE);
+
+        EXPECT_EQ(SCORE_AFTER.total_violation,
+                  SCORE_BEFORE.total_violation + total_violation_diff);
+        EXPECT_EQ(SCORE_AFTER.local_penalty,
+                  SCORE_BEFORE.local_penalty + local_penalty_diff);
+
+        EXPECT_EQ(score_single.objective, score_cached.objective);
+        EXPECT_EQ(score_single.total_violation, score_cached.total_violation);
+        EXPECT_EQ(score_single.local_penalty, score_cached.local_penalty);
+        EXPECT_EQ(score_single.global_penalty, score_cached.global_penalty);
+        EXPECT_EQ(score_single.local_augmented_objective,
+                  score_cached.local_augmented_objective);
+        EXPECT_EQ(score_single.global_augmented_objective,
+                  score_cached.global_augmented_objective);
+        EXPECT_EQ(score_single.is_feasible, score_cached.is_feasible);
+        EXPECT_EQ(SCORE_AFTER.objective, score_cached.objective);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, for_each_related_constraint_value) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x(0) + 2 * x(1) <= 1;
+    g(1)    = 3 * x(1) - x(2) == 0;
+    g(2)    = x(3) >= 1;
+
+    model.minimize(x.sum());
+    model.setup_structure();
+    model.setup_fixed_sensitivities(false);
+
+    x(1) = 1;
+    model.update();
+
+    neighborhood::Move<int, double> move;
+    move.alterations.emplace_back(&x(0), 1);
+    move.alterations.emplace_back(&x(1), 0);
+    move.alterations.emplace_back(&x(2), 1);
+
+    std::vector<int>    ids;
+    std::vector<double> values;
+    model.for_each_related_constraint_value(
+        move, [&ids, &values](const int a_ID, const double a_VALUE) {
+            ids.push_back(a_ID);
+            values.push_back(a_VALUE);
+        });
+
+    /// g(2) is not related to the move.
+    EXPECT_EQ(std::vector<int>({g(0).id(), g(1).id()}), ids);
+    EXPECT_EQ(std::vector<double>({0, -1}), values);
+
+    model.update(move);
+    EXPECT_EQ(0, g(0).constraint_value());
+    EXPECT_EQ(-1, g(1).constraint_value());
+    EXPECT_EQ(-1, g(2).constraint_value());
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, compute_lagrangian) {
     model::Model<int, double> model;
@@ -2555,6 +2945,47 @@ TEST_F(TestModel, export_sparse_solution) {
     EXPECT_EQ(10, sparse_solution.variables[x[0].name()]);
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, export_indexed_sparse_solution) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 10);
+    auto& y = model.create_variables("y", {20, 30}, 0, 1);
+
+    model.minimize(x.sum() + y.sum());
+    model.setup_unique_names();
+    model.setup_structure();
+
+    x(2)    = 5;
+    x(7)    = 3;
+    y(1, 2) = 1;
+
+    model.update();
+
+    auto indexed_solution = model.export_indexed_sparse_solution();
+    EXPECT_EQ(model.objective().value(), indexed_solution.objective);
+    EXPECT_EQ(model.is_feasible(), indexed_solution.is_feasible);
+    EXPECT_EQ(3, indexed_solution.number_of_nonzeros());
+    EXPECT_EQ(std::vector<std::int32_t>({x(2).id(), x(7).id(), y(1, 2).id()}),
+              indexed_solution.variable_ids);
+    EXPECT_EQ(std::vector<int>({5, 3, 1}), indexed_solution.variable_values);
+
+    /// The dense solution gives the same result.
+    auto dense_solution = model.export_dense_solution();
+    EXPECT_TRUE(indexed_solution.has_same_variables(
+        model.export_indexed_sparse_solution(dense_solution)));
+
+    /// The names are restored from the variable ids.
+    auto sparse_solution = model.export_sparse_solution(indexed_solution);
+    EXPECT_EQ(model.objective().value(), sparse_solution.objective);
+    EXPECT_EQ(3, static_cast<int>(sparse_solution.variables.size()));
+    EXPECT_EQ(5, sparse_solution.variables[x(2).name()]);
+    EXPECT_EQ(3, sparse_solution.variables[x(7).name()]);
+    EXPECT_EQ(1, sparse_solution.variables[y(1, 2).name()]);
+    EXPECT_TRUE(sparse_solution.has_same_variables(
+        model.export_sparse_solution()));
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, export_named_solution) {
     model::Model<int, double> model;
@@ -2975,6 +3406,11 @@ TEST_F(TestModel, import_mps) {
     /// To be implemented.
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, import_mps_snapshot) {
+    /// To be implemented.
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, import_pb) {
     /// To be implemented.
@@ -1627,6 +1627,26 @@ TEST_F(TestConstraint, update_arg_move) {
     /// This method is tested in evaluate_expression_arg_move().
 }
 
+/*****************************************************************************/
+TEST_F(TestConstraint, update_by_constraint_value) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 2, 0, 1);
+    auto& g = model.create_constraint("g", x(0) + x(1) <= 1);
+
+    g(0).update();
+    EXPECT_EQ(-1, g(0).constraint_value());
+    EXPECT_EQ(0, g(0).violation_value());
+
+    g(0).update_by_constraint_value(1);
+    EXPECT_EQ(1, g(0).constraint_value());
+    EXPECT_EQ(1, g(0).expression().value());
+    EXPECT_EQ(1, g(0).violation_value());
+    EXPECT_EQ(0, g(0).margin_value());
+    EXPECT_EQ(1, g(0).positive_part());
+    EXPECT_EQ(0, g(0).negative_part());
+}
+
 /*****************************************************************************/
 TEST_F(TestConstraint, expression) {
     /// This method is tested in constructor_arg_expression().
@@ -1757,6 +1777,21 @@ TEST_F(TestConstraint, is_user_defined_selection) {
     /// This method is tested in set_is_user_defined_selection().
 }
 
+/*****************************************************************************/
+TEST_F(TestConstraint, set_id) {
+    auto constraint =
+        model_component::Constraint<int, double>::create_instance();
+
+    EXPECT_EQ(0, constraint.id());
+    constraint.set_id(10);
+    EXPECT_EQ(10, constraint.id());
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraint, id) {
+    /// This method is tested in set_id().
+}
+
 /*****************************************************************************/
 TEST_F(TestConstraint, has_only_binary_coefficient) {
     /// This method is tested in other methods.
@@ -0,0 +1,226 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestConstraintStateTable : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestConstraintStateTable, initialize) {
+    model_component::ConstraintStateTable<int, double> table;
+
+    EXPECT_TRUE(table.constraint_values.empty());
+    EXPECT_TRUE(table.positive_parts.empty());
+    EXPECT_TRUE(table.negative_parts.empty());
+    EXPECT_TRUE(table.local_penalty_coefficients_less.empty());
+    EXPECT_TRUE(table.local_penalty_coefficients_greater.empty());
+    EXPECT_TRUE(table.flags.empty());
+    EXPECT_TRUE(table.constraint_ptrs.empty());
+    EXPECT_EQ(0, table.size());
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintStateTable, setup) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x.sum() <= 5;
+    g(1)    = x.sum() == 5;
+    g(2)    = x.sum() >= 5;
+    g(2).disable();
+
+    for (auto&& element : x.flat_indexed_variables()) {
+        element = 1;
+    }
+    g(0).local_penalty_coefficient_less()    = 10.0;
+    g(1).local_penalty_coefficient_greater() = 20.0;
+
+    model.setup_structure();
+    model.update();
+
+    const auto& TABLE = model.constraint_state_table();
+    EXPECT_EQ(3, TABLE.size());
+
+    for (auto i = 0; i < 3; i++) {
+        EXPECT_EQ(i, g(i).id());
+        EXPECT_EQ(&g(i), TABLE.constraint_ptrs[i]);
+        EXPECT_EQ(5, TABLE.constraint_values[i]);
+        EXPECT_EQ(5, TABLE.positive_parts[i]);
+        EXPECT_EQ(0, TABLE.negative_parts[i]);
+    }
+
+    EXPECT_EQ(10.0, TABLE.local_penalty_coefficients_less[0]);
+    EXPECT_EQ(20.0, TABLE.local_penalty_coefficients_greater[1]);
+
+    EXPECT_TRUE(TABLE.is_enabled(0));
+    EXPECT_TRUE(TABLE.is_less_or_equal(0));
+    EXPECT_FALSE(TABLE.is_greater_or_equal(0));
+    EXPECT_FALSE(TABLE.is_evaluation_ignorable(0));
+
+    EXPECT_TRUE(TABLE.is_enabled(1));
+    EXPECT_TRUE(TABLE.is_less_or_equal(1));
+    EXPECT_TRUE(TABLE.is_greater_or_equal(1));
+    EXPECT_FALSE(TABLE.is_evaluation_ignorable(1));
+
+    EXPECT_FALSE(TABLE.is_enabled(2));
+    EXPECT_FALSE(TABLE.is_less_or_equal(2));
+    EXPECT_TRUE(TABLE.is_greater_or_equal(2));
+    EXPECT_TRUE(TABLE.is_evaluation_ignorable(2));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintStateTable, extend) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x.sum() <= 5;
+    g(1)    = x.sum() == 5;
+    g(2)    = x.sum() >= 5;
+    g(2).disable();
+
+    for (auto&& element : x.flat_indexed_variables()) {
+        element = 1;
+    }
+    model.setup_structure();
+    model.update();
+
+    model_component::ConstraintStateTable<int, double> table;
+    table.setup({&g(0)});
+    EXPECT_EQ(1, table.size());
+
+    /// The constraints beyond the current size are appended.
+    g(0).set_id(-1);
+    table.extend({&g(0), &g(1), &g(2)});
+    EXPECT_EQ(3, table.size());
+    EXPECT_EQ(-1, g(0).id());
+
+    for (auto i = 1; i < 3; i++) {
+        EXPECT_EQ(i, g(i).id());
+        EXPECT_EQ(&g(i), table.constraint_ptrs[i]);
+        EXPECT_EQ(5, table.constraint_values[i]);
+    }
+
+    EXPECT_TRUE(table.is_enabled(1));
+    EXPECT_TRUE(table.is_less_or_equal(1));
+    EXPECT_TRUE(table.is_greater_or_equal(1));
+
+    EXPECT_FALSE(table.is_enabled(2));
+    EXPECT_TRUE(table.is_evaluation_ignorable(2));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintStateTable, update_arg_move) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + x(1) <= 1;
+    g(1)    = x(2) + x(3) <= 1;
+
+    model.setup_structure();
+    model.setup_fixed_sensitivities(false);
+    model.update();
+
+    neighborhood::Move<int, double> move;
+    move.alterations.emplace_back(&x(0), 1);
+    std::vector<model_component::Constraint<int, double>*> constraint_ptrs = {
+        &g(0)};
+    move.related_constraint_ptrs = constraint_ptrs;
+    model.update(move);
+
+    const auto& TABLE = model.constraint_state_table();
+    EXPECT_EQ(0, TABLE.constraint_values[0]);
+    EXPECT_EQ(-1, TABLE.constraint_values[1]);
+    EXPECT_TRUE(TABLE.is_evaluation_ignorable(1));
+    EXPECT_EQ(g(0).constraint_value(), TABLE.constraint_values[0]);
+    EXPECT_EQ(g(0).is_evaluation_ignorable(),
+              TABLE.is_evaluation_ignorable(0));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintStateTable, accumulate_violation_diff) {
+    constexpr int NUMBER_OF_CONSTRAINTS = 103;
+
+    model_component::ConstraintStateTable<int, double> table;
+    table.constraint_values.resize(NUMBER_OF_CONSTRAINTS);
+    table.positive_parts.resize(NUMBER_OF_CONSTRAINTS);
+    table.negative_parts.resize(NUMBER_OF_CONSTRAINTS);
+    table.local_penalty_coefficients_less.resize(NUMBER_OF_CONSTRAINTS);
+    table.local_penalty_coefficients_greater.resize(NUMBER_OF_CONSTRAINTS);
+    table.flags.resize(NUMBER_OF_CONSTRAINTS);
+
+    std::mt19937 engine(0);
+    std::uniform_int_distribution<> value_distribution(-10, 10);
+    std::uniform_int_distribution<> flag_distribution(0, 15);
+
+    for (auto i = 0; i < NUMBER_OF_CONSTRAINTS; i++) {
+        const double VALUE = value_distribution(engine);
+
+        table.constraint_values[i]                  = VALUE;
+        table.positive_parts[i]                     = std::max(VALUE, 0.0);
+        table.negative_parts[i]                     = -std::min(VALUE, 0.0);
+        table.local_penalty_coefficients_less[i]    = 1.0 + i;
+        table.local_penalty_coefficients_greater[i] = 2.0 + i;
+        table.flags[i] = flag_distribution(engine);
+    }
+
+    /// Skipped constraints with infinite coefficients must not yield NaN.
+    table.local_penalty_coefficients_less[0] = HUGE_VALF;
+    table.flags[0] = model_component::ConstraintStateTableConstant::
+        IS_EVALUATION_IGNORABLE;
+
+    std::vector<int>    constraint_ids;
+    std::vector<double> coefficients;
+    for (auto i = NUMBER_OF_CONSTRAINTS - 1; i >= 0; i -= 2) {
+        constraint_ids.push_back(i);
+        coefficients.push_back(value_distribution(engine));
+    }
+    constraint_ids.push_back(0);
+    coefficients.push_back(1.0);
+
+    const int SIZE = constraint_ids.size();
+
+    double total_violation_scalar = 0.0;
+    double local_penalty_scalar   = 0.0;
+    table.accumulate_violation_diff(
+        &total_violation_scalar, &local_penalty_scalar, constraint_ids.data(),
+        coefficients.data(), SIZE, 1, utility::simd::InstructionSet::Scalar);
+
+    EXPECT_FALSE(std::isnan(total_violation_scalar));
+    EXPECT_FALSE(std::isnan(local_penalty_scalar));
+
+    for (const auto &INSTRUCTION_SET : {utility::simd::InstructionSet::AVX2,
+                                        utility::simd::InstructionSet::AVX512}) {
+        if (!utility::simd::is_supported(INSTRUCTION_SET)) {
+            continue;
+        }
+        double total_violation = 0.0;
+        double local_penalty   = 0.0;
+        table.accumulate_violation_diff(&total_violation, &local_penalty,
+                                        constraint_ids.data(),
+                                        coefficients.data(), SIZE, 1,
+                                        INSTRUCTION_SET);
+        EXPECT_DOUBLE_EQ(total_violation_scalar, total_violation);
+        EXPECT_DOUBLE_EQ(local_penalty_scalar, local_penalty);
+    }
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
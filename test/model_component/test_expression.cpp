@@ -337,6 +337,16 @@ TEST_F(TestExpression, update_arg_move) {
     EXPECT_EQ(expected_result, expression.value());
 }
 
+/*****************************************************************************/
+TEST_F(TestExpression, set_value) {
+    auto expression =
+        model_component::Expression<int, double>::create_instance();
+
+    EXPECT_EQ(0, expression.value());
+    expression.set_value(10);
+    EXPECT_EQ(10, expression.value());
+}
+
 /*****************************************************************************/
 TEST_F(TestExpression, value) {
     /// tested in other cases
@@ -0,0 +1,101 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestIncidenceMatrix : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestIncidenceMatrix, initialize) {
+    model_component::IncidenceMatrix<int, double> matrix;
+
+    EXPECT_TRUE(matrix.column_ptrs.empty());
+    EXPECT_TRUE(matrix.column_constraint_ids.empty());
+    EXPECT_TRUE(matrix.column_coefficients.empty());
+    EXPECT_EQ(0, matrix.number_of_variables);
+    EXPECT_EQ(0, matrix.number_of_constraints);
+    EXPECT_EQ(0, matrix.number_of_nonzeros());
+}
+
+/*****************************************************************************/
+TEST_F(TestIncidenceMatrix, setup) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + 2 * x(2) <= 1;
+    g(1)    = 3 * x(1) - x(2) == 0;
+
+    model.setup_structure();
+
+    const auto& MATRIX = model.incidence_matrix();
+    EXPECT_EQ(3, MATRIX.number_of_variables);
+    EXPECT_EQ(2, MATRIX.number_of_constraints);
+    EXPECT_EQ(4, MATRIX.number_of_nonzeros());
+
+    for (auto i = 0; i < 3; i++) {
+        EXPECT_EQ(i, x(i).id());
+    }
+
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 4}), MATRIX.column_ptrs);
+    EXPECT_EQ(std::vector<int>({0, 1, 0, 1}), MATRIX.column_constraint_ids);
+    EXPECT_EQ(std::vector<double>({1, 3, 2, -1}), MATRIX.column_coefficients);
+
+    EXPECT_EQ(1, MATRIX.coefficient(0, 0));
+    EXPECT_EQ(0, MATRIX.coefficient(0, 1));
+    EXPECT_EQ(0, MATRIX.coefficient(1, 0));
+    EXPECT_EQ(3, MATRIX.coefficient(1, 1));
+    EXPECT_EQ(2, MATRIX.coefficient(2, 0));
+    EXPECT_EQ(-1, MATRIX.coefficient(2, 1));
+}
+
+/*****************************************************************************/
+TEST_F(TestIncidenceMatrix, update) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + 2 * x(2) <= 1;
+    g(1)    = 3 * x(1) - x(2) == 0;
+
+    model.setup_structure();
+
+    auto matrix = model.incidence_matrix();
+
+    /// Substitute x(0) in g(0) with x(1), and add a new constraint h.
+    g(0).expression().substitute(&x(0), x(1).to_expression());
+
+    auto& h = model.create_constraint("h");
+    h(0)    = x(0) + x(2) >= 1;
+    h(0).set_id(2);
+
+    matrix.update({&x(0), &x(1), &x(2)}, {&g(0), &h(0)}, 3);
+
+    EXPECT_EQ(3, matrix.number_of_variables);
+    EXPECT_EQ(3, matrix.number_of_constraints);
+    EXPECT_EQ(6, matrix.number_of_nonzeros());
+
+    EXPECT_EQ(std::vector<int>({0, 1, 3, 6}), matrix.column_ptrs);
+    EXPECT_EQ(std::vector<int>({2, 0, 1, 0, 1, 2}),
+              matrix.column_constraint_ids);
+    EXPECT_EQ(std::vector<double>({1, 1, 3, 2, -1, 1}),
+              matrix.column_coefficients);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -66,7 +66,6 @@ TEST_F(TestVariable, initialize) {
     EXPECT_TRUE(variable.related_constraint_ptrs().empty());
     EXPECT_TRUE(variable.related_binary_coefficient_constraint_ptrs().empty());
     EXPECT_EQ(nullptr, variable.dependent_expression_ptr());
-    EXPECT_TRUE(variable.constraint_sensitivities().empty());
     EXPECT_EQ(0.0, variable.objective_sensitivity());
     EXPECT_EQ(0UL, variable.hash());
     EXPECT_EQ(-1, variable.related_selection_constraint_ptr_index_min());
@@ -280,6 +279,20 @@ TEST_F(TestVariable, update_count) {
     /// This method is tested in increment_update_count().
 }
 
+/*****************************************************************************/
+TEST_F(TestVariable, set_id) {
+    auto variable = model_component::Variable<int, double>::create_instance();
+
+    EXPECT_EQ(0, variable.id());
+    variable.set_id(10);
+    EXPECT_EQ(10, variable.id());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariable, id) {
+    /// This method is tested in set_id().
+}
+
 /*****************************************************************************/
 TEST_F(TestVariable, fix) {
     auto variable = model_component::Variable<int, double>::create_instance();
@@ -705,49 +718,6 @@ TEST_F(TestVariable, dependent_constraint_ptr) {
     /// This method is tested in setup_uniform_sensitivity().
 }
 
-/*****************************************************************************/
-TEST_F(TestVariable, register_constraint_sensitivity) {
-    auto variable = model_component::Variable<int, double>::create_instance();
-    auto constraint_0 =
-        model_component::Constraint<int, double>::create_instance();
-    auto constraint_1 =
-        model_component::Constraint<int, double>::create_instance();
-    constraint_0.set_name("bb");
-    constraint_1.set_name("aa");
-
-    EXPECT_TRUE(variable.constraint_sensitivities().empty());
-
-    variable.register_constraint_sensitivity(&constraint_0, 10);
-    EXPECT_EQ(1, static_cast<int>(variable.constraint_sensitivities().size()));
-    EXPECT_EQ(10, variable.constraint_sensitivities().back().second);
-
-    variable.register_constraint_sensitivity(&constraint_1, 20);
-    EXPECT_EQ(2, static_cast<int>(variable.constraint_sensitivities().size()));
-    EXPECT_EQ(20, variable.constraint_sensitivities().back().second);
-
-    variable.sort_constraint_sensitivities();
-    EXPECT_EQ("aa", variable.constraint_sensitivities()[0].first->name());
-    EXPECT_EQ("bb", variable.constraint_sensitivities()[1].first->name());
-
-    variable.reset_constraint_sensitivities();
-    EXPECT_TRUE(variable.constraint_sensitivities().empty());
-}
-
-/*****************************************************************************/
-TEST_F(TestVariable, reset_constraint_sensitivities) {
-    /// This method is tested in register_constraint_sensitivity().
-}
-
-/*****************************************************************************/
-TEST_F(TestVariable, sort_constraint_sensitivities) {
-    /// This method is tested in register_related_constraint_ptr().
-}
-
-/*****************************************************************************/
-TEST_F(TestVariable, constraint_sensitivities) {
-    /// This method is tested in register_constraint_sensitivity().
-}
-
 /*****************************************************************************/
 TEST_F(TestVariable, set_objective_sensitivity) {
     auto variable = model_component::Variable<int, double>::create_instance();
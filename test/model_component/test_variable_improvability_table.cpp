@@ -0,0 +1,73 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestVariableImprovabilityTable : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestVariableImprovabilityTable, initialize) {
+    model_component::VariableImprovabilityTable<int, double> table;
+
+    EXPECT_EQ(0, table.number_of_variables());
+    EXPECT_EQ(0, table.objective_improvable_bits.size());
+    EXPECT_EQ(0, table.feasibility_improvable_bits.size());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableImprovabilityTable, setup) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 100, 0, 1);
+    model.create_constraint("g", x.sum() <= 5);
+
+    /// The improvabilities before the setup are carried over.
+    x(1).set_is_objective_improvable(true);
+    x(2).set_is_feasibility_improvable(true);
+
+    model.setup_structure();
+
+    const auto& TABLE = model.variable_improvability_table();
+    EXPECT_EQ(100, TABLE.number_of_variables());
+    EXPECT_EQ(&TABLE, x(0).improvability_table_ptr());
+
+    EXPECT_TRUE(TABLE.objective_improvable_bits.test(x(1).id()));
+    EXPECT_TRUE(TABLE.feasibility_improvable_bits.test(x(2).id()));
+    EXPECT_EQ(1, TABLE.objective_improvable_bits.count());
+    EXPECT_EQ(1, TABLE.feasibility_improvable_bits.count());
+
+    /// The accessors of the variables refer to the table.
+    x(3).set_is_objective_improvable(true);
+    x(3).set_is_feasibility_improvable_or(true);
+    EXPECT_TRUE(TABLE.objective_improvable_bits.test(x(3).id()));
+    EXPECT_TRUE(TABLE.feasibility_improvable_bits.test(x(3).id()));
+    EXPECT_TRUE(x(3).is_improvable());
+
+    model.reset_variable_objective_improvabilities();
+    model.reset_variable_feasibility_improvabilities();
+    EXPECT_TRUE(TABLE.objective_improvable_bits.none());
+    EXPECT_TRUE(TABLE.feasibility_improvable_bits.none());
+    EXPECT_FALSE(x(3).is_improvable());
+    EXPECT_FALSE(model.has_objective_improvable_variable());
+
+    x(99).set_is_objective_improvable(true);
+    EXPECT_TRUE(model.has_objective_improvable_variable());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -812,6 +812,86 @@ TEST_F(TestMPS, read_mps_07a) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestMPS, read_mps_parallel) {
+    const std::vector<std::string> FILE_NAMES = {
+        "./test/dat/mps/test_00.mps",   //
+        "./test/dat/mps/test_01.mps",   //
+        "./test/dat/mps/test_02.mps",   //
+        "./test/dat/mps/test_03.mps",   //
+        "./test/dat/mps/test_05a.mps",  //
+        "./test/dat/mps/test_05c.mps"};
+
+    for (const auto &FILE_NAME : FILE_NAMES) {
+        for (const auto NUMBER_OF_THREADS : {1, 3, 16}) {
+            mps::MPS sequential(FILE_NAME);
+            mps::MPS parallel(FILE_NAME, true, NUMBER_OF_THREADS);
+
+            EXPECT_FALSE(sequential.matrix.is_enabled);
+            EXPECT_TRUE(parallel.matrix.is_enabled);
+
+            EXPECT_EQ(sequential.name, parallel.name);
+            EXPECT_EQ(sequential.objective.name, parallel.objective.name);
+            EXPECT_EQ(sequential.variable_names, parallel.variable_names);
+            EXPECT_EQ(sequential.constraint_names, parallel.constraint_names);
+
+            for (const auto &VARIABLE_NAME : sequential.variable_names) {
+                const auto &EXPECTED = sequential.variables[VARIABLE_NAME];
+                const auto &ACTUAL   = parallel.variables[VARIABLE_NAME];
+                EXPECT_EQ(EXPECTED.sense, ACTUAL.sense);
+                EXPECT_EQ(EXPECTED.integer_lower_bound,
+                          ACTUAL.integer_lower_bound);
+                EXPECT_EQ(EXPECTED.integer_upper_bound,
+                          ACTUAL.integer_upper_bound);
+            }
+
+            const auto &MATRIX = parallel.matrix;
+            EXPECT_EQ(static_cast<int>(parallel.constraint_names.size()),
+                      MATRIX.number_of_rows());
+
+            for (auto i = 0; i < MATRIX.number_of_rows(); i++) {
+                const auto &CONSTRAINT_NAME = parallel.constraint_names[i];
+                const auto &EXPECTED = sequential.constraints[CONSTRAINT_NAME];
+                const auto &ACTUAL   = parallel.constraints[CONSTRAINT_NAME];
+                EXPECT_EQ(EXPECTED.sense, ACTUAL.sense);
+                EXPECT_EQ(EXPECTED.rhs, ACTUAL.rhs);
+                EXPECT_TRUE(ACTUAL.sensitivities.empty());
+
+                std::unordered_map<std::string, double> sensitivities;
+                for (auto j = MATRIX.row_ptrs[i]; j < MATRIX.row_ptrs[i + 1];
+                     j++) {
+                    const auto &VARIABLE_NAME =
+                        parallel.variable_names[MATRIX.column_ids[j]];
+                    sensitivities[VARIABLE_NAME] = MATRIX.values[j];
+                }
+                EXPECT_EQ(EXPECTED.sensitivities, sensitivities);
+            }
+
+            std::unordered_map<std::string, double> objective_sensitivities;
+            const int NUMBER_OF_OBJECTIVE_NONZEROS =
+                MATRIX.objective_column_ids.size();
+            for (auto j = 0; j < NUMBER_OF_OBJECTIVE_NONZEROS; j++) {
+                objective_sensitivities
+                    [parallel.variable_names[MATRIX.objective_column_ids[j]]] =
+                        MATRIX.objective_values[j];
+            }
+            EXPECT_EQ(sequential.objective.sensitivities,
+                      objective_sensitivities);
+
+            const auto &COLUMN_NAMES = parallel.column_name_table.names();
+            for (auto j = 0; j < parallel.column_name_table.size(); j++) {
+                EXPECT_EQ(parallel.variable_names[j], COLUMN_NAMES[j]);
+            }
+        }
+    }
+
+    // NG case
+    {
+        mps::MPS mps;
+        ASSERT_THROW(mps.read_mps("./test/dat/mps/test_05b.mps", true, 4),
+                     std::runtime_error);
+    }
+}
 }  // namespace
 /*****************************************************************************/
 // END
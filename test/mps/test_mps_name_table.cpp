@@ -0,0 +1,99 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestMPSNameTable : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, initialize) {
+    mps::MPSNameTable table;
+    EXPECT_EQ(0, table.size());
+    EXPECT_TRUE(table.names().empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, intern) {
+    mps::MPSNameTable table;
+    {
+        const auto [ID, IS_INSERTED] = table.intern("x");
+        EXPECT_EQ(0, ID);
+        EXPECT_TRUE(IS_INSERTED);
+    }
+    {
+        std::string name = "y";
+        const auto [ID, IS_INSERTED] = table.intern(name);
+        name                         = "z";
+        EXPECT_EQ(1, ID);
+        EXPECT_TRUE(IS_INSERTED);
+        EXPECT_EQ("y", table.name(1));
+    }
+    {
+        const auto [ID, IS_INSERTED] = table.intern("x");
+        EXPECT_EQ(0, ID);
+        EXPECT_FALSE(IS_INSERTED);
+    }
+    EXPECT_EQ(2, table.size());
+
+    /// Names larger than a block are stored in a dedicated block.
+    const std::string LONG_NAME(mps::MPSNameTableConstant::BLOCK_SIZE + 1,
+                                'a');
+    EXPECT_EQ(2, table.intern(LONG_NAME).first);
+    EXPECT_EQ(3, table.intern("w").first);
+    EXPECT_EQ(LONG_NAME, table.name(2));
+    EXPECT_EQ("x", table.name(0));
+    EXPECT_EQ("w", table.name(3));
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, find) {
+    mps::MPSNameTable table;
+    table.intern("x");
+    table.intern("y");
+    EXPECT_EQ(0, table.find("x"));
+    EXPECT_EQ(1, table.find("y"));
+    EXPECT_EQ(-1, table.find("z"));
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, reserve) {
+    /// This method is tested in intern.
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, name) {
+    /// This method is tested in intern.
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, names) {
+    mps::MPSNameTable table;
+    table.intern("x");
+    table.intern("y");
+    EXPECT_EQ(2, static_cast<int>(table.names().size()));
+    EXPECT_EQ("x", table.names()[0]);
+    EXPECT_EQ("y", table.names()[1]);
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSNameTable, size) {
+    /// This method is tested in intern.
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,175 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestMPSSnapshot : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMPSSnapshot, initialize) {
+    mps::MPSSnapshot snapshot;
+    EXPECT_EQ(0, snapshot.number_of_variables());
+    EXPECT_EQ(0, snapshot.number_of_constraints());
+    EXPECT_EQ(0, snapshot.number_of_objective_nonzeros());
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSSnapshot, write_and_read) {
+    const std::string SNAPSHOT_FILE_NAME = "test_mps_snapshot.snapshot";
+
+    for (const auto IS_ENABLED_PARALLEL : {false, true}) {
+        mps::MPS mps("./test/dat/mps/test_01.mps", IS_ENABLED_PARALLEL, 2);
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+
+        mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME);
+        EXPECT_EQ(mps.name, snapshot.name());
+        EXPECT_EQ(mps.objective.name, snapshot.objective_name());
+        EXPECT_EQ(mps.objective.is_minimization, snapshot.is_minimization());
+
+        const int NUMBER_OF_VARIABLES = mps.variable_names.size();
+        EXPECT_EQ(NUMBER_OF_VARIABLES, snapshot.number_of_variables());
+        for (auto i = 0; i < NUMBER_OF_VARIABLES; i++) {
+            const auto &VARIABLE = mps.variables[mps.variable_names[i]];
+            EXPECT_EQ(mps.variable_names[i], snapshot.variable_name(i));
+            EXPECT_EQ(VARIABLE.sense, snapshot.variable_sense(i));
+            EXPECT_EQ(VARIABLE.integer_lower_bound,
+                      snapshot.variable_lower_bound(i));
+            EXPECT_EQ(VARIABLE.integer_upper_bound,
+                      snapshot.variable_upper_bound(i));
+            EXPECT_EQ(VARIABLE.is_fixed, snapshot.variable_is_fixed(i));
+        }
+
+        const int NUMBER_OF_CONSTRAINTS = mps.constraint_names.size();
+        EXPECT_EQ(NUMBER_OF_CONSTRAINTS, snapshot.number_of_constraints());
+
+        mps::MPS sequential("./test/dat/mps/test_01.mps");
+        for (auto i = 0; i < NUMBER_OF_CONSTRAINTS; i++) {
+            const auto &CONSTRAINT =
+                sequential.constraints[mps.constraint_names[i]];
+            EXPECT_EQ(mps.constraint_names[i], snapshot.constraint_name(i));
+            EXPECT_EQ(CONSTRAINT.sense, snapshot.constraint_sense(i));
+            EXPECT_EQ(CONSTRAINT.rhs, snapshot.constraint_rhs(i));
+
+            std::unordered_map<std::string, double> sensitivities;
+            for (auto j = snapshot.row_ptrs()[i];
+                 j < snapshot.row_ptrs()[i + 1]; j++) {
+                sensitivities[mps.variable_names[snapshot.column_ids()[j]]] =
+                    snapshot.values()[j];
+            }
+            EXPECT_EQ(CONSTRAINT.sensitivities, sensitivities);
+        }
+
+        std::unordered_map<std::string, double> objective_sensitivities;
+        for (auto j = 0; j < snapshot.number_of_objective_nonzeros(); j++) {
+            objective_sensitivities
+                [mps.variable_names[snapshot.objective_column_ids()[j]]] =
+                    snapshot.objective_values()[j];
+        }
+        EXPECT_EQ(sequential.objective.sensitivities, objective_sensitivities);
+    }
+    std::remove(SNAPSHOT_FILE_NAME.c_str());
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSSnapshot, read_invalid_file) {
+    ASSERT_THROW(mps::MPSSnapshot("./test/dat/mps/test_01.mps"),
+                 std::runtime_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSSnapshot, read_broken_file) {
+    const std::string SNAPSHOT_FILE_NAME = "test_mps_snapshot_broken.snapshot";
+
+    mps::MPS mps("./test/dat/mps/test_01.mps");
+    const std::size_t NUMBER_OF_VARIABLES   = mps.variable_names.size();
+    const std::size_t NUMBER_OF_CONSTRAINTS = mps.constraint_names.size();
+
+    const auto align = [](const std::size_t a_SIZE) {
+        constexpr std::size_t ALIGNMENT = mps::MPSSnapshotConstant::ALIGNMENT;
+        return (a_SIZE + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    };
+
+    const std::size_t ROW_PTRS_OFFSET =
+        align(sizeof(mps::MPSSnapshotHeader)) +
+        4 * align(sizeof(std::int32_t) * NUMBER_OF_VARIABLES) +
+        align(sizeof(std::uint8_t) * NUMBER_OF_VARIABLES) +
+        align(sizeof(std::int32_t) * NUMBER_OF_CONSTRAINTS) +
+        align(sizeof(double) * NUMBER_OF_CONSTRAINTS);
+    const std::size_t COLUMN_IDS_OFFSET =
+        ROW_PTRS_OFFSET +
+        align(sizeof(std::int32_t) * (NUMBER_OF_CONSTRAINTS + 1));
+
+    std::size_t number_of_nonzeros = 0;
+    for (const auto &CONSTRAINT_NAME : mps.constraint_names) {
+        number_of_nonzeros +=
+            mps.constraints[CONSTRAINT_NAME].sensitivities.size();
+    }
+    const std::size_t OBJECTIVE_COLUMN_IDS_OFFSET =
+        COLUMN_IDS_OFFSET + align(sizeof(std::int32_t) * number_of_nonzeros) +
+        align(sizeof(double) * number_of_nonzeros);
+
+    const auto overwrite = [&SNAPSHOT_FILE_NAME](const std::size_t  a_OFFSET,
+                                                 const std::int32_t a_VALUE) {
+        std::fstream fs(SNAPSHOT_FILE_NAME,
+                        std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(a_OFFSET);
+        fs.write(reinterpret_cast<const char *>(&a_VALUE), sizeof(a_VALUE));
+    };
+
+    /// Non-monotone row pointers.
+    {
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+        overwrite(ROW_PTRS_OFFSET + sizeof(std::int32_t), 1 << 20);
+        ASSERT_THROW(mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME),
+                     std::runtime_error);
+    }
+
+    /// Out-of-range column id.
+    {
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+        overwrite(COLUMN_IDS_OFFSET, NUMBER_OF_VARIABLES);
+        ASSERT_THROW(mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME),
+                     std::runtime_error);
+    }
+
+    /// Negative column id.
+    {
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+        overwrite(COLUMN_IDS_OFFSET, -1);
+        ASSERT_THROW(mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME),
+                     std::runtime_error);
+    }
+
+    /// Out-of-range objective column id.
+    {
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+        overwrite(OBJECTIVE_COLUMN_IDS_OFFSET, NUMBER_OF_VARIABLES);
+        ASSERT_THROW(mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME),
+                     std::runtime_error);
+    }
+
+    /// The file without corruption can be read.
+    {
+        mps::MPSSnapshot::write(mps, SNAPSHOT_FILE_NAME);
+        ASSERT_NO_THROW(mps::MPSSnapshot snapshot(SNAPSHOT_FILE_NAME));
+    }
+    std::remove(SNAPSHOT_FILE_NAME.c_str());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -64,6 +64,57 @@ TEST_F(TestBinaryMoveGenerator, setup) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestBinaryMoveGenerator, update_moves_improvable) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 100, 0, 1);
+    x(0).fix_by(0);
+
+    model.setup_unique_names();
+    model.setup_structure();
+    EXPECT_TRUE(model.is_enabled_variable_improvability_table());
+
+    auto binary_variable_ptrs =
+        model.variable_type_reference().binary_variable_ptrs;
+
+    model.neighborhood().binary().setup(binary_variable_ptrs);
+
+    model.reset_variable_objective_improvabilities();
+    model.reset_variable_feasibility_improvabilities();
+    x(0).set_is_objective_improvable(true);
+    x(10).set_is_objective_improvable(true);
+    x(70).set_is_feasibility_improvable(true);
+    x(99).set_is_objective_improvable(true);
+    x(99).set_is_feasibility_improvable(true);
+
+    auto& moves = model.neighborhood().binary().moves();
+    auto& flags = model.neighborhood().binary().flags();
+
+    using VariablePtrs = std::vector<model_component::Variable<int, double>*>;
+    const auto FLAGGED_VARIABLE_PTRS = [&moves, &flags]() {
+        VariablePtrs results;
+        for (auto i = 0; i < static_cast<int>(moves.size()); i++) {
+            if (flags[i]) {
+                EXPECT_EQ(1 - moves[i].alterations.front().first->value(),
+                          moves[i].alterations.front().second);
+                results.push_back(moves[i].alterations.front().first);
+            }
+        }
+        return results;
+    };
+
+    /// The fixed variable x(0) has no move.
+    model.neighborhood().binary().update_moves(false, true, false, false, 1);
+    EXPECT_EQ(FLAGGED_VARIABLE_PTRS(), (VariablePtrs{&x(10), &x(99)}));
+
+    model.neighborhood().binary().update_moves(false, false, true, false, 1);
+    EXPECT_EQ(FLAGGED_VARIABLE_PTRS(), (VariablePtrs{&x(70), &x(99)}));
+
+    model.neighborhood().binary().update_moves(false, true, true, false, 1);
+    EXPECT_EQ(FLAGGED_VARIABLE_PTRS(),
+              (VariablePtrs{&x(10), &x(70), &x(99)}));
+}
 }  // namespace
 /*****************************************************************************/
 // END
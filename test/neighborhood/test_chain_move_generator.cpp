@@ -38,6 +38,47 @@ TEST_F(TestChainMoveGenerator, register_move) {
     EXPECT_TRUE(model.neighborhood().chain().flags().empty());
 }
 
+/*****************************************************************************/
+TEST_F(TestChainMoveGenerator, register_move_related_constraint_ptrs) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variable("x", 0, 1);
+    auto& y = model.create_variable("y", 0, 1);
+    auto& z = model.create_variable("z", 0, 1);
+
+    auto& g = model.create_constraint("g", x + y <= 1);
+    auto& h = model.create_constraint("h", y + z <= 1);
+    auto& v = model.create_constraint("v", x + z <= 1);
+
+    model.setup_unique_names();
+    model.setup_structure();
+
+    neighborhood::Move<int, double> move_x;
+    move_x.alterations.emplace_back(&x(0), 1);
+
+    neighborhood::Move<int, double> move_y;
+    move_y.alterations.emplace_back(&y(0), 1);
+
+    auto& chain = model.neighborhood().chain();
+    chain.register_move(move_x + move_y);
+
+    auto& forward_move = chain.moves().back();
+    EXPECT_EQ(3, static_cast<int>(forward_move.related_constraint_ptrs.size()));
+    EXPECT_EQ(&g(0), forward_move.related_constraint_ptrs[0]);
+    EXPECT_EQ(&h(0), forward_move.related_constraint_ptrs[1]);
+    EXPECT_EQ(&v(0), forward_move.related_constraint_ptrs[2]);
+
+    /// The backward move shares the stored related constraints.
+    auto back_move = forward_move;
+    for (auto&& alteration : back_move.alterations) {
+        alteration.second = 1 - alteration.second;
+    }
+    chain.register_move(back_move);
+    EXPECT_EQ(chain.moves()[0].related_constraint_ptrs.data(),
+              chain.moves()[1].related_constraint_ptrs.data());
+    EXPECT_EQ(3, static_cast<int>(chain.related_constraint_ptrs_pool().size()));
+}
+
 /*****************************************************************************/
 TEST_F(TestChainMoveGenerator, clear_moves) {
     /// This method is tested in register_move().
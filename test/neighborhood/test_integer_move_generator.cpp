@@ -101,6 +101,60 @@ TEST_F(TestIntegerMoveGenerator, setup) {
         }
     }
 }
+/*****************************************************************************/
+TEST_F(TestIntegerMoveGenerator, update_moves_improvable) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 20);
+    for (auto i = 0; i < 10; i++) {
+        x(i) = 10;
+    }
+
+    model.setup_unique_names();
+    model.setup_structure();
+    EXPECT_TRUE(model.is_enabled_variable_improvability_table());
+
+    auto integer_variable_ptrs =
+        model.variable_type_reference().integer_variable_ptrs;
+
+    model.neighborhood().integer().setup(integer_variable_ptrs);
+    model.neighborhood().integer().update_moves(true, false, false, false, 1);
+
+    model.reset_variable_objective_improvabilities();
+    model.reset_variable_feasibility_improvabilities();
+    x(3).set_is_objective_improvable(true);
+    x(5).set_is_feasibility_improvable(true);
+
+    auto& moves = model.neighborhood().integer().moves();
+    auto& flags = model.neighborhood().integer().flags();
+
+    x(3) = 20;
+    model.neighborhood().integer().update_moves(false, true, false, false, 1);
+    for (auto i = 0; i < 10; i++) {
+        if (i != 3) {
+            for (auto j = 0; j < 4; j++) {
+                EXPECT_EQ(0, flags[4 * i + j]);
+            }
+        }
+    }
+    EXPECT_EQ(0, flags[12]);
+    EXPECT_EQ(1, flags[13]);
+    EXPECT_EQ(19, moves[13].alterations.front().second);
+    EXPECT_EQ(0, flags[14]);
+    EXPECT_EQ(1, flags[15]);
+    EXPECT_EQ(10, moves[15].alterations.front().second);
+
+    model.neighborhood().integer().update_moves(false, false, true, false, 1);
+    for (auto i = 0; i < 10; i++) {
+        for (auto j = 0; j < 4; j++) {
+            EXPECT_EQ(i == 5 ? 1 : 0, flags[4 * i + j]);
+        }
+    }
+    EXPECT_EQ(11, moves[20].alterations.front().second);
+    EXPECT_EQ(9, moves[21].alterations.front().second);
+    EXPECT_EQ(15, moves[22].alterations.front().second);
+    EXPECT_EQ(5, moves[23].alterations.front().second);
+}
 }  // namespace
 /*****************************************************************************/
 // END
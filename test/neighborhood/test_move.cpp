@@ -375,7 +375,7 @@ TEST_F(TestMove, operator_plus) {
     auto move_x_y = move_x + move_y;
     EXPECT_FALSE(move_x_y.has_duplicate_variable());
     EXPECT_EQ(2, static_cast<int>(move_x_y.alterations.size()));
-    EXPECT_EQ(3, static_cast<int>(move_x_y.related_constraint_ptrs.size()));
+    EXPECT_TRUE(move_x_y.related_constraint_ptrs.empty());
     EXPECT_EQ(neighborhood::MoveSense::Chain, move_x_y.sense);
 
     EXPECT_EQ(variable_ptrs[0], move_x_y.alterations[0].first);
@@ -388,7 +388,7 @@ TEST_F(TestMove, operator_plus) {
     auto move_x_y_z = move_x_y + move_z;
     EXPECT_FALSE(move_x_y_z.has_duplicate_variable());
     EXPECT_EQ(3, static_cast<int>(move_x_y_z.alterations.size()));
-    EXPECT_EQ(3, static_cast<int>(move_x_y_z.related_constraint_ptrs.size()));
+    EXPECT_TRUE(move_x_y_z.related_constraint_ptrs.empty());
     EXPECT_EQ(neighborhood::MoveSense::Chain, move_x_y_z.sense);
 
     EXPECT_EQ(variable_ptrs[0], move_x_y_z.alterations[0].first);
@@ -404,7 +404,7 @@ TEST_F(TestMove, operator_plus) {
     auto move_x_y_z_z = move_x_y_z + move_z;
     EXPECT_TRUE(move_x_y_z_z.has_duplicate_variable());
     EXPECT_EQ(4, static_cast<int>(move_x_y_z_z.alterations.size()));
-    EXPECT_EQ(3, static_cast<int>(move_x_y_z_z.related_constraint_ptrs.size()));
+    EXPECT_TRUE(move_x_y_z_z.related_constraint_ptrs.empty());
     EXPECT_EQ(neighborhood::MoveSense::Chain, move_x_y_z_z.sense);
 
     EXPECT_EQ(variable_ptrs[0], move_x_y_z_z.alterations[0].first);
@@ -448,7 +448,9 @@ TEST_F(TestMove, operator_equal) {
 
         neighborhood::Move<int, double> move_1;
         move_1.alterations.emplace_back(&variable_0, 1);
-        move_1.related_constraint_ptrs.push_back(&constraint);
+        std::vector<model_component::Constraint<int, double>*>
+            constraint_ptrs = {&constraint};
+        move_1.related_constraint_ptrs = constraint_ptrs;
 
         EXPECT_FALSE(move_0 == move_1);
         EXPECT_TRUE(move_0 != move_1);
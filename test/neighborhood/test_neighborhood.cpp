@@ -0,0 +1,84 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestNeighborhood : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestNeighborhood, update_moves) {
+    model::Model<int, double> model;
+
+    /// The moves are divided into several blocks.
+    const int VARIABLES_SIZE =
+        2 * neighborhood::NeighborhoodConstant::MOVE_BLOCK_SIZE + 10;
+    auto& x = model.create_variables("x", VARIABLES_SIZE, 0, 1);
+    auto& y = model.create_variables("y", 10, 0, 10);
+
+    model.setup_unique_names();
+    model.setup_structure();
+
+    auto& neighborhood = model.neighborhood();
+    neighborhood.binary().setup(
+        model.variable_type_reference().binary_variable_ptrs);
+    neighborhood.integer().setup(
+        model.variable_type_reference().integer_variable_ptrs);
+    neighborhood.binary().enable();
+    neighborhood.integer().enable();
+
+    auto expected_move_ptrs = [&neighborhood](void) {
+        std::vector<neighborhood::Move<int, double>*> move_ptrs;
+        for (auto&& move_generator_ptr :
+             std::vector<neighborhood::AbstractMoveGenerator<int, double>*>{
+                 &neighborhood.binary(), &neighborhood.integer()}) {
+            auto&     moves      = move_generator_ptr->moves();
+            const int MOVES_SIZE = moves.size();
+            for (auto i = 0; i < MOVES_SIZE; i++) {
+                if (move_generator_ptr->flags()[i]) {
+                    move_ptrs.push_back(&moves[i]);
+                }
+            }
+        }
+        return move_ptrs;
+    };
+
+    neighborhood.update_moves(true, false, false, false, 1);
+
+    const int BINARY_MOVES_SIZE  = neighborhood.binary().moves().size();
+    const int INTEGER_MOVES_SIZE = neighborhood.integer().moves().size();
+    EXPECT_EQ(VARIABLES_SIZE, BINARY_MOVES_SIZE);
+    EXPECT_EQ(BINARY_MOVES_SIZE + INTEGER_MOVES_SIZE,
+              neighborhood.number_of_updated_moves());
+    EXPECT_EQ(expected_move_ptrs(), neighborhood.move_ptrs());
+
+    /// Only the moves of the improvable variables are extracted.
+    model.reset_variable_objective_improvabilities();
+    model.reset_variable_feasibility_improvabilities();
+    for (auto i = 0; i < VARIABLES_SIZE; i += 3) {
+        x(i).set_is_objective_improvable(true);
+    }
+    y(0).set_is_objective_improvable(true);
+
+    neighborhood.update_moves(false, true, false, false, 1);
+    EXPECT_EQ((VARIABLES_SIZE + 2) / 3 + 2,
+              static_cast<int>(neighborhood.move_ptrs().size()));
+    EXPECT_EQ(expected_move_ptrs(), neighborhood.move_ptrs());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -65,6 +65,62 @@ TEST_F(TestUserDefinedMoveGenerator, setup) {
         }
     }
 }
+
+/*****************************************************************************/
+TEST_F(TestUserDefinedMoveGenerator, related_constraint_ptrs) {
+    model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& c = model.create_constraints("c", 2);
+    c(0)    = x(0) + x(1) <= 1;
+    c(1)    = x(1) + x(2) <= 1;
+
+    model.setup_structure();
+
+    auto move_updater =
+        [&x](std::vector<neighborhood::Move<int, double>>* a_moves_ptr) {
+            a_moves_ptr->resize(3);
+            for (auto&& move : *a_moves_ptr) {
+                move.sense = neighborhood::MoveSense::UserDefined;
+                move.alterations.clear();
+            }
+            (*a_moves_ptr)[0].alterations.emplace_back(&x(0), 1);
+            (*a_moves_ptr)[1].alterations.emplace_back(&x(1), 1);
+            (*a_moves_ptr)[1].alterations.emplace_back(&x(2), 1);
+            (*a_moves_ptr)[2].alterations.emplace_back(&x(0), 1);
+            (*a_moves_ptr)[2].alterations.emplace_back(&x(2), 1);
+        };
+
+    model.neighborhood().user_defined().set_move_updater(move_updater);
+    model.neighborhood().user_defined().setup();
+    model.neighborhood().user_defined().update_moves(true, false, false, false,
+                                                     1);
+
+    auto& moves = model.neighborhood().user_defined().moves();
+    EXPECT_EQ(3, static_cast<int>(moves.size()));
+
+    /// x(0)
+    EXPECT_EQ(1, static_cast<int>(moves[0].related_constraint_ptrs.size()));
+    EXPECT_EQ(&c(0), moves[0].related_constraint_ptrs[0]);
+
+    /// x(1), x(2): c(1) is listed only once.
+    EXPECT_EQ(2, static_cast<int>(moves[1].related_constraint_ptrs.size()));
+    EXPECT_TRUE(std::find(moves[1].related_constraint_ptrs.begin(),
+                          moves[1].related_constraint_ptrs.end(),
+                          &c(0)) != moves[1].related_constraint_ptrs.end());
+    EXPECT_TRUE(std::find(moves[1].related_constraint_ptrs.begin(),
+                          moves[1].related_constraint_ptrs.end(),
+                          &c(1)) != moves[1].related_constraint_ptrs.end());
+
+    /// x(0), x(2)
+    EXPECT_EQ(2, static_cast<int>(moves[2].related_constraint_ptrs.size()));
+    EXPECT_TRUE(std::find(moves[2].related_constraint_ptrs.begin(),
+                          moves[2].related_constraint_ptrs.end(),
+                          &c(0)) != moves[2].related_constraint_ptrs.end());
+    EXPECT_TRUE(std::find(moves[2].related_constraint_ptrs.begin(),
+                          moves[2].related_constraint_ptrs.end(),
+                          &c(1)) != moves[2].related_constraint_ptrs.end());
+}
 }  // namespace
 /*****************************************************************************/
 // END
@@ -0,0 +1,38 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestMoveSelectionMode : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMoveSelectionMode, MoveSelectionModeMap) {
+    using namespace printemps::option::move_selection_mode;
+    EXPECT_EQ(Scan, MoveSelectionModeMap.at("Scan"));
+    EXPECT_EQ(Reduction, MoveSelectionModeMap.at("Reduction"));
+}
+
+/*****************************************************************************/
+TEST_F(TestMoveSelectionMode, MoveSelectionModeInverseMap) {
+    using namespace printemps::option::move_selection_mode;
+    EXPECT_EQ("Scan", MoveSelectionModeInverseMap.at(Scan));
+    EXPECT_EQ("Reduction", MoveSelectionModeInverseMap.at(Reduction));
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -484,6 +484,10 @@ TEST_F(TestOption, setup) {
             0.1,          //
             option.tabu_search.move_preserve_rate);
 
+        EXPECT_EQ(                           //
+            move_selection_mode::Reduction,  //
+            option.tabu_search.move_selection_mode);
+
         EXPECT_FLOAT_EQ(  //
             0.1,          //
             option.tabu_search.frequency_penalty_coefficient);
@@ -520,6 +524,10 @@ TEST_F(TestOption, setup) {
             false,  //
             option.tabu_search.is_enabled_initial_modification);
 
+        EXPECT_EQ(  //
+            true,   //
+            option.tabu_search.is_enabled_incremental_evaluation);
+
         EXPECT_EQ(  //
             1,      //
             option.tabu_search.intensity_increase_count_threshold);
@@ -577,6 +585,10 @@ TEST_F(TestOption, setup) {
         EXPECT_FLOAT_EQ(     //
             tabu_mode::All,  //
             option.tabu_search.tabu_mode);
+
+        EXPECT_EQ(                      //
+            move_selection_mode::Scan,  //
+            option.tabu_search.move_selection_mode);
     }
 
     {
@@ -607,6 +619,10 @@ TEST_F(TestOption, setup) {
         EXPECT_FLOAT_EQ(     //
             tabu_mode::Any,  //
             option.tabu_search.tabu_mode);
+
+        EXPECT_EQ(                           //
+            move_selection_mode::Reduction,  //
+            option.tabu_search.move_selection_mode);
     }
 }
 
@@ -975,6 +991,10 @@ TEST_F(TestOption, to_json) {
         0.1,          //
         to_double(tabu_search.at("move_preserve_rate")));
 
+    EXPECT_EQ(        //
+        "Reduction",  //
+        to_str(tabu_search.at("move_selection_mode")));
+
     EXPECT_FLOAT_EQ(  //
         0.1,          //
         to_double(tabu_search.at("frequency_penalty_coefficient")));
@@ -1011,6 +1031,10 @@ TEST_F(TestOption, to_json) {
         false,  //
         to_bool(tabu_search.at("is_enabled_initial_modification")));
 
+    EXPECT_EQ(  //
+        true,   //
+        to_bool(tabu_search.at("is_enabled_incremental_evaluation")));
+
     EXPECT_EQ(  //
         1,      //
         to_int(tabu_search.at("intensity_increase_count_threshold")));
@@ -50,6 +50,10 @@ TEST_F(TestParallelOption, initialize) {
         ParallelOptionConstant::
             DEFAULT_THREAD_COUNT_OPTIMIZATION_DECAY_FACTOR,  //
         option.thread_count_optimization_decay_factor);
+
+    EXPECT_EQ(                                              //
+        ParallelOptionConstant::DEFAULT_NUMBER_OF_WALKERS,  //
+        option.number_of_walkers);
 }
 
 }  // namespace
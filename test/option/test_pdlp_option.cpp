@@ -82,6 +82,14 @@ TEST_F(TestPDLPOption, initialize) {
     EXPECT_EQ(                                     //
         PDLPOptionConstant::DEFAULT_LOG_INTERVAL,  //
         option.log_interval);
+
+    EXPECT_EQ(                                                   //
+        PDLPOptionConstant::DEFAULT_IS_ENABLED_MIXED_PRECISION,  //
+        option.is_enabled_mixed_precision);
+
+    EXPECT_FLOAT_EQ(                                                   //
+        PDLPOptionConstant::DEFAULT_MIXED_PRECISION_SWITCH_TOLERANCE,  //
+        option.mixed_precision_switch_tolerance);
 }
 
 }  // namespace
@@ -697,6 +697,106 @@ TEST_F(TestReadJson, read_json_int_tabu_mode) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestReadJson, read_json_int_move_selection_mode) {
+    using namespace printemps;
+    {
+        utility::json::JsonObject object;
+        std::string               key       = "move_selection_mode";
+        std::string               wrong_key = "wrong";
+
+        object.emplace_back(key, 0);  // Scan
+
+        option::move_selection_mode::MoveSelectionMode parameter;
+        EXPECT_TRUE(option::read_json(&parameter, key, object));
+        EXPECT_EQ(option::move_selection_mode::Scan, parameter);
+
+        EXPECT_FALSE(option::read_json(&parameter, wrong_key, object));
+        EXPECT_EQ(option::move_selection_mode::Scan, parameter);
+    }
+
+    {
+        utility::json::JsonObject object;
+        std::string               key       = "move_selection_mode";
+        std::string               wrong_key = "wrong";
+
+        object.emplace_back(key, 1);  // Reduction
+
+        option::move_selection_mode::MoveSelectionMode parameter;
+        EXPECT_TRUE(option::read_json(&parameter, key, object));
+        EXPECT_EQ(option::move_selection_mode::Reduction, parameter);
+
+        EXPECT_FALSE(option::read_json(&parameter, wrong_key, object));
+        EXPECT_EQ(option::move_selection_mode::Reduction, parameter);
+    }
+
+    {
+        utility::json::JsonObject object;
+        std::string               key       = "move_selection_mode";
+        std::string               wrong_key = "wrong";
+
+        object.emplace_back(key, std::string("Scan"));
+
+        option::move_selection_mode::MoveSelectionMode parameter;
+        EXPECT_TRUE(option::read_json(&parameter, key, object));
+        EXPECT_EQ(option::move_selection_mode::Scan, parameter);
+
+        EXPECT_FALSE(option::read_json(&parameter, wrong_key, object));
+        EXPECT_EQ(option::move_selection_mode::Scan, parameter);
+    }
+
+    {
+        utility::json::JsonObject object;
+        std::string               key       = "move_selection_mode";
+        std::string               wrong_key = "wrong";
+
+        object.emplace_back(key, std::string("Reduction"));
+
+        option::move_selection_mode::MoveSelectionMode parameter;
+        EXPECT_TRUE(option::read_json(&parameter, key, object));
+        EXPECT_EQ(option::move_selection_mode::Reduction, parameter);
+
+        EXPECT_FALSE(option::read_json(&parameter, wrong_key, object));
+        EXPECT_EQ(option::move_selection_mode::Reduction, parameter);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestReadJson, read_json_value) {
+    using namespace printemps;
+    utility::json::JsonDocument document;
+
+    const auto &OBJECT = document.parse(
+        "{\"int\": 1, \"double\": 2.5, \"bool\": true, \"string\": "
+        "\"hoge\", \"verbose\": \"Full\", \"tabu_mode\": 1}");
+
+    double double_parameter = 0.0;
+    EXPECT_TRUE(option::read_json(&double_parameter, "int", OBJECT));
+    EXPECT_FLOAT_EQ(1.0, double_parameter);
+    EXPECT_TRUE(option::read_json(&double_parameter, "double", OBJECT));
+    EXPECT_FLOAT_EQ(2.5, double_parameter);
+
+    int int_parameter = 0;
+    EXPECT_TRUE(option::read_json(&int_parameter, "int", OBJECT));
+    EXPECT_EQ(1, int_parameter);
+    EXPECT_FALSE(option::read_json(&int_parameter, "wrong", OBJECT));
+
+    bool bool_parameter = false;
+    EXPECT_TRUE(option::read_json(&bool_parameter, "bool", OBJECT));
+    EXPECT_TRUE(bool_parameter);
+
+    std::string string_parameter;
+    EXPECT_TRUE(option::read_json(&string_parameter, "string", OBJECT));
+    EXPECT_EQ("hoge", string_parameter);
+
+    option::verbose::Verbose verbose = option::verbose::Off;
+    EXPECT_TRUE(option::read_json(&verbose, "verbose", OBJECT));
+    EXPECT_EQ(option::verbose::Full, verbose);
+
+    option::tabu_mode::TabuMode tabu_mode = option::tabu_mode::All;
+    EXPECT_TRUE(option::read_json(&tabu_mode, "tabu_mode", OBJECT));
+    EXPECT_EQ(option::tabu_mode::Any, tabu_mode);
+}
 }  // namespace
 /*****************************************************************************/
 // END
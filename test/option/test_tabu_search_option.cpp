@@ -64,6 +64,10 @@ TEST_F(TestTabuSearchOption, initialize) {
         TabuSearchOptionConstant::DEFAULT_MOVE_PRESERVE_RATE,  //
         option.move_preserve_rate);
 
+    EXPECT_EQ(                                                  //
+        TabuSearchOptionConstant::DEFAULT_MOVE_SELECTION_MODE,  //
+        option.move_selection_mode);
+
     EXPECT_FLOAT_EQ(                                                      //
         TabuSearchOptionConstant::DEFAULT_FREQUENCY_PENALTY_COEFFICIENT,  //
         option.frequency_penalty_coefficient);
@@ -102,6 +106,11 @@ TEST_F(TestTabuSearchOption, initialize) {
         TabuSearchOptionConstant::DEFAULT_IS_ENABLED_INITIAL_MODIFICATION,  //
         option.is_enabled_initial_modification);
 
+    EXPECT_EQ(  //
+        TabuSearchOptionConstant::
+            DEFAULT_IS_ENABLED_INCREMENTAL_EVALUATION,  //
+        option.is_enabled_incremental_evaluation);
+
     EXPECT_EQ(  //
         TabuSearchOptionConstant::
             DEFAULT_INTENSITY_INCREASE_COUNT_THRESHOLD,  //
@@ -572,6 +572,100 @@ TEST_F(TestProblemSizeReducer,
         EXPECT_EQ(-2, x.upper_bound());
         EXPECT_TRUE(g.is_enabled());
     }
+    {
+        /// The bounds tightened by different constraints in a round are
+        /// merged.
+        model::Model<int, double> model;
+
+        auto& x   = model.create_variable("x", -10, 10);
+        auto& g_0 = model.create_constraint("g_0", 3 * x <= 10);
+        auto& g_1 = model.create_constraint("g_1", 8 * x >= 20);
+
+        preprocess::ProblemSizeReducer<int, double>  //
+                  problem_size_reducer(&model);
+        const int NUMBER_OF_NEWLY_DISABLED_CONSTRAINTS =
+            problem_size_reducer
+                .remove_redundant_constraints_with_tightening_variable_bounds(
+                    false);
+
+        EXPECT_EQ(2, NUMBER_OF_NEWLY_DISABLED_CONSTRAINTS);
+        EXPECT_EQ(2, problem_size_reducer
+                         .variable_bound_update_count_in_preprocess());
+        EXPECT_FALSE(x.is_fixed());
+        EXPECT_EQ(3, x.lower_bound());
+        EXPECT_EQ(3, x.upper_bound());
+        EXPECT_FALSE(g_0.is_enabled());
+        EXPECT_FALSE(g_1.is_enabled());
+    }
+    {
+        /// Only the bounds actually changed are counted.
+        model::Model<int, double> model;
+
+        auto& x = model.create_variable("x", -10, 10);
+        model.create_constraint("g_0", 3 * x <= 10);
+        model.create_constraint("g_1", 2 * x <= 7);
+
+        preprocess::ProblemSizeReducer<int, double>  //
+            problem_size_reducer(&model);
+        problem_size_reducer
+            .remove_redundant_constraints_with_tightening_variable_bounds(
+                false);
+
+        EXPECT_EQ(1, problem_size_reducer
+                         .variable_bound_update_count_in_preprocess());
+        EXPECT_EQ(3, x.upper_bound());
+    }
+    {
+        /// The consistent fixings of a variable are merged.
+        model::Model<int, double> model;
+
+        auto& x = model.create_variable("x", -10, 10);
+        x(0).set_id(5);
+        model.create_constraint("g_0", 2 * x == 4);
+        model.create_constraint("g_1", x <= 3);
+
+        preprocess::ProblemSizeReducer<int, double>  //
+            problem_size_reducer(&model);
+        problem_size_reducer
+            .remove_redundant_constraints_with_tightening_variable_bounds(
+                false);
+
+        EXPECT_TRUE(x.is_fixed());
+        EXPECT_EQ(2, x.value());
+        EXPECT_EQ(5, x(0).id());
+    }
+    {
+        /// The conflicting fixings of a variable are infeasible.
+        model::Model<int, double> model;
+
+        auto& x = model.create_variable("x", -10, 10);
+        model.create_constraint("g_0", x == 2);
+        model.create_constraint("g_1", x == 3);
+
+        preprocess::ProblemSizeReducer<int, double>  //
+            problem_size_reducer(&model);
+        ASSERT_THROW(
+            problem_size_reducer
+                .remove_redundant_constraints_with_tightening_variable_bounds(
+                    false),
+            model_component::InfeasibleError);
+    }
+    {
+        /// The fixing out of the merged bounds is infeasible.
+        model::Model<int, double> model;
+
+        auto& x = model.create_variable("x", -10, 10);
+        model.create_constraint("g_0", x == 5);
+        model.create_constraint("g_1", x <= 3);
+
+        preprocess::ProblemSizeReducer<int, double>  //
+            problem_size_reducer(&model);
+        ASSERT_THROW(
+            problem_size_reducer
+                .remove_redundant_constraints_with_tightening_variable_bounds(
+                    false),
+            model_component::InfeasibleError);
+    }
 }
 
 /*****************************************************************************/
@@ -664,6 +758,23 @@ TEST_F(TestProblemSizeReducer, reduce_problem_size) {
         EXPECT_TRUE(x(i).is_fixed());
         EXPECT_EQ(-10, x(i).value());
     }
+
+    const auto& ELAPSED_TIMES = problem_size_reducer.elapsed_times();
+    EXPECT_EQ(3, static_cast<int>(ELAPSED_TIMES.size()));
+    EXPECT_EQ("remove_independent_variables", ELAPSED_TIMES[0].first);
+    EXPECT_EQ("remove_redundant_constraints_with_tightening_variable_bounds",
+              ELAPSED_TIMES[1].first);
+    EXPECT_EQ("remove_implicit_fixed_variables", ELAPSED_TIMES[2].first);
+    for (const auto& elapsed_time : ELAPSED_TIMES) {
+        EXPECT_GE(elapsed_time.second, 0.0);
+    }
+
+    /// The elapsed times during the optimization are not recorded.
+    const double ELAPSED_TIME = ELAPSED_TIMES[2].second;
+    problem_size_reducer.set_is_preprocess(false);
+    problem_size_reducer.remove_implicit_fixed_variables(false);
+    EXPECT_EQ(3, static_cast<int>(ELAPSED_TIMES.size()));
+    EXPECT_EQ(ELAPSED_TIME, ELAPSED_TIMES[2].second);
 }
 }  // namespace
 /*****************************************************************************/
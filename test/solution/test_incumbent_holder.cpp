@@ -267,6 +267,57 @@ TEST_F(TestIncumbentHolder, try_update_incumbent_arg_solution) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestIncumbentHolder, merge) {
+    solution::IncumbentHolder<int, double> incumbent_holder;
+    solution::IncumbentHolder<int, double> other;
+
+    {
+        solution::DenseSolution<int, double> solution;
+        solution.objective = 100.0;
+
+        solution::SolutionScore score;
+        score.is_feasible                = false;
+        score.objective                  = 100.0;
+        score.local_augmented_objective  = 100.0;
+        score.global_augmented_objective = 300.0;
+        incumbent_holder.try_update_incumbent(solution, score);
+    }
+
+    {
+        solution::DenseSolution<int, double> solution;
+        solution.objective = 50.0;
+
+        solution::SolutionScore score;
+        score.is_feasible                = true;
+        score.objective                  = 50.0;
+        score.local_augmented_objective  = 200.0;
+        score.global_augmented_objective = 200.0;
+        other.try_update_incumbent(solution, score);
+    }
+
+    auto status = incumbent_holder.merge(other);
+    EXPECT_EQ(6, status);
+
+    /// The local augmented incumbent is not merged.
+    EXPECT_FLOAT_EQ(  //
+        100.0,        //
+        incumbent_holder.local_augmented_incumbent_objective());
+    EXPECT_FLOAT_EQ(  //
+        200.0,        //
+        incumbent_holder.global_augmented_incumbent_objective());
+    EXPECT_FLOAT_EQ(  //
+        50.0,         //
+        incumbent_holder.feasible_incumbent_objective());
+    EXPECT_FLOAT_EQ(  //
+        50.0,         //
+        incumbent_holder.feasible_incumbent_solution().objective);
+    EXPECT_TRUE(incumbent_holder.is_found_feasible_solution());
+
+    /// Merging the same holder again does not update anything.
+    EXPECT_EQ(0, incumbent_holder.merge(other));
+}
+
 /*****************************************************************************/
 TEST_F(TestIncumbentHolder, reset_local_augmented_incumbent) {
     solution::IncumbentHolder<int, double> incumbent_holder;
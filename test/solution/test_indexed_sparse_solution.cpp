@@ -0,0 +1,131 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestIndexedSparseSolution : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, constructor) {
+    solution::IndexedSparseSolution<int, double> solution;
+
+    EXPECT_FLOAT_EQ(0.0, solution.objective);
+    EXPECT_FLOAT_EQ(0.0, solution.total_violation);
+    EXPECT_FLOAT_EQ(0.0, solution.global_augmented_objective);
+    EXPECT_FALSE(solution.is_feasible);
+    EXPECT_TRUE(solution.variable_ids.empty());
+    EXPECT_TRUE(solution.variable_values.empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, initialize) {
+    solution::IndexedSparseSolution<int, double> solution;
+    solution.objective       = 100.0;
+    solution.total_violation = 1000.0;
+    solution.is_feasible     = true;
+    solution.variable_ids    = {0, 2};
+    solution.variable_values = {1, 2};
+
+    solution.initialize();
+
+    EXPECT_FLOAT_EQ(0.0, solution.objective);
+    EXPECT_FLOAT_EQ(0.0, solution.total_violation);
+    EXPECT_FALSE(solution.is_feasible);
+    EXPECT_TRUE(solution.variable_ids.empty());
+    EXPECT_TRUE(solution.variable_values.empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, number_of_nonzeros) {
+    solution::IndexedSparseSolution<int, double> solution;
+    solution.variable_ids    = {0, 2, 5};
+    solution.variable_values = {1, 2, 3};
+
+    EXPECT_EQ(3, solution.number_of_nonzeros());
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, has_same_variables) {
+    solution::IndexedSparseSolution<int, double> solution_0;
+    solution::IndexedSparseSolution<int, double> solution_1;
+    solution::IndexedSparseSolution<int, double> solution_2;
+
+    solution_0.variable_ids    = {0, 2, 5};
+    solution_0.variable_values = {1, 2, 3};
+    solution_1.variable_ids    = {0, 2, 5};
+    solution_1.variable_values = {1, 2, 3};
+    solution_2.variable_ids    = {0, 2, 5};
+    solution_2.variable_values = {1, 2, 4};
+
+    EXPECT_TRUE(solution_0.has_same_variables(solution_1));
+    EXPECT_FALSE(solution_0.has_same_variables(solution_2));
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, compute_hash) {
+    solution::IndexedSparseSolution<int, double> solution_0;
+    solution::IndexedSparseSolution<int, double> solution_1;
+    solution::IndexedSparseSolution<int, double> solution_2;
+
+    solution_0.variable_ids    = {0, 1, 2};
+    solution_0.variable_values = {1, 2, 3};
+    solution_1.variable_ids    = {0, 1, 2};
+    solution_1.variable_values = {1, 2, 3};
+    solution_2.variable_ids    = {0, 1, 2};
+    solution_2.variable_values = {2, 1, 3};
+
+    EXPECT_EQ(solution_0.compute_hash(), solution_1.compute_hash());
+    EXPECT_NE(solution_0.compute_hash(), solution_2.compute_hash());
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, distance) {
+    solution::IndexedSparseSolution<int, double> solution_0;
+    solution::IndexedSparseSolution<int, double> solution_1;
+
+    /// x0 = 1, x1 = 2, x2 = 3, x3 = 4
+    solution_0.variable_ids    = {0, 1, 2, 3};
+    solution_0.variable_values = {1, 2, 3, 4};
+
+    /// x0 = 1, x1 = 3, x3 = 4, x5 = 5
+    solution_1.variable_ids    = {0, 1, 3, 5};
+    solution_1.variable_values = {1, 3, 4, 5};
+
+    EXPECT_EQ(3, solution_0.distance(solution_1));
+    EXPECT_EQ(3, solution_1.distance(solution_0));
+    EXPECT_EQ(0, solution_0.distance(solution_0));
+}
+
+/*****************************************************************************/
+TEST_F(TestIndexedSparseSolution, support_distance) {
+    solution::IndexedSparseSolution<int, double> solution_0;
+    solution::IndexedSparseSolution<int, double> solution_1;
+
+    solution_0.variable_ids    = {0, 1, 2, 3};
+    solution_0.variable_values = {1, 2, 3, 4};
+
+    solution_1.variable_ids    = {0, 1, 3, 5};
+    solution_1.variable_values = {1, 3, 4, 5};
+
+    EXPECT_EQ(2, solution_0.support_distance(solution_1));
+    EXPECT_EQ(2, solution_1.support_distance(solution_0));
+    EXPECT_EQ(0, solution_0.support_distance(solution_0));
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
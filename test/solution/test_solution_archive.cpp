@@ -143,6 +143,135 @@ TEST_F(TestSolutionArchive, push) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestSolutionArchive, push_duplicate) {
+    solution::SparseSolution<int, double> solution_0;
+    solution_0.objective        = 10;
+    solution_0.variables["x_0"] = 0;
+    solution_0.variables["x_1"] = 1;
+
+    solution::SparseSolution<int, double> solution_1;
+    solution_1.objective        = 10;
+    solution_1.variables["x_0"] = 1;
+    solution_1.variables["x_1"] = 0;
+
+    solution::SparseSolution<int, double> solution_2;
+    solution_2.objective        = 10;
+    solution_2.variables["x_1"] = 1;
+    solution_2.variables["x_0"] = 0;
+
+    /// The duplicated solutions are removed even if they are not adjacent.
+    {
+        solution::SolutionArchive<int, double>  //
+            archive(10, solution::SortMode::Ascending, "name", 2, 0);
+
+        archive.push({solution_0, solution_1, solution_2});
+        EXPECT_EQ(2, archive.size());
+        EXPECT_EQ(solution_0.variables, archive.solutions()[0].variables);
+        EXPECT_EQ(solution_1.variables, archive.solutions()[1].variables);
+    }
+    {
+        solution::SolutionArchive<int, double>  //
+            archive(10, solution::SortMode::Off, "name", 2, 0);
+
+        archive.push(solution_0);
+        archive.push(solution_1);
+        archive.push(solution_2);
+        EXPECT_EQ(2, archive.size());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSolutionArchive, push_archive) {
+    std::vector<solution::SparseSolution<int, double>> solutions(6);
+    for (auto i = 0; i < 6; i++) {
+        solutions[i].objective        = (i * 5) % 6;
+        solutions[i].variables["x_0"] = i;
+    }
+
+    solution::SolutionArchive<int, double>  //
+        archive_0(4, solution::SortMode::Ascending, "name", 1, 0);
+    archive_0.push(std::vector<solution::SparseSolution<int, double>>(
+        solutions.begin(), solutions.begin() + 3));
+
+    solution::SolutionArchive<int, double>  //
+        archive_1(4, solution::SortMode::Ascending, "name", 1, 0);
+    archive_1.push(solutions);
+    archive_1.push(archive_0);
+
+    /// The solutions pushed twice are deduplicated.
+    EXPECT_EQ(4, archive_1.size());
+    for (auto i = 0; i < 4; i++) {
+        EXPECT_EQ(i, archive_1.solutions()[i].objective);
+    }
+
+    /// The copied archive keeps its own hash index.
+    auto archive_2 = archive_1;
+    archive_2.push(solutions[0]);
+    EXPECT_EQ(4, archive_2.size());
+    archive_1.initialize();
+    EXPECT_EQ(4, archive_2.size());
+    EXPECT_EQ(3, archive_2.solutions()[3].objective);
+}
+
+/*****************************************************************************/
+TEST_F(TestSolutionArchive, solutions) {
+    solution::SolutionArchive<int, double>  //
+        archive(3, solution::SortMode::Off, "name", 1, 0);
+
+    std::vector<solution::SparseSolution<int, double>> solutions(5);
+    for (auto i = 0; i < 5; i++) {
+        solutions[i].objective        = 5 - i;
+        solutions[i].variables["x_0"] = i;
+    }
+
+    /// The solutions are kept in the order of insertion.
+    archive.push(solutions[0]);
+    archive.push(solutions[1]);
+    EXPECT_EQ(2, static_cast<int>(archive.solutions().size()));
+    archive.push(solutions[2]);
+    EXPECT_EQ(3, static_cast<int>(archive.solutions().size()));
+    EXPECT_EQ(5, archive.solutions()[0].objective);
+    EXPECT_EQ(3, archive.solutions()[2].objective);
+
+    /// The oldest solution is discarded if the archive is full.
+    archive.push(solutions[3]);
+    archive.push(solutions[4]);
+    EXPECT_EQ(3, static_cast<int>(archive.solutions().size()));
+    EXPECT_EQ(3, archive.solutions()[0].objective);
+    EXPECT_EQ(2, archive.solutions()[1].objective);
+    EXPECT_EQ(1, archive.solutions()[2].objective);
+
+    /// The discarded solution can be pushed again.
+    archive.push(solutions[0]);
+    EXPECT_EQ(5, archive.solutions()[2].objective);
+}
+
+/*****************************************************************************/
+TEST_F(TestSolutionArchive, remove_infeasible_solutions) {
+    std::vector<solution::SparseSolution<int, double>> solutions(4);
+    for (auto i = 0; i < 4; i++) {
+        solutions[i].objective        = i;
+        solutions[i].is_feasible      = (i % 2 == 0);
+        solutions[i].variables["x_0"] = i;
+    }
+
+    solution::SolutionArchive<int, double>  //
+        archive(10, solution::SortMode::Ascending, "name", 1, 0);
+    archive.push(solutions);
+    EXPECT_EQ(4, archive.size());
+
+    archive.remove_infeasible_solutions();
+    EXPECT_EQ(2, archive.size());
+    EXPECT_EQ(0, archive.solutions()[0].objective);
+    EXPECT_EQ(2, archive.solutions()[1].objective);
+
+    /// The removed solutions can be pushed again.
+    archive.push(solutions[1]);
+    EXPECT_EQ(3, archive.size());
+    EXPECT_EQ(1, archive.solutions()[1].objective);
+}
+
 /*****************************************************************************/
 TEST_F(TestSolutionArchive, size) {
     /// This method is tested in push();
@@ -158,11 +287,6 @@ TEST_F(TestSolutionArchive, is_ascending) {
     /// This method is tested in setup().
 }
 
-/*****************************************************************************/
-TEST_F(TestSolutionArchive, solutions) {
-    /// This method is tested in push().
-}
-
 /*****************************************************************************/
 TEST_F(TestSolutionArchive, name) {
     /// This method is tested in setup().
@@ -63,6 +63,29 @@ TEST_F(TestSparseSolution, distance) {
     EXPECT_EQ(2, solution_1.distance(solution_0));
 }
 
+/*****************************************************************************/
+TEST_F(TestSparseSolution, compute_hash) {
+    solution::SparseSolution<int, double> solution_0;
+    solution::SparseSolution<int, double> solution_1;
+    solution::SparseSolution<int, double> solution_2;
+
+    /// The hash does not depend on the insertion order.
+    solution_0.variables["x"] = 1;
+    solution_0.variables["y"] = 2;
+    solution_0.variables["z"] = 3;
+
+    solution_1.variables["z"] = 3;
+    solution_1.variables["y"] = 2;
+    solution_1.variables["x"] = 1;
+
+    solution_2.variables["x"] = 2;
+    solution_2.variables["y"] = 1;
+    solution_2.variables["z"] = 3;
+
+    EXPECT_EQ(solution_0.compute_hash(), solution_1.compute_hash());
+    EXPECT_NE(solution_0.compute_hash(), solution_2.compute_hash());
+}
+
 }  // namespace
 /*****************************************************************************/
 // END
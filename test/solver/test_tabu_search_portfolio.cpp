@@ -0,0 +1,352 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestTabuSearchPortfolio : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    static void setup_global_state(
+        model::Model<int, double>*          a_model_ptr,
+        solver::GlobalState<int, double>*   a_global_state_ptr,
+        const option::Option&               a_OPTION) {
+        if (a_OPTION.neighborhood.is_enabled_binary_move) {
+            a_model_ptr->neighborhood().binary().enable();
+        }
+
+        for (auto&& proxy : a_model_ptr->constraint_proxies()) {
+            for (auto&& constraint : proxy.flat_indexed_constraints()) {
+                constraint.reset_local_penalty_coefficient();
+            }
+        }
+
+        a_global_state_ptr->memory.setup(a_model_ptr);
+        a_global_state_ptr->feasible_solution_archive.setup(
+            a_OPTION.output.feasible_solutions_capacity,  //
+            solution::SortMode::Ascending,                //
+            a_model_ptr->name(),                          //
+            a_model_ptr->number_of_variables(),           //
+            a_model_ptr->number_of_constraints());
+        a_global_state_ptr->incumbent_solution_archive.setup(
+            -1,                                  //
+            solution::SortMode::Off,             //
+            a_model_ptr->name(),                 //
+            a_model_ptr->number_of_variables(),  //
+            a_model_ptr->number_of_constraints());
+        a_global_state_ptr->model_ptr = a_model_ptr;
+
+        a_model_ptr->update();
+        a_global_state_ptr->incumbent_holder.try_update_incumbent(
+            a_model_ptr->export_dense_solution(), a_model_ptr->evaluate({}));
+    }
+
+    /*************************************************************************/
+    static void build_model(model::Model<int, double>* a_model_ptr) {
+        const int NUMBER_OF_ITEMS = 20;
+
+        auto& x = a_model_ptr->create_variables("x", NUMBER_OF_ITEMS, 0, 1);
+        auto& g = a_model_ptr->create_constraints("g", NUMBER_OF_ITEMS - 1);
+        for (auto i = 0; i < NUMBER_OF_ITEMS - 1; i++) {
+            g(i) = x(i) + x(i + 1) >= 1;
+        }
+        std::vector<int> costs(NUMBER_OF_ITEMS);
+        for (auto i = 0; i < NUMBER_OF_ITEMS; i++) {
+            costs[i] = 1 + (i * 7) % 5;
+        }
+        a_model_ptr->minimize(x.dot(costs));
+        for (auto i = 0; i < NUMBER_OF_ITEMS; i++) {
+            x(i) = 0;
+        }
+    }
+
+    /*************************************************************************/
+    static solution::SolutionScore create_feasible_score(
+        const double a_OBJECTIVE) {
+        solution::SolutionScore score;
+        score.is_feasible                = true;
+        score.objective                  = a_OBJECTIVE;
+        score.local_augmented_objective  = a_OBJECTIVE;
+        score.global_augmented_objective = a_OBJECTIVE;
+        return score;
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchPortfolio, initialize) {
+    solver::tabu_search::portfolio::TabuSearchPortfolio<int, double> portfolio;
+    EXPECT_EQ(1, portfolio.number_of_walkers());
+    EXPECT_TRUE(portfolio.walker_ptrs().empty());
+    EXPECT_FALSE(
+        portfolio.shared_incumbent_holder().is_found_feasible_solution());
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchPortfolio, create_walker_option) {
+    using Portfolio =
+        solver::tabu_search::portfolio::TabuSearchPortfolio<int, double>;
+
+    option::Option option;
+    option.general.seed                              = 1;
+    option.tabu_search.seed                          = 2;
+    option.tabu_search.initial_tabu_tenure           = 10;
+    option.penalty.penalty_coefficient_relaxing_rate = 0.9;
+    option.penalty.penalty_coefficient_relaxing_rate_min = 0.0;
+    option.penalty.penalty_coefficient_relaxing_rate_max = 1.0;
+    option.output.verbose                = option::verbose::Full;
+    option.output.is_enabled_write_trend = true;
+
+    /// The parameters are perturbed alternately upward and downward.
+    const std::vector<int>    EXPECTED_TENURES = {13, 8, 16, 6};
+    const std::vector<double> EXPECTED_RATES   = {
+        std::pow(0.9, 1.25), std::pow(0.9, 0.8), std::pow(0.9, 1.5625),
+        std::pow(0.9, 0.64)};
+
+    std::unordered_set<int> tenures;
+    for (auto i = 1; i <= 4; i++) {
+        const auto WALKER_OPTION = Portfolio::create_walker_option(option, i);
+
+        EXPECT_EQ(1 + i, WALKER_OPTION.general.seed);
+        EXPECT_EQ(2 + i, WALKER_OPTION.tabu_search.seed);
+        EXPECT_EQ(EXPECTED_TENURES[i - 1],
+                  WALKER_OPTION.tabu_search.initial_tabu_tenure);
+        EXPECT_FLOAT_EQ(
+            EXPECTED_RATES[i - 1],
+            WALKER_OPTION.penalty.penalty_coefficient_relaxing_rate);
+        EXPECT_EQ(option::verbose::Off, WALKER_OPTION.output.verbose);
+        EXPECT_FALSE(WALKER_OPTION.output.is_enabled_write_trend);
+
+        tenures.insert(WALKER_OPTION.tabu_search.initial_tabu_tenure);
+    }
+    EXPECT_EQ(4, static_cast<int>(tenures.size()));
+
+    /// The relaxing rate is clamped by the bounds.
+    option.penalty.penalty_coefficient_relaxing_rate_min = 0.89;
+    option.penalty.penalty_coefficient_relaxing_rate_max = 0.9;
+    EXPECT_FLOAT_EQ(0.89, Portfolio::create_walker_option(option, 3)
+                              .penalty.penalty_coefficient_relaxing_rate);
+    EXPECT_FLOAT_EQ(0.9, Portfolio::create_walker_option(option, 4)
+                             .penalty.penalty_coefficient_relaxing_rate);
+
+    /// The tabu tenure is at least 1.
+    option.tabu_search.initial_tabu_tenure = 1;
+    EXPECT_EQ(1, Portfolio::create_walker_option(option, 4)
+                     .tabu_search.initial_tabu_tenure);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchPortfolio, synchronize) {
+    solver::tabu_search::portfolio::TabuSearchPortfolio<int, double> portfolio;
+
+    const int NUMBER_OF_STATES = 64;
+
+    std::vector<solver::GlobalState<int, double>> global_states(
+        NUMBER_OF_STATES);
+    for (auto i = 0; i < NUMBER_OF_STATES; i++) {
+        solution::DenseSolution<int, double> solution;
+        solution.objective = NUMBER_OF_STATES - i;
+        global_states[i].incumbent_holder.try_update_incumbent(
+            solution, create_feasible_score(NUMBER_OF_STATES - i));
+    }
+
+    /**
+     * The walkers push and pull the incumbents concurrently. The merges are
+     * serialized by the critical section.
+     */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(8)
+#endif
+    for (auto i = 0; i < NUMBER_OF_STATES; i++) {
+        portfolio.synchronize(&global_states[i]);
+    }
+
+    EXPECT_TRUE(
+        portfolio.shared_incumbent_holder().is_found_feasible_solution());
+    EXPECT_FLOAT_EQ(1.0, portfolio.shared_incumbent_holder()
+                             .feasible_incumbent_objective());
+    EXPECT_FLOAT_EQ(1.0, portfolio.shared_incumbent_holder()
+                             .feasible_incumbent_solution()
+                             .objective);
+
+    /// No walker gets worse by the synchronization.
+    for (auto i = 0; i < NUMBER_OF_STATES; i++) {
+        EXPECT_LE(
+            global_states[i].incumbent_holder.feasible_incumbent_objective(),
+            NUMBER_OF_STATES - i);
+    }
+
+    /// After another synchronization, all walkers share the best incumbent.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(8)
+#endif
+    for (auto i = 0; i < NUMBER_OF_STATES; i++) {
+        portfolio.synchronize(&global_states[i]);
+    }
+    for (auto i = 0; i < NUMBER_OF_STATES; i++) {
+        EXPECT_FLOAT_EQ(
+            1.0,
+            global_states[i].incumbent_holder.feasible_incumbent_objective());
+        EXPECT_FLOAT_EQ(
+            1.0, global_states[i]
+                     .incumbent_holder.global_augmented_incumbent_objective());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchPortfolio, run) {
+    model::Model<int, double> model;
+    build_model(&model);
+
+    option::Option option;
+    option.output.verbose                     = option::verbose::Off;
+    option.neighborhood.selection_mode        = option::selection_mode::Off;
+    option.parallel.number_of_walkers         = 2;
+    option.tabu_search.iteration_max          = 100;
+    option.parallel.is_enabled_move_update_parallelization     = false;
+    option.parallel.is_enabled_move_evaluation_parallelization = false;
+    option.parallel.is_enabled_thread_count_optimization       = false;
+
+    model.setup(option, false);
+
+    /**
+     * The main walker terminates without any outer loop iteration, so that
+     * every feasible solution has to be obtained from the other walker.
+     */
+    option::Option main_option             = option;
+    main_option.general.iteration_max      = 0;
+    solver::GlobalState<int, double> main_global_state;
+    setup_global_state(&model, &main_global_state, main_option);
+    EXPECT_FALSE(
+        main_global_state.incumbent_holder.is_found_feasible_solution());
+
+    solver::tabu_search::portfolio::TabuSearchPortfolio<int, double> portfolio;
+    {
+        auto walker_ptr = std::make_unique<
+            solver::tabu_search::portfolio::TabuSearchWalker<int, double>>();
+        walker_ptr->option = solver::tabu_search::portfolio::
+            TabuSearchPortfolio<int, double>::create_walker_option(option, 1);
+        walker_ptr->option.general.iteration_max = 10;
+        walker_ptr->model_ptr = model.fork(walker_ptr->option);
+        setup_global_state(walker_ptr->model_ptr.get(),
+                           &walker_ptr->global_state, walker_ptr->option);
+        portfolio.add_walker(std::move(walker_ptr));
+    }
+    EXPECT_EQ(2, portfolio.number_of_walkers());
+
+    solver::tabu_search::controller::TabuSearchController<int, double>
+                        main_controller;
+    utility::TimeKeeper time_keeper;
+    time_keeper.set_start_time();
+
+    const auto INITIAL_SOLUTION = model.export_dense_solution().to_sparse();
+    portfolio.run(&main_controller,    //
+                  &model,              //
+                  &main_global_state,  //
+                  INITIAL_SOLUTION,    //
+                  time_keeper,         //
+                  std::nullopt,        //
+                  [](auto) {},         //
+                  main_option);
+
+    const auto& WALKER_INCUMBENT_HOLDER =
+        portfolio.walker_ptrs().front()->global_state.incumbent_holder;
+    const auto& MAIN_INCUMBENT_HOLDER = main_global_state.incumbent_holder;
+
+    /// The merged incumbent coincides with that of the best walker.
+    EXPECT_TRUE(WALKER_INCUMBENT_HOLDER.is_found_feasible_solution());
+    EXPECT_TRUE(MAIN_INCUMBENT_HOLDER.is_found_feasible_solution());
+    EXPECT_FLOAT_EQ(WALKER_INCUMBENT_HOLDER.feasible_incumbent_objective(),
+                    MAIN_INCUMBENT_HOLDER.feasible_incumbent_objective());
+    EXPECT_EQ(WALKER_INCUMBENT_HOLDER.feasible_incumbent_solution()
+                  .variable_value_proxies[0]
+                  .flat_indexed_values(),
+              MAIN_INCUMBENT_HOLDER.feasible_incumbent_solution()
+                  .variable_value_proxies[0]
+                  .flat_indexed_values());
+    EXPECT_LE(MAIN_INCUMBENT_HOLDER.global_augmented_incumbent_objective(),
+              WALKER_INCUMBENT_HOLDER.global_augmented_incumbent_objective());
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchPortfolio, run_interrupted) {
+    model::Model<int, double> model;
+    build_model(&model);
+
+    option::Option option;
+    option.output.verbose                     = option::verbose::Off;
+    option.neighborhood.selection_mode        = option::selection_mode::Off;
+    option.parallel.number_of_walkers         = 2;
+    option.general.iteration_max              = 1000000;
+    option.general.time_max                   = 1000000;
+    option.tabu_search.iteration_max          = 100;
+    option.parallel.is_enabled_move_update_parallelization     = false;
+    option.parallel.is_enabled_move_evaluation_parallelization = false;
+    option.parallel.is_enabled_thread_count_optimization       = false;
+
+    model.setup(option, false);
+
+    solver::GlobalState<int, double> main_global_state;
+    setup_global_state(&model, &main_global_state, option);
+
+    solver::tabu_search::portfolio::TabuSearchPortfolio<int, double> portfolio;
+    {
+        auto walker_ptr = std::make_unique<
+            solver::tabu_search::portfolio::TabuSearchWalker<int, double>>();
+        walker_ptr->option = solver::tabu_search::portfolio::
+            TabuSearchPortfolio<int, double>::create_walker_option(option, 1);
+        walker_ptr->model_ptr = model.fork(walker_ptr->option);
+        setup_global_state(walker_ptr->model_ptr.get(),
+                           &walker_ptr->global_state, walker_ptr->option);
+        portfolio.add_walker(std::move(walker_ptr));
+    }
+
+    solver::tabu_search::controller::TabuSearchController<int, double>
+                        main_controller;
+    utility::TimeKeeper time_keeper;
+    time_keeper.set_start_time();
+
+    /**
+     * The interrupt checker is called only by the main walker, and the other
+     * walker stops by the broadcast flag.
+     */
+    std::atomic<int> number_of_calls(0);
+    std::atomic<int> number_of_calls_from_other_threads(0);
+    const std::function<bool()> CHECK_INTERRUPT = [&]() {
+        number_of_calls++;
+#ifdef _OPENMP
+        if (omp_get_thread_num() != 0) {
+            number_of_calls_from_other_threads++;
+        }
+#endif
+        return true;
+    };
+
+    const auto INITIAL_SOLUTION = model.export_dense_solution().to_sparse();
+    portfolio.run(&main_controller,    //
+                  &model,              //
+                  &main_global_state,  //
+                  INITIAL_SOLUTION,    //
+                  time_keeper,         //
+                  CHECK_INTERRUPT,     //
+                  [](auto) {},         //
+                  option);
+
+    EXPECT_LT(0, number_of_calls.load());
+    EXPECT_EQ(0, number_of_calls_from_other_threads.load());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,173 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestJsonParser : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_object) {
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.parse(
+        "{\"key_0\":1,\"key_1\":3.14,\"key_2\":\"hoge "
+        "hoge\",\"key_3\":{\"key_3_1\":null},\"key_4\":[1,2],"
+        "\"key_5\":true,\"key_6\":-1e-3}");
+
+    EXPECT_TRUE(ROOT.is_object());
+    EXPECT_EQ(7, static_cast<int>(ROOT.size));
+
+    EXPECT_TRUE(ROOT.at("key_0").is_integer());
+    EXPECT_EQ(1, ROOT.get<int>("key_0"));
+    EXPECT_FLOAT_EQ(1.0, ROOT.get<double>("key_0"));
+
+    EXPECT_FALSE(ROOT.at("key_1").is_integer());
+    EXPECT_FLOAT_EQ(3.14, ROOT.get<double>("key_1"));
+
+    EXPECT_EQ("hoge hoge", ROOT.get<std::string>("key_2"));
+    EXPECT_TRUE(ROOT.at("key_3").at("key_3_1").is_null());
+
+    EXPECT_TRUE(ROOT.at("key_4").is_array());
+    EXPECT_EQ(2, static_cast<int>(ROOT.at("key_4").size));
+    EXPECT_EQ(1, ROOT.at("key_4")[0].as<int>());
+    EXPECT_EQ(2, ROOT.at("key_4")[1].as<int>());
+
+    EXPECT_TRUE(ROOT.get<bool>("key_5"));
+    EXPECT_FLOAT_EQ(-1e-3, ROOT.get<double>("key_6"));
+
+    EXPECT_TRUE(ROOT.find("key_0"));
+    EXPECT_FALSE(ROOT.find("key_7"));
+
+    ASSERT_THROW(ROOT.get<int>("key_1"), std::runtime_error);
+    ASSERT_THROW(ROOT.get<std::string>("key_0"), std::runtime_error);
+    ASSERT_THROW(ROOT.at("key_7"), std::runtime_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_member_order) {
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.parse("{ \"c\": 1, \"a\": 2, \"b\": 3 }");
+
+    std::vector<std::string> keys;
+    for (const auto &member : ROOT) {
+        keys.emplace_back(member.key);
+    }
+    EXPECT_EQ("c", keys[0]);
+    EXPECT_EQ("a", keys[1]);
+    EXPECT_EQ("b", keys[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_escape) {
+    utility::json::JsonDocument document;
+
+    const auto &ROOT =
+        document.parse("[\"a\\\"b\", \"c\\\\d\", \"e\\nf\", \"\\u0041\"]");
+
+    EXPECT_EQ("a\"b", ROOT[0].as<std::string>());
+    EXPECT_EQ("c\\d", ROOT[1].as<std::string>());
+    EXPECT_EQ("e\nf", ROOT[2].as<std::string>());
+    EXPECT_EQ("A", ROOT[3].as<std::string>());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_empty_and_nested) {
+    utility::json::JsonDocument document;
+
+    const auto &ROOT =
+        document.parse("{\"a\":{},\"b\":[],\"c\":[[1],[2,[3]]]}");
+
+    EXPECT_EQ(0, static_cast<int>(ROOT.at("a").size));
+    EXPECT_EQ(0, static_cast<int>(ROOT.at("b").size));
+    EXPECT_EQ(3, ROOT.at("c")[1][1][0].as<int>());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_large_array) {
+    std::string str = "[";
+    for (auto i = 0; i < 100000; i++) {
+        str += (i > 0 ? "," : "") + std::to_string(i);
+    }
+    str += "]";
+
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.parse(str);
+    EXPECT_EQ(100000, static_cast<int>(ROOT.size));
+    EXPECT_EQ(0, ROOT[0].as<int>());
+    EXPECT_EQ(99999, ROOT[99999].as<int>());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_invalid) {
+    utility::json::JsonDocument document;
+
+    ASSERT_THROW(document.parse("{\"a\":1"), std::runtime_error);
+    ASSERT_THROW(document.parse("{\"a\" 1}"), std::runtime_error);
+    ASSERT_THROW(document.parse("[1,2]]"), std::runtime_error);
+    ASSERT_THROW(document.parse("[tru]"), std::runtime_error);
+    ASSERT_THROW(document.parse("{\"a\":\"b}"), std::runtime_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, parse_non_finite) {
+    /**
+     * The non-finite values written by JsonWriter can be read back.
+     */
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+
+    writer.begin_object();
+    writer.member("nan", std::numeric_limits<double>::quiet_NaN());
+    writer.member("inf", std::numeric_limits<double>::infinity());
+    writer.member("-inf", -std::numeric_limits<double>::infinity());
+    writer.member("null", nullptr);
+    writer.member("x", 1);
+    writer.end_object();
+    writer.flush();
+
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.parse(ss.str());
+    EXPECT_TRUE(std::isnan(ROOT.find_member("nan")->as<double>()));
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              ROOT.find_member("inf")->as<double>());
+    EXPECT_EQ(-std::numeric_limits<double>::infinity(),
+              ROOT.find_member("-inf")->as<double>());
+    EXPECT_TRUE(ROOT.find_member("null")->is_null());
+    EXPECT_EQ(1, ROOT.find_member("x")->as<int>());
+
+    EXPECT_TRUE(std::isnan(document.parse("[-nan]")[0].as<double>()));
+    ASSERT_THROW(document.parse("[nanx]"), std::runtime_error);
+    ASSERT_THROW(document.parse("[infi]"), std::runtime_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonParser, read) {
+    utility::json::JsonDocument document;
+
+    const auto &ROOT = document.read("./test/dat/option/option_00.json");
+    EXPECT_TRUE(ROOT.is_object());
+    EXPECT_TRUE(ROOT.find("general"));
+
+    ASSERT_THROW(document.read("not_exist.json"), std::runtime_error);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,179 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestJsonWriter : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, scalar_members) {
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+
+    writer.begin_object();
+    writer.member("int", 1);
+    writer.member("long", -20000000000L);
+    writer.member("double", 3.14);
+    writer.member("bool", true);
+    writer.member("string", "hoge");
+    writer.member("null", nullptr);
+    writer.end_object();
+    writer.flush();
+
+    EXPECT_EQ(
+        "{ \n"
+        "    \"int\": 1, \n"
+        "    \"long\": -20000000000, \n"
+        "    \"double\": 3.140000e+00, \n"
+        "    \"bool\": true, \n"
+        "    \"string\": \"hoge\", \n"
+        "    \"null\": null\n"
+        "}",
+        ss.str());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, nested_containers) {
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+
+    writer.begin_object();
+    writer.key("array");
+    writer.begin_array();
+    writer.value(1);
+    writer.begin_array();
+    writer.value(2);
+    writer.end_array();
+    writer.end_array();
+    writer.key("empty_object");
+    writer.begin_object();
+    writer.end_object();
+    writer.key("empty_array");
+    writer.begin_array();
+    writer.end_array();
+    writer.end_object();
+    writer.flush();
+
+    EXPECT_EQ(
+        "{ \n"
+        "    \"array\": [ \n"
+        "        1, \n"
+        "        [ \n"
+        "            2\n"
+        "        ]\n"
+        "    ], \n"
+        "    \"empty_object\": {}, \n"
+        "    \"empty_array\": []\n"
+        "}",
+        ss.str());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, escape) {
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+
+    writer.value("a\"b\\c\n");
+    writer.flush();
+
+    EXPECT_EQ("\"a\\\"b\\\\c\\n\"", ss.str());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, json_object) {
+    using JsonObject = utility::json::JsonObject;
+    using JsonArray  = utility::json::JsonArray;
+
+    JsonObject child;
+    child.emplace_back("key_3_1", 2.5);
+
+    JsonArray array;
+    array.emplace_back(1);
+    array.emplace_back(std::string("hoge"));
+
+    JsonObject object;
+    object.emplace_back("key_0", 1);
+    object.emplace_back("key_1", true);
+    object.emplace_back("key_2", std::string("hoge"));
+    object.emplace_back("key_3", child);
+    object.emplace_back("key_4", array);
+
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+    writer.value(object);
+    writer.flush();
+
+    std::stringstream expected;
+    expected << object;
+
+    EXPECT_EQ(expected.str(), ss.str());
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, large_output) {
+    std::stringstream ss;
+    {
+        utility::json::JsonWriter writer(&ss);
+        writer.begin_array();
+        for (auto i = 0; i < 10000; i++) {
+            writer.value(i);
+        }
+        writer.end_array();
+    }
+
+    /// parse_json_array() expects a single-line input.
+    auto str = ss.str();
+    str.erase(std::remove(str.begin(), str.end(), '\n'), str.end());
+
+    auto array = utility::json::parse_json_array(str);
+    EXPECT_EQ(10000, static_cast<int>(array.body.size()));
+    EXPECT_EQ(0, array.get<int>(0));
+    EXPECT_EQ(9999, array.get<int>(9999));
+}
+
+/*****************************************************************************/
+TEST_F(TestJsonWriter, write_value_proxies) {
+    multi_array::ValueProxy<int> proxy(0, {2, 2});
+    proxy.values(0, 0) = 1;
+    proxy.values(0, 1) = 2;
+    proxy.values(1, 0) = 3;
+    proxy.values(1, 1) = 4;
+
+    std::unordered_map<std::string, multi_array::ValueProxy<int>> proxies;
+    proxies["x"] = proxy;
+
+    std::stringstream         ss;
+    utility::json::JsonWriter writer(&ss);
+    multi_array::write_json_array(&writer, proxies);
+    writer.flush();
+
+    /// parse_json_object() expects a single-line input.
+    auto str = ss.str();
+    str.erase(std::remove(str.begin(), str.end(), '\n'), str.end());
+
+    auto object = utility::json::parse_json_object(str);
+    auto x      = object.get<utility::json::JsonArray>("x");
+    EXPECT_EQ(2, static_cast<int>(x.body.size()));
+    EXPECT_EQ(1, x.get<utility::json::JsonArray>(0).get<int>(0));
+    EXPECT_EQ(2, x.get<utility::json::JsonArray>(0).get<int>(1));
+    EXPECT_EQ(3, x.get<utility::json::JsonArray>(1).get<int>(0));
+    EXPECT_EQ(4, x.get<utility::json::JsonArray>(1).get<int>(1));
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -60,6 +60,43 @@ TEST_F(TestSparseMatrixFunction, subtract) {
     EXPECT_FLOAT_EQ(-6.0, result[2]);
 }
 
+/*****************************************************************************/
+TEST_F(TestSparseMatrixFunction, subtract_with_square_sum) {
+    printemps::utility::sparse::Vector x;
+    x.values = std::vector<double>{1.0, 2.0, 3.0};
+    printemps::utility::sparse::Vector y;
+    y.values = std::vector<double>{3.0, 6.0, 9.0};
+
+    printemps::utility::sparse::Vector result(3);
+    EXPECT_FLOAT_EQ(56.0, printemps::utility::sparse::subtract_with_square_sum(
+                              &result, x, y));
+
+    EXPECT_FLOAT_EQ(-2.0, result[0]);
+    EXPECT_FLOAT_EQ(-4.0, result[1]);
+    EXPECT_FLOAT_EQ(-6.0, result[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseMatrixFunction, extrapolate) {
+    printemps::utility::sparse::Vector x;
+    x.values = std::vector<double>{1.0, 2.0, 3.0};
+    printemps::utility::sparse::Vector y;
+    y.values = std::vector<double>{3.0, 6.0, 9.0};
+
+    printemps::utility::sparse::Vector extrapolated(3);
+    printemps::utility::sparse::Vector move(3);
+    EXPECT_FLOAT_EQ(56.0, printemps::utility::sparse::extrapolate(
+                              &extrapolated, &move, y, x));
+
+    EXPECT_FLOAT_EQ(2.0, move[0]);
+    EXPECT_FLOAT_EQ(4.0, move[1]);
+    EXPECT_FLOAT_EQ(6.0, move[2]);
+
+    EXPECT_FLOAT_EQ(5.0, extrapolated[0]);
+    EXPECT_FLOAT_EQ(10.0, extrapolated[1]);
+    EXPECT_FLOAT_EQ(15.0, extrapolated[2]);
+}
+
 /*****************************************************************************/
 TEST_F(TestSparseMatrixFunction, linear_combination_1) {
     printemps::utility::sparse::Vector x;
@@ -165,6 +202,65 @@ TEST_F(TestSparseMatrixFunction, linear_combination_5) {
     EXPECT_FLOAT_EQ(93.0, result[2]);
 }
 
+/*****************************************************************************/
+TEST_F(TestSparseMatrixFunction, linear_combination_clamp_1) {
+    printemps::utility::sparse::Vector x;
+    x.values = std::vector<double>{1.0, 2.0, 3.0};
+    printemps::utility::sparse::Vector y;
+    y.values = std::vector<double>{3.0, 6.0, 9.0};
+    printemps::utility::sparse::Vector z;
+    z.values = std::vector<double>{5.0, 10.0, 15.0};
+    printemps::utility::sparse::Vector lower_bounds;
+    lower_bounds.values = std::vector<double>{0.0, 0.0, 100.0};
+    printemps::utility::sparse::Vector upper_bounds;
+    upper_bounds.values = std::vector<double>{20.0, 100.0, 200.0};
+
+    printemps::utility::sparse::Vector result(3);
+
+    printemps::utility::sparse::linear_combination_clamp(  //
+        &result, 2.0, x, 3.0, y, 4.0, z, lower_bounds, upper_bounds);
+
+    EXPECT_FLOAT_EQ(20.0, result[0]);
+    EXPECT_FLOAT_EQ(62.0, result[1]);
+    EXPECT_FLOAT_EQ(100.0, result[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseMatrixFunction, linear_combination_clamp_2) {
+    printemps::utility::sparse::Vector x;
+    x.values = std::vector<double>{1.0, 2.0, 3.0};
+    printemps::utility::sparse::Vector y;
+    y.values = std::vector<double>{3.0, 6.0, 9.0};
+    printemps::utility::sparse::Vector z;
+    z.values = std::vector<double>{5.0, 10.0, 15.0};
+    printemps::utility::sparse::Vector lower_bounds;
+    lower_bounds.values = std::vector<double>{0.0, 0.0, 100.0};
+    printemps::utility::sparse::Vector upper_bounds;
+    upper_bounds.values = std::vector<double>{40.0, 100.0, 200.0};
+
+    std::vector<double> values         = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+    std::vector<int>    row_indices    = {0, 0, 0, 1, 1, 2};
+    std::vector<int>    column_indices = {0, 1, 2, 1, 2, 2};
+
+    utility::sparse::SparseMatrix sparse_matrix(  //
+        values, row_indices, column_indices, 3, 3);
+
+    printemps::utility::sparse::Vector result(3);
+    printemps::utility::sparse::Vector product(3);
+
+    printemps::utility::sparse::linear_combination_clamp(  //
+        &result, &product, 2.0, sparse_matrix, x, 3.0, y, 4.0, z,
+        lower_bounds, upper_bounds);
+
+    EXPECT_FLOAT_EQ(40.0, result[0]);
+    EXPECT_FLOAT_EQ(68.0, result[1]);
+    EXPECT_FLOAT_EQ(100.0, result[2]);
+
+    EXPECT_FLOAT_EQ(6.0, product[0]);
+    EXPECT_FLOAT_EQ(5.0, product[1]);
+    EXPECT_FLOAT_EQ(3.0, product[2]);
+}
+
 /*****************************************************************************/
 TEST_F(TestSparseMatrixFunction, dot_dot) {
     printemps::utility::sparse::Vector x;
@@ -183,6 +279,9 @@ TEST_F(TestSparseMatrixFunction, dot_dot) {
 
     EXPECT_FLOAT_EQ(360.0, printemps::utility::sparse::dot_dot(
                                &result, y, sparse_matrix, x));
+    EXPECT_FLOAT_EQ(7.0, result[0]);
+    EXPECT_FLOAT_EQ(22.0, result[1]);
+    EXPECT_FLOAT_EQ(23.0, result[2]);
 }
 
 }  // namespace
@@ -149,6 +149,187 @@ TEST_F(TestSparseSparseMatrix, transpose) {
     EXPECT_FLOAT_EQ(6.0, transposed.norm_infty);
 }
 
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, enable_single_precision) {
+    std::vector<double> values         = {1.0, 2.0, 3.0, 4.0, 5.0, 0.1};
+    std::vector<int>    row_indices    = {0, 0, 1, 1, 2, 2};
+    std::vector<int>    column_indices = {0, 2, 1, 3, 0, 2};
+
+    utility::sparse::SparseMatrix sparse_matrix(values, row_indices,
+                                                column_indices, 3, 4);
+    EXPECT_FALSE(sparse_matrix.is_enabled_single_precision);
+    EXPECT_TRUE(sparse_matrix.values_single.empty());
+
+    sparse_matrix.enable_single_precision();
+    EXPECT_TRUE(sparse_matrix.is_enabled_single_precision);
+    EXPECT_EQ(6, static_cast<int>(sparse_matrix.values_single.size()));
+    EXPECT_FLOAT_EQ(1.0, sparse_matrix.values_single[0]);
+    EXPECT_EQ(0.1f, sparse_matrix.values_single[5]);
+
+    /// The single precision values are rebuilt by scaling.
+    sparse_matrix.pock_chambolle_scaling();
+    for (auto i = 0; i < 6; i++) {
+        EXPECT_EQ(static_cast<float>(sparse_matrix.values[i]),
+                  sparse_matrix.values_single[i]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, update_single_precision_values) {
+    /// This method is tested in enable_single_precision.
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, disable_single_precision) {
+    std::vector<double> values         = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<int>    row_indices    = {0, 0, 1, 1, 2, 2};
+    std::vector<int>    column_indices = {0, 2, 1, 3, 0, 2};
+
+    utility::sparse::SparseMatrix sparse_matrix(values, row_indices,
+                                                column_indices, 3, 4);
+    sparse_matrix.enable_single_precision();
+    sparse_matrix.disable_single_precision();
+    EXPECT_FALSE(sparse_matrix.is_enabled_single_precision);
+    EXPECT_TRUE(sparse_matrix.values_single.empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, row_range) {
+    std::vector<double> values         = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<int>    row_indices    = {0, 0, 0, 0, 1, 3};
+    std::vector<int>    column_indices = {0, 1, 2, 3, 0, 2};
+
+    utility::sparse::SparseMatrix sparse_matrix(values, row_indices,
+                                                column_indices, 4, 4);
+
+    {
+        const auto [BEGIN, END] = sparse_matrix.row_range(0, 1);
+        EXPECT_EQ(0, BEGIN);
+        EXPECT_EQ(4, END);
+    }
+
+    /// The partitions cover all rows without overlaps.
+    for (const auto NUMBER_OF_PARTITIONS : {2, 3, 8}) {
+        int previous_end = 0;
+        for (auto i = 0; i < NUMBER_OF_PARTITIONS; i++) {
+            const auto [BEGIN, END] =
+                sparse_matrix.row_range(i, NUMBER_OF_PARTITIONS);
+            EXPECT_EQ(previous_end, BEGIN);
+            EXPECT_LE(BEGIN, END);
+            previous_end = END;
+        }
+        EXPECT_EQ(4, previous_end);
+    }
+
+    /// The first row is heavy and forms a partition by itself.
+    {
+        const auto [BEGIN, END] = sparse_matrix.row_range(0, 2);
+        EXPECT_EQ(0, BEGIN);
+        EXPECT_EQ(1, END);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, row_dot) {
+    const int NUMBER_OF_ROWS    = 20;
+    const int NUMBER_OF_COLUMNS = 50;
+
+    std::vector<double> values;
+    std::vector<int>    row_indices;
+    std::vector<int>    column_indices;
+    for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+        for (auto j = 0; j < NUMBER_OF_COLUMNS; j += 1 + i % 5) {
+            values.push_back(0.5 * (i + 1) - 0.25 * j);
+            row_indices.push_back(i);
+            column_indices.push_back(j);
+        }
+    }
+    utility::sparse::SparseMatrix sparse_matrix(
+        values, row_indices, column_indices, NUMBER_OF_ROWS, NUMBER_OF_COLUMNS);
+
+    printemps::utility::sparse::Vector x(NUMBER_OF_COLUMNS);
+    for (auto j = 0; j < NUMBER_OF_COLUMNS; j++) {
+        x[j] = 1.0 + 0.125 * j;
+    }
+
+    for (const auto INSTRUCTION_SET :
+         {utility::simd::InstructionSet::Scalar,
+          utility::simd::InstructionSet::AVX2,
+          utility::simd::InstructionSet::AVX512}) {
+        if (!utility::simd::is_supported(INSTRUCTION_SET)) {
+            continue;
+        }
+        for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+            EXPECT_DOUBLE_EQ(
+                sparse_matrix.row_dot_scalar(i, x.values.data()),
+                sparse_matrix.row_dot(i, x.values.data(), INSTRUCTION_SET));
+        }
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, row_dot_single) {
+    const int NUMBER_OF_ROWS    = 20;
+    const int NUMBER_OF_COLUMNS = 50;
+
+    std::vector<double> values;
+    std::vector<int>    row_indices;
+    std::vector<int>    column_indices;
+    for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+        for (auto j = 0; j < NUMBER_OF_COLUMNS; j += 1 + i % 5) {
+            values.push_back(0.1 * (i + 1) - 0.3 * j);
+            row_indices.push_back(i);
+            column_indices.push_back(j);
+        }
+    }
+    utility::sparse::SparseMatrix sparse_matrix(
+        values, row_indices, column_indices, NUMBER_OF_ROWS, NUMBER_OF_COLUMNS);
+
+    printemps::utility::sparse::Vector x(NUMBER_OF_COLUMNS);
+    for (auto j = 0; j < NUMBER_OF_COLUMNS; j++) {
+        x[j] = 1.0 + 0.125 * j;
+    }
+
+    std::vector<double> expected(NUMBER_OF_ROWS);
+    for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+        expected[i] = sparse_matrix.row_dot_scalar(i, x.values.data());
+    }
+
+    sparse_matrix.enable_single_precision();
+    for (const auto INSTRUCTION_SET :
+         {utility::simd::InstructionSet::Scalar,
+          utility::simd::InstructionSet::AVX2,
+          utility::simd::InstructionSet::AVX512}) {
+        if (!utility::simd::is_supported(INSTRUCTION_SET)) {
+            continue;
+        }
+        for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+            const double RESULT =
+                sparse_matrix.row_dot(i, x.values.data(), INSTRUCTION_SET);
+            EXPECT_DOUBLE_EQ(
+                sparse_matrix.row_dot_single_scalar(i, x.values.data()),
+                RESULT);
+            EXPECT_NEAR(expected[i], RESULT,
+                        1E-5 * std::max(1.0, std::fabs(expected[i])));
+        }
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, row_dot_scalar) {
+    /// This method is tested in row_dot.
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, row_dot_single_scalar) {
+    /// This method is tested in row_dot_single.
+}
+
+/*****************************************************************************/
+TEST_F(TestSparseSparseMatrix, for_each_row_product) {
+    /// This method is tested in dot_with_buffer.
+}
+
 /*****************************************************************************/
 TEST_F(TestSparseSparseMatrix, dot_with_buffer) {
     std::vector<double> values         = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
@@ -118,6 +118,23 @@ TEST_F(TestSparseVector, size) {
     /// This method is tested in constructor_with_arg().
 }
 
+/*****************************************************************************/
+TEST_F(TestSparseVector, swap) {
+    utility::sparse::Vector x;
+    utility::sparse::Vector y;
+    x.values = std::vector<double>{1.0, 2.0, 3.0};
+    y.values = std::vector<double>{4.0, 5.0};
+
+    const auto *X_DATA = x.values.data();
+    x.swap(y);
+
+    EXPECT_EQ(2, static_cast<int>(x.size()));
+    EXPECT_EQ(3, static_cast<int>(y.size()));
+    EXPECT_EQ(4.0, x[0]);
+    EXPECT_EQ(1.0, y[0]);
+    EXPECT_EQ(X_DATA, y.values.data());
+}
+
 /*****************************************************************************/
 TEST_F(TestSparseVector, reset) {
     utility::sparse::Vector vector(5, 0.0);
@@ -0,0 +1,133 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <string>
+
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestBitset : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestBitset, initialize) {
+    utility::Bitset bitset;
+
+    EXPECT_EQ(0, bitset.size());
+    EXPECT_EQ(0, bitset.number_of_words());
+    EXPECT_TRUE(bitset.none());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, setup) {
+    utility::Bitset bitset(130);
+
+    EXPECT_EQ(130, bitset.size());
+    EXPECT_EQ(3, bitset.number_of_words());
+    EXPECT_EQ(0, bitset.count());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, set) {
+    utility::Bitset bitset(130);
+
+    bitset.set(0);
+    bitset.set(63);
+    bitset.set(64, true);
+    bitset.set(129, true);
+    EXPECT_TRUE(bitset.test(0));
+    EXPECT_FALSE(bitset.test(1));
+    EXPECT_TRUE(bitset.test(63));
+    EXPECT_TRUE(bitset.test(64));
+    EXPECT_TRUE(bitset.test(129));
+    EXPECT_EQ(4, bitset.count());
+
+    bitset.set(64, false);
+    EXPECT_FALSE(bitset.test(64));
+    EXPECT_EQ(3, bitset.count());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, test) {
+    /// This method is tested in set().
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, reset) {
+    utility::Bitset bitset(130);
+    bitset.set(10);
+    bitset.set(100);
+
+    bitset.reset(10);
+    EXPECT_FALSE(bitset.test(10));
+    EXPECT_EQ(1, bitset.count());
+
+    bitset.reset();
+    EXPECT_TRUE(bitset.none());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, count) {
+    utility::Bitset bitset(1000);
+    for (auto i = 0; i < 1000; i += 3) {
+        bitset.set(i);
+    }
+    EXPECT_EQ(334, bitset.count());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, any) {
+    utility::Bitset bitset(200);
+    EXPECT_FALSE(bitset.any());
+    EXPECT_TRUE(bitset.none());
+
+    bitset.set(199);
+    EXPECT_TRUE(bitset.any());
+    EXPECT_FALSE(bitset.none());
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, none) {
+    /// This method is tested in any().
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, lowest_set_bit_index) {
+    EXPECT_EQ(0, utility::Bitset::lowest_set_bit_index(1));
+    EXPECT_EQ(3, utility::Bitset::lowest_set_bit_index(0b11000));
+    EXPECT_EQ(63, utility::Bitset::lowest_set_bit_index(std::uint64_t(1)
+                                                         << 63));
+}
+
+/*****************************************************************************/
+TEST_F(TestBitset, for_each_set_bit) {
+    utility::Bitset bitset(200);
+    bitset.set(1);
+    bitset.set(64);
+    bitset.set(130);
+    bitset.set(199);
+
+    std::vector<int> indices;
+    for (auto i = 0; i < bitset.number_of_words(); i++) {
+        utility::Bitset::for_each_set_bit(
+            bitset.words()[i], i << 6,
+            [&indices](const int a_INDEX) { indices.push_back(a_INDEX); });
+    }
+    EXPECT_EQ(std::vector<int>({1, 64, 130, 199}), indices);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,47 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestSIMDUtility : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestSIMDUtility, detect_instruction_set) {
+    const auto INSTRUCTION_SET = utility::simd::detect_instruction_set();
+    EXPECT_EQ(INSTRUCTION_SET, utility::simd::detect_instruction_set());
+    EXPECT_TRUE(utility::simd::is_supported(INSTRUCTION_SET));
+}
+
+/*****************************************************************************/
+TEST_F(TestSIMDUtility, is_supported) {
+    EXPECT_TRUE(
+        utility::simd::is_supported(utility::simd::InstructionSet::Scalar));
+}
+
+/*****************************************************************************/
+TEST_F(TestSIMDUtility, instruction_set_label) {
+    EXPECT_EQ("Scalar", utility::simd::instruction_set_label(
+                            utility::simd::InstructionSet::Scalar));
+    EXPECT_EQ("AVX2", utility::simd::instruction_set_label(
+                          utility::simd::InstructionSet::AVX2));
+    EXPECT_EQ("AVX512", utility::simd::instruction_set_label(
+                            utility::simd::InstructionSet::AVX512));
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
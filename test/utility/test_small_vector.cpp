@@ -0,0 +1,150 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <string>
+
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestSmallVector : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, initialize) {
+    utility::SmallVector<int, 4> vector;
+
+    EXPECT_EQ(0, static_cast<int>(vector.size()));
+    EXPECT_EQ(4, static_cast<int>(vector.capacity()));
+    EXPECT_TRUE(vector.empty());
+    EXPECT_TRUE(vector.is_inline());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, emplace_back) {
+    utility::SmallVector<int, 4> vector;
+    for (auto i = 0; i < 4; i++) {
+        vector.emplace_back(i);
+        EXPECT_TRUE(vector.is_inline());
+    }
+    for (auto i = 4; i < 10; i++) {
+        vector.emplace_back(i);
+        EXPECT_FALSE(vector.is_inline());
+    }
+    EXPECT_EQ(10, static_cast<int>(vector.size()));
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(i, vector[i]);
+    }
+    EXPECT_EQ(0, vector.front());
+    EXPECT_EQ(9, vector.back());
+
+    /// The heap buffer is kept after clear().
+    vector.clear();
+    EXPECT_TRUE(vector.empty());
+    EXPECT_FALSE(vector.is_inline());
+
+    vector.initialize();
+    EXPECT_TRUE(vector.is_inline());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, push_back) {
+    /// This method is tested in emplace_back().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, pop_back) {
+    utility::SmallVector<int, 4> vector = {0, 1, 2};
+    vector.pop_back();
+    EXPECT_EQ(2, static_cast<int>(vector.size()));
+    EXPECT_EQ(1, vector.back());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, resize) {
+    utility::SmallVector<int, 4> vector;
+    vector.resize(3);
+    EXPECT_EQ(3, static_cast<int>(vector.size()));
+    EXPECT_TRUE(vector.is_inline());
+
+    vector.resize(8);
+    EXPECT_EQ(8, static_cast<int>(vector.size()));
+    EXPECT_FALSE(vector.is_inline());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, reserve) {
+    utility::SmallVector<int, 4> vector = {0, 1};
+    vector.reserve(4);
+    EXPECT_TRUE(vector.is_inline());
+
+    vector.reserve(16);
+    EXPECT_FALSE(vector.is_inline());
+    EXPECT_LE(16, static_cast<int>(vector.capacity()));
+    EXPECT_EQ(0, vector[0]);
+    EXPECT_EQ(1, vector[1]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, insert) {
+    utility::SmallVector<int, 4> vector   = {0, 4};
+    std::vector<int>             elements = {1, 2, 3};
+
+    vector.insert(vector.begin() + 1, elements.begin(), elements.end());
+    EXPECT_EQ(5, static_cast<int>(vector.size()));
+    EXPECT_FALSE(vector.is_inline());
+    for (auto i = 0; i < 5; i++) {
+        EXPECT_EQ(i, vector[i]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, erase) {
+    {
+        utility::SmallVector<int, 4> vector = {0, 1, 2, 3};
+        vector.erase(vector.begin() + 1, vector.begin() + 3);
+        EXPECT_EQ(2, static_cast<int>(vector.size()));
+        EXPECT_EQ(0, vector[0]);
+        EXPECT_EQ(3, vector[1]);
+    }
+    {
+        utility::SmallVector<int, 4> vector = {0, 1, 2, 3, 4, 5};
+        vector.erase(vector.begin());
+        EXPECT_EQ(5, static_cast<int>(vector.size()));
+        EXPECT_EQ(1, vector.front());
+        EXPECT_EQ(5, vector.back());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, to_vector) {
+    utility::SmallVector<int, 4> vector = {0, 1, 2, 3, 4};
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4}), vector.to_vector());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, operator_equal) {
+    utility::SmallVector<int, 4> vector_0 = {0, 1, 2};
+    utility::SmallVector<int, 4> vector_1 = {0, 1, 2};
+    utility::SmallVector<int, 4> vector_2 = {0, 1, 2, 3, 4};
+
+    EXPECT_TRUE(vector_0 == vector_1);
+    EXPECT_FALSE(vector_0 != vector_1);
+    EXPECT_FALSE(vector_0 == vector_2);
+    EXPECT_TRUE(vector_0 != vector_2);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
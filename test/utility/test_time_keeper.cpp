@@ -0,0 +1,62 @@
+/*****************************************************************************/
+// Copyright (c) 2020-2025 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <printemps.h>
+
+namespace {
+using namespace printemps;
+/*****************************************************************************/
+class TestTimeKeeper : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, initialize) {
+    utility::TimeKeeper time_keeper;
+
+    EXPECT_EQ(0.0, time_keeper.start_time());
+    EXPECT_EQ(0.0, time_keeper.elapsed_time());
+    EXPECT_EQ(0.0, time_keeper.elapsed_cpu_time());
+    EXPECT_FALSE(time_keeper.is_started());
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, clock) {
+    utility::TimeKeeper time_keeper;
+    time_keeper.set_start_time();
+    EXPECT_TRUE(time_keeper.is_started());
+
+    /**
+     * Sleeping consumes wall-clock time but almost no CPU time.
+     */
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const double ELAPSED_TIME = time_keeper.clock();
+    EXPECT_GE(ELAPSED_TIME, 0.05);
+    EXPECT_EQ(ELAPSED_TIME, time_keeper.elapsed_time());
+
+    const double ELAPSED_CPU_TIME = time_keeper.cpu_clock();
+    EXPECT_GE(ELAPSED_CPU_TIME, 0.0);
+    EXPECT_LT(ELAPSED_CPU_TIME, ELAPSED_TIME);
+    EXPECT_EQ(ELAPSED_CPU_TIME, time_keeper.elapsed_cpu_time());
+
+    /**
+     * The wall-clock time is monotonic.
+     */
+    EXPECT_GE(time_keeper.clock(), ELAPSED_TIME);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/